@@ -0,0 +1,22 @@
+// Minimal sketch with the web interface, also the one CI compiles for every board and server
+#include <Arduino.h>
+#if defined(ESP32)
+#include <WiFi.h>
+#else
+#include <ESP8266WiFi.h>
+#endif
+#include <esp-knx-webserver.h>
+
+KnxWebserver webserver;
+
+void setup()
+{
+    WiFi.begin("ssid", "password");
+    webserver.setHostname("knx-device");
+    webserver.startWeb("admin", "secret"); // empty username for no login
+}
+
+void loop()
+{
+    webserver.loop(2000); // at most about 2 ms per call
+}
@@ -0,0 +1,49 @@
+#include "esp-knx-arena.h"
+
+void *KnxArena::allocate(size_t size)
+{
+    // Keeps every allocation 4 byte aligned
+    size = (size + 3) & ~(size_t)3;
+    if (size > KNXWEB_ARENA_SIZE - used)
+    {
+        HeapBlock *block = (HeapBlock *)malloc(sizeof(HeapBlock) + size);
+        if (block == nullptr)
+        {
+            failures++;
+            return nullptr;
+        }
+        overflows++;
+        block->next = heapBlocks;
+        heapBlocks = block;
+        return block + 1;
+    }
+    void *memory = buffer + used;
+    used += size;
+    if (used > highWater)
+    {
+        highWater = used;
+    }
+    return memory;
+}
+
+void KnxArena::reset()
+{
+    used = 0;
+    while (heapBlocks != nullptr)
+    {
+        HeapBlock *next = heapBlocks->next;
+        free(heapBlocks);
+        heapBlocks = next;
+    }
+}
+
+char *KnxArena::copy(const char *text, size_t length)
+{
+    char *memory = (char *)allocate(length + 1);
+    if (memory != nullptr)
+    {
+        memcpy(memory, text, length);
+        memory[length] = 0;
+    }
+    return memory;
+}
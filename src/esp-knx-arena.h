@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Memory for data that lives until the end of a request, like copies of request headers
+#ifndef KNXWEB_ARENA_SIZE
+#define KNXWEB_ARENA_SIZE 512
+#endif
+
+// Bump allocator on a fixed buffer. Memory is handed out in order and given back all at
+// once by reset() at the end of a request, so requests leave no holes in the heap.
+// A request that needs more than KNXWEB_ARENA_SIZE, like one with a large Cookie header,
+// gets the rest from the heap until reset(), each such allocation counts as an overflow.
+// Only used by the request handling, which never runs on two tasks at once.
+// The arena only holds the copies the library makes. With the sync server the core has
+// parsed the request into Strings on the heap before a handler runs: ESP8266WebServer
+// lends them out and nothing is copied, WebServer on the ESP32 and LibreTiny returns
+// a heap copy for every header() and arg(), which is moved here and freed right away.
+class KnxArena
+{
+public:
+    ~KnxArena() { reset(); }
+
+    // Returns nullptr and counts a failure only when the heap is exhausted as well
+    void *allocate(size_t size);
+    // Zero terminated copy of text
+    char *copy(const char *text, size_t length);
+    void reset();
+
+    size_t getSize() { return KNXWEB_ARENA_SIZE; }
+    size_t getHighWater() { return highWater; }
+    uint32_t getOverflows() { return overflows; }
+    uint32_t getFailures() { return failures; }
+
+private:
+    struct HeapBlock
+    {
+        HeapBlock *next;
+    };
+
+    alignas(4) uint8_t buffer[KNXWEB_ARENA_SIZE];
+    size_t used = 0;
+    size_t highWater = 0;
+    HeapBlock *heapBlocks = nullptr;
+    uint32_t overflows = 0;
+    uint32_t failures = 0;
+};
@@ -0,0 +1,279 @@
+#include "esp-knx-decompress.h"
+
+#define HS_WINDOW_SIZE (1 << KNXWEB_HEATSHRINK_WINDOW)
+
+bool KnxHeatshrinkDecoder::begin(decoderOutput *outputFctn, void *outputContext)
+{
+    end();
+    // The encoder starts with a zeroed window, back references may point into it
+    window = (uint8_t *)calloc(HS_WINDOW_SIZE, 1);
+    if (window == nullptr)
+    {
+        return false;
+    }
+    output = outputFctn;
+    context = outputContext;
+    state = HS_TAG;
+    windowPos = 0;
+    bits = 0;
+    bitCount = 0;
+    bufferLength = 0;
+    return true;
+}
+
+bool KnxHeatshrinkDecoder::decode(const uint8_t *data, size_t length)
+{
+    if (window == nullptr)
+    {
+        return false;
+    }
+    while (length > 0)
+    {
+        bits = bits << 8 | *data++;
+        bitCount += 8;
+        length--;
+
+        bool needMore = false;
+        while (!needMore)
+        {
+            switch (state)
+            {
+            case HS_TAG:
+                if (bitCount < 1)
+                {
+                    needMore = true;
+                    break;
+                }
+                bitCount -= 1;
+                state = (bits >> bitCount) & 1 ? HS_LITERAL : HS_INDEX;
+                break;
+            case HS_LITERAL:
+                if (bitCount < 8)
+                {
+                    needMore = true;
+                    break;
+                }
+                bitCount -= 8;
+                if (!emit(bits >> bitCount))
+                {
+                    return false;
+                }
+                state = HS_TAG;
+                break;
+            case HS_INDEX:
+                if (bitCount < KNXWEB_HEATSHRINK_WINDOW)
+                {
+                    needMore = true;
+                    break;
+                }
+                bitCount -= KNXWEB_HEATSHRINK_WINDOW;
+                index = ((bits >> bitCount) & (HS_WINDOW_SIZE - 1)) + 1;
+                state = HS_COUNT;
+                break;
+            case HS_COUNT:
+                if (bitCount < KNXWEB_HEATSHRINK_LOOKAHEAD)
+                {
+                    needMore = true;
+                    break;
+                }
+                bitCount -= KNXWEB_HEATSHRINK_LOOKAHEAD;
+                for (int count = ((bits >> bitCount) & ((1 << KNXWEB_HEATSHRINK_LOOKAHEAD) - 1)) + 1; count > 0; count--)
+                {
+                    if (!emit(window[(windowPos - index) & (HS_WINDOW_SIZE - 1)]))
+                    {
+                        return false;
+                    }
+                }
+                state = HS_TAG;
+                break;
+            }
+        }
+    }
+    return flush();
+}
+
+void KnxHeatshrinkDecoder::end()
+{
+    free(window);
+    window = nullptr;
+}
+
+bool KnxHeatshrinkDecoder::emit(uint8_t value)
+{
+    window[windowPos++ & (HS_WINDOW_SIZE - 1)] = value;
+    buffer[bufferLength++] = value;
+    return bufferLength < sizeof(buffer) || flush();
+}
+
+bool KnxHeatshrinkDecoder::flush()
+{
+    size_t length = bufferLength;
+    bufferLength = 0;
+    return length == 0 || output(context, buffer, length);
+}
+
+#if defined(ESP32)
+#define GZIP_FHCRC 0x02
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+
+bool KnxGzipDecoder::begin(decoderOutput *outputFctn, void *outputContext)
+{
+    end();
+    inflator = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    dictionary = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+    if (inflator == nullptr || dictionary == nullptr)
+    {
+        end();
+        return false;
+    }
+    tinfl_init(inflator);
+    output = outputFctn;
+    context = outputContext;
+    state = GZIP_HEADER;
+    dictionaryPos = 0;
+    outputSize = 0;
+    headerPos = 0;
+    return true;
+}
+
+bool KnxGzipDecoder::decode(const uint8_t *data, size_t length)
+{
+    if (inflator == nullptr)
+    {
+        return false;
+    }
+    while (length > 0)
+    {
+        if (state == GZIP_DATA)
+        {
+            tinfl_status status;
+            do
+            {
+                // The dictionary is used as circular output buffer, its content is the deflate window
+                size_t inBytes = length;
+                size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryPos;
+                status = tinfl_decompress(inflator, data, &inBytes, dictionary, dictionary + dictionaryPos, &outBytes, TINFL_FLAG_HAS_MORE_INPUT);
+                data += inBytes;
+                length -= inBytes;
+                if (outBytes > 0 && !output(context, dictionary + dictionaryPos, outBytes))
+                {
+                    return false;
+                }
+                outputSize += outBytes;
+                dictionaryPos = (dictionaryPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+            } while (status == TINFL_STATUS_HAS_MORE_OUTPUT);
+
+            if (status == TINFL_STATUS_DONE)
+            {
+                state = GZIP_TRAILER;
+                headerPos = 0;
+            }
+            else if (status < 0)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        uint8_t value = *data++;
+        length--;
+        switch (state)
+        {
+        case GZIP_HEADER:
+            header[headerPos++] = value;
+            if (headerPos == sizeof(header))
+            {
+                // Magic number and deflate as compression method
+                if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8)
+                {
+                    return false;
+                }
+                flags = header[3];
+                nextHeaderField();
+            }
+            break;
+        case GZIP_EXTRA_LENGTH:
+            skip |= value << (8 * headerPos++);
+            if (headerPos == 2)
+            {
+                state = GZIP_SKIP;
+                if (skip == 0)
+                {
+                    nextHeaderField();
+                }
+            }
+            break;
+        case GZIP_SKIP:
+            if (--skip == 0)
+            {
+                nextHeaderField();
+            }
+            break;
+        case GZIP_STRING:
+            if (value == 0)
+            {
+                nextHeaderField();
+            }
+            break;
+        case GZIP_TRAILER:
+            // CRC32 and size of the uncompressed data, the size is checked in isComplete()
+            header[headerPos++] = value;
+            if (headerPos == 8)
+            {
+                state = GZIP_DONE;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+bool KnxGzipDecoder::isComplete()
+{
+    uint32_t size = header[4] | header[5] << 8 | header[6] << 16 | (uint32_t)header[7] << 24;
+    return state == GZIP_DONE && size == outputSize;
+}
+
+void KnxGzipDecoder::end()
+{
+    free(inflator);
+    inflator = nullptr;
+    free(dictionary);
+    dictionary = nullptr;
+}
+
+void KnxGzipDecoder::nextHeaderField()
+{
+    headerPos = 0;
+    skip = 0;
+    if (flags & GZIP_FEXTRA)
+    {
+        flags &= ~GZIP_FEXTRA;
+        state = GZIP_EXTRA_LENGTH;
+    }
+    else if (flags & GZIP_FNAME)
+    {
+        flags &= ~GZIP_FNAME;
+        state = GZIP_STRING;
+    }
+    else if (flags & GZIP_FCOMMENT)
+    {
+        flags &= ~GZIP_FCOMMENT;
+        state = GZIP_STRING;
+    }
+    else if (flags & GZIP_FHCRC)
+    {
+        flags &= ~GZIP_FHCRC;
+        state = GZIP_SKIP;
+        skip = 2;
+    }
+    else
+    {
+        state = GZIP_DATA;
+    }
+}
+#endif
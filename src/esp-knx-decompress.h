@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include "rom/miniz.h"
+#endif
+
+// Window and lookahead size (as log2) of heatshrink compressed images,
+// must match the -w and -l options used with the heatshrink encoder
+#ifndef KNXWEB_HEATSHRINK_WINDOW
+#define KNXWEB_HEATSHRINK_WINDOW 11
+#endif
+#ifndef KNXWEB_HEATSHRINK_LOOKAHEAD
+#define KNXWEB_HEATSHRINK_LOOKAHEAD 4
+#endif
+
+// Receives the decompressed data, returning false stops decoding
+typedef bool decoderOutput(void *context, const uint8_t *data, size_t length);
+
+// Streaming decoder for heatshrink (LZSS) compressed data
+class KnxHeatshrinkDecoder
+{
+public:
+    bool begin(decoderOutput *output, void *context);
+    bool decode(const uint8_t *data, size_t length);
+    void end();
+
+private:
+    enum
+    {
+        HS_TAG,
+        HS_LITERAL,
+        HS_INDEX,
+        HS_COUNT,
+    } state;
+    decoderOutput *output;
+    void *context;
+    uint8_t *window = nullptr;
+    size_t windowPos;
+    uint32_t bits;
+    uint8_t bitCount;
+    uint16_t index;
+    uint8_t buffer[128];
+    size_t bufferLength;
+
+    bool emit(uint8_t value);
+    bool flush();
+};
+
+#if defined(ESP32)
+// Streaming decoder for gzip compressed data, based on the inflate implementation in ROM.
+// Needs the full 32 KB deflate window plus the decompressor state while active.
+class KnxGzipDecoder
+{
+public:
+    bool begin(decoderOutput *output, void *context);
+    bool decode(const uint8_t *data, size_t length);
+    bool isComplete();
+    void end();
+
+private:
+    enum
+    {
+        GZIP_HEADER,
+        GZIP_EXTRA_LENGTH,
+        GZIP_SKIP,
+        GZIP_STRING,
+        GZIP_DATA,
+        GZIP_TRAILER,
+        GZIP_DONE,
+    } state;
+    decoderOutput *output;
+    void *context;
+    tinfl_decompressor *inflator = nullptr;
+    uint8_t *dictionary = nullptr;
+    size_t dictionaryPos;
+    uint32_t outputSize;
+    uint8_t header[10];
+    size_t headerPos;
+    uint8_t flags;
+    size_t skip;
+
+    void nextHeaderField();
+};
+#endif
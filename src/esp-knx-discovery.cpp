@@ -0,0 +1,86 @@
+#include "esp-knx-discovery.h"
+
+#if defined(ESP32) || defined(ESP8266)
+bool KnxDiscovery::loop()
+{
+    uint32_t ip = WiFi.localIP();
+    if (ip != boundIP)
+    {
+        udp.stop();
+        replyCount = 0;
+        boundIP = ip;
+        if (ip != 0)
+        {
+#if defined(ESP32)
+            udp.beginMulticast(KNXWEB_DISCOVERY_GROUP, KNXWEB_DISCOVERY_PORT);
+#else
+            udp.beginMulticast(WiFi.localIP(), KNXWEB_DISCOVERY_GROUP, KNXWEB_DISCOVERY_PORT);
+#endif
+        }
+    }
+    if (boundIP == 0)
+    {
+        return false;
+    }
+
+    if (udp.parsePacket() > 0)
+    {
+        uint8_t query[8];
+        int length = udp.read(query, sizeof(query));
+        if (length >= 5 && memcmp(query, "KNXQ", 4) == 0 && query[4] == KNXWEB_DISCOVERY_VERSION)
+        {
+            queueReply(udp.remoteIP(), udp.remotePort(), length >= 7 ? query[5] | query[6] << 8 : 0);
+        }
+    }
+    // One reply per call, a due one leaves the queue
+    for (uint8_t i = 0; i < replyCount; i++)
+    {
+        if ((long)(millis() - replies[i].due) >= 0)
+        {
+            current = replies[i];
+            replies[i] = replies[--replyCount];
+            return true;
+        }
+    }
+    return false;
+}
+
+void KnxDiscovery::queueReply(uint32_t ip, uint16_t port, uint16_t maxDelay)
+{
+    // A repeated query of a waiting querier keeps its place
+    for (uint8_t i = 0; i < replyCount; i++)
+    {
+        if (replies[i].ip == ip && replies[i].port == port)
+        {
+            return;
+        }
+    }
+    if (replyCount == KNXWEB_DISCOVERY_QUEUE)
+    {
+        dropped++;
+        return;
+    }
+    Reply &reply = replies[replyCount++];
+    reply.ip = ip;
+    reply.port = port;
+    reply.due = millis() + (maxDelay > 0 ? random(maxDelay) : 0);
+    queries++;
+}
+
+void KnxDiscovery::sendReply(const uint8_t *data, size_t length)
+{
+    udp.beginPacket(IPAddress(current.ip), current.port);
+    udp.write(data, length);
+    udp.endPacket();
+}
+#else
+// not supported
+bool KnxDiscovery::loop()
+{
+    return false;
+}
+
+void KnxDiscovery::sendReply(const uint8_t *data, size_t length)
+{
+}
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#elif defined(ESP8266)
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#endif
+
+// Set to 1 to answer discovery queries. The responder is unauthenticated, so it is off
+// unless the installation asks for it, and leaves out the build details when the
+// webserver requires a login.
+#ifndef KNXWEB_DISCOVERY
+#define KNXWEB_DISCOVERY 0
+#endif
+
+// Multicast group and port a collector sends its query to, see tools/knx_discover.py
+#ifndef KNXWEB_DISCOVERY_PORT
+#define KNXWEB_DISCOVERY_PORT 39671
+#endif
+#ifndef KNXWEB_DISCOVERY_GROUP
+#define KNXWEB_DISCOVERY_GROUP IPAddress(239, 255, 36, 71)
+#endif
+
+// Largest reply, hostname and build details are shortened to fit
+#define KNXWEB_DISCOVERY_SIZE 160
+// Queriers waiting for their reply, a query that finds the queue full is dropped
+#ifndef KNXWEB_DISCOVERY_QUEUE
+#define KNXWEB_DISCOVERY_QUEUE 4
+#endif
+
+// Query: "KNXQ", version 1, optional uint16 maximum reply delay in ms.
+// Reply: "KNXR", version 1, flags, mode, rssi, uint16 physical address, uint32 free heap,
+// uint32 uptime in s, hostname and build details each as uint8 length and text.
+// Numbers are little endian, the mode is 0xFF without a get mode callback. The build
+// details are empty when KNXWEB_DISCOVERY_AUTH is set.
+#define KNXWEB_DISCOVERY_VERSION 1
+#define KNXWEB_DISCOVERY_CONFIG_OK 0x01
+#define KNXWEB_DISCOVERY_OTA_ACTIVE 0x02
+#define KNXWEB_DISCOVERY_AUTH 0x04
+
+// Answers discovery queries sent to the multicast group or directly to the device. The
+// reply is sent after a random part of the delay the query asks for, so a few hundred
+// devices don't answer a collector at the same moment.
+class KnxDiscovery
+{
+public:
+    // Returns true when a reply is due, the caller formats it and hands it to sendReply()
+    bool loop();
+    void sendReply(const uint8_t *data, size_t length);
+
+    uint32_t getQueries() { return queries; }
+    uint32_t getDropped() { return dropped; }
+
+private:
+#if defined(ESP32) || defined(ESP8266)
+    WiFiUDP udp;
+#endif
+    // Address the socket joined the group with, it is joined again when the address changes
+    uint32_t boundIP = 0;
+    struct Reply
+    {
+        uint32_t ip;
+        uint16_t port;
+        unsigned long due;
+    };
+    Reply replies[KNXWEB_DISCOVERY_QUEUE];
+    uint8_t replyCount = 0;
+    // Receiver of the reply loop() returned true for
+    Reply current = {};
+    uint32_t queries = 0;
+    uint32_t dropped = 0;
+
+    void queueReply(uint32_t ip, uint16_t port, uint16_t maxDelay);
+};
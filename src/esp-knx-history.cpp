@@ -0,0 +1,238 @@
+#include "esp-knx-history.h"
+
+#if KNXWEB_HISTORY
+#include <LittleFS.h>
+#endif
+
+#define HISTORY_FILE_RECORDS (KNXWEB_HISTORY_RECORDS / 2)
+
+// Records are stored little endian, independent of the struct layout of the compiler
+static void encodeRecord(const knxHistoryRecord_t &record, uint8_t *data)
+{
+    data[0] = record.boot;
+    data[1] = record.boot >> 8;
+    data[2] = record.type;
+    data[3] = record.reason;
+    for (int i = 0; i < 4; i++)
+    {
+        data[4 + i] = record.uptime >> (8 * i);
+        data[8 + i] = record.minHeap >> (8 * i);
+        data[12 + i] = record.value >> (8 * i);
+    }
+}
+
+static uint32_t decodeWord(const uint8_t *data)
+{
+    return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+static void decodeRecord(const uint8_t *data, knxHistoryRecord_t &record)
+{
+    record.boot = data[0] | data[1] << 8;
+    record.type = data[2];
+    record.reason = data[3];
+    record.uptime = decodeWord(data + 4);
+    record.minHeap = decodeWord(data + 8);
+    record.value = decodeWord(data + 12);
+}
+
+void KnxHistory::begin(uint8_t resetCode, uint32_t minHeap)
+{
+#if defined(ESP32)
+    lock = xSemaphoreCreateMutex();
+#endif
+#if KNXWEB_HISTORY
+    knxHistoryRecord_t last;
+    if (knxWebMountFileSystem())
+    {
+        fileRecords = readLast(KNXWEB_HISTORY_FILE, last);
+        if (fileRecords > 0 || readLast(KNXWEB_HISTORY_OLD_FILE, last) > 0)
+        {
+            boot = last.boot + 1;
+        }
+    }
+#endif
+    lastStats = millis();
+    add(KNX_HISTORY_BOOT, resetCode, minHeap, 0);
+}
+
+void KnxHistory::loop(unsigned long now, uint32_t minHeap)
+{
+    if (now - lastStats < KNXWEB_HISTORY_INTERVAL * 1000UL)
+    {
+        return;
+    }
+    lastStats = now;
+    add(KNX_HISTORY_STATS, 0, minHeap, peakLatency);
+    peakLatency = 0;
+}
+
+void KnxHistory::noteLatency(uint32_t micros)
+{
+    if (micros > peakLatency)
+    {
+        peakLatency = micros;
+    }
+}
+
+void KnxHistory::add(knxHistoryType_t type, uint8_t reason, uint32_t minHeap, uint32_t value)
+{
+#if defined(ESP32)
+    xSemaphoreTake(lock, portMAX_DELAY);
+#endif
+    if (pendingCount == KNXWEB_HISTORY_BATCH && !flush())
+    {
+        // Without a file system only the latest records stay
+        memmove(pending, pending + 1, sizeof(pending) - sizeof(pending[0]));
+        pendingCount--;
+    }
+    knxHistoryRecord_t &record = pending[pendingCount++];
+    record.boot = boot;
+    record.type = type;
+    record.reason = reason;
+    record.uptime = millis() / 1000;
+    record.minHeap = minHeap;
+    record.value = value;
+    // A restart may follow right away, the boot record is kept in case the device crashes soon
+    if (type != KNX_HISTORY_STATS || pendingCount == KNXWEB_HISTORY_BATCH)
+    {
+        flush();
+    }
+#if defined(ESP32)
+    xSemaphoreGive(lock);
+#endif
+}
+
+bool KnxHistory::flush()
+{
+#if KNXWEB_HISTORY
+    if (pendingCount == 0)
+    {
+        return true;
+    }
+    if (!knxWebMountFileSystem())
+    {
+        return false;
+    }
+    // The full log replaces the previous one, the file names are the only state to keep consistent
+    if (fileRecords + pendingCount > HISTORY_FILE_RECORDS)
+    {
+        LittleFS.remove(KNXWEB_HISTORY_OLD_FILE);
+        LittleFS.rename(KNXWEB_HISTORY_FILE, KNXWEB_HISTORY_OLD_FILE);
+        fileRecords = 0;
+    }
+    File file = LittleFS.open(KNXWEB_HISTORY_FILE, "a");
+    if (!file)
+    {
+        return false;
+    }
+    uint8_t data[KNXWEB_HISTORY_BATCH * KNXWEB_HISTORY_RECORD_SIZE];
+    for (uint8_t i = 0; i < pendingCount; i++)
+    {
+        encodeRecord(pending[i], data + i * KNXWEB_HISTORY_RECORD_SIZE);
+    }
+    size_t length = pendingCount * KNXWEB_HISTORY_RECORD_SIZE;
+    bool ok = file.write(data, length) == length;
+    file.close();
+    if (!ok)
+    {
+        return false;
+    }
+    fileRecords += pendingCount;
+    pendingCount = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t KnxHistory::readLast(const char *path, knxHistoryRecord_t &record)
+{
+#if KNXWEB_HISTORY
+    if (!LittleFS.exists(path))
+    {
+        return 0;
+    }
+    File file = LittleFS.open(path, "r");
+    if (!file)
+    {
+        return 0;
+    }
+    uint32_t records = file.size() / KNXWEB_HISTORY_RECORD_SIZE;
+    uint8_t data[KNXWEB_HISTORY_RECORD_SIZE];
+    if (records == 0 || !file.seek((records - 1) * KNXWEB_HISTORY_RECORD_SIZE) || file.read(data, sizeof(data)) != sizeof(data))
+    {
+        records = 0;
+    }
+    file.close();
+    if (records > 0)
+    {
+        decodeRecord(data, record);
+    }
+    return records;
+#else
+    return 0;
+#endif
+}
+
+void KnxHistory::readFile(const char *path, const std::function<void(const knxHistoryRecord_t &)> &visit)
+{
+#if KNXWEB_HISTORY
+    if (!LittleFS.exists(path))
+    {
+        return;
+    }
+    File file = LittleFS.open(path, "r");
+    if (!file)
+    {
+        return;
+    }
+    uint8_t data[4 * KNXWEB_HISTORY_RECORD_SIZE];
+    knxHistoryRecord_t record;
+    size_t length;
+    // LittleFS commits the appended data with close(), the file only holds whole records
+    while ((length = file.read(data, sizeof(data))) >= KNXWEB_HISTORY_RECORD_SIZE)
+    {
+        for (size_t offset = 0; offset + KNXWEB_HISTORY_RECORD_SIZE <= length; offset += KNXWEB_HISTORY_RECORD_SIZE)
+        {
+            decodeRecord(data + offset, record);
+            visit(record);
+        }
+    }
+    file.close();
+#endif
+}
+
+void KnxHistory::forEach(const std::function<void(const knxHistoryRecord_t &)> &visit)
+{
+    // Held while the response is written, loop() waits at most for the two files
+#if defined(ESP32)
+    xSemaphoreTake(lock, portMAX_DELAY);
+#endif
+#if KNXWEB_HISTORY
+    if (knxWebMountFileSystem())
+    {
+        readFile(KNXWEB_HISTORY_OLD_FILE, visit);
+        readFile(KNXWEB_HISTORY_FILE, visit);
+    }
+#endif
+    for (uint8_t i = 0; i < pendingCount; i++)
+    {
+        visit(pending[i]);
+    }
+#if defined(ESP32)
+    xSemaphoreGive(lock);
+#endif
+}
+
+const char *KnxHistory::getTypeName(uint8_t type)
+{
+    static const char *const names[] = {"unknown", "boot", "stats", "restart", "update", "update failed"};
+    return type < sizeof(names) / sizeof(names[0]) ? names[type] : names[0];
+}
+
+const char *KnxHistory::getReasonName(uint8_t reason)
+{
+    static const char *const names[] = {"", "command", "web", "ota"};
+    return reason < sizeof(names) / sizeof(names[0]) ? names[reason] : "";
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+#include "esp-knx-settings.h"
+
+// Set to 0 to keep the history in RAM only, it is then lost with every restart
+#ifndef KNXWEB_HISTORY
+#define KNXWEB_HISTORY KNXWEB_SETTINGS
+#endif
+
+#define KNXWEB_HISTORY_FILE "/knxweb.log"
+#define KNXWEB_HISTORY_OLD_FILE "/knxweb.old"
+
+// Records kept in flash, split over the current and the previous log file
+#ifndef KNXWEB_HISTORY_RECORDS
+#define KNXWEB_HISTORY_RECORDS 256
+#endif
+// Records collected in RAM before they are appended with one write
+#ifndef KNXWEB_HISTORY_BATCH
+#define KNXWEB_HISTORY_BATCH 8
+#endif
+// Seconds between two statistics records
+#ifndef KNXWEB_HISTORY_INTERVAL
+#define KNXWEB_HISTORY_INTERVAL (15 * 60)
+#endif
+
+#define KNXWEB_HISTORY_RECORD_SIZE 16
+
+typedef enum __knxHistoryType
+{
+    KNX_HISTORY_BOOT = 1,
+    KNX_HISTORY_STATS = 2,
+    KNX_HISTORY_RESTART = 3,
+    KNX_HISTORY_UPDATE = 4,
+    KNX_HISTORY_UPDATE_FAILED = 5,
+} knxHistoryType_t;
+
+// Cause of a restart or source of an update, a boot record has the reset code of KnxSystemInfo
+typedef enum __knxHistoryReason
+{
+    KNX_HISTORY_COMMAND = 1,
+    KNX_HISTORY_WEB = 2,
+    KNX_HISTORY_OTA = 3,
+} knxHistoryReason_t;
+
+// value is the peak request latency in µs for statistics and restart records and the
+// received bytes for web updates
+typedef struct __knxHistoryRecord
+{
+    uint16_t boot;
+    uint8_t type;
+    uint8_t reason;
+    uint32_t uptime;
+    uint32_t minHeap;
+    uint32_t value;
+} knxHistoryRecord_t;
+
+// Boot, restart, update and periodic load records kept across restarts. Records are only
+// appended, in batches to save flash writes. When the log file is full it replaces the
+// previous one, so the flash holds the last KNXWEB_HISTORY_RECORDS / 2 to
+// KNXWEB_HISTORY_RECORDS records. LittleFS writes appended data to fresh blocks, which
+// spreads the wear. Records not written yet are lost with a crash, restarts and updates
+// are written right away.
+//
+// With KNXWEB_ASYNC /api/history runs forEach() in the AsyncTCP task while loop() adds
+// records and rotates the files. On ESP32 a mutex orders them. On ESP8266 the async
+// handlers only run while loop() yields, which the file system calls do not.
+class KnxHistory
+{
+public:
+    // Adds the boot record with the reset code
+    void begin(uint8_t resetCode, uint32_t minHeap);
+    // Adds a statistics record every KNXWEB_HISTORY_INTERVAL seconds
+    void loop(unsigned long now, uint32_t minHeap);
+    void add(knxHistoryType_t type, uint8_t reason, uint32_t minHeap, uint32_t value);
+    // Peak latency since the last statistics or restart record
+    void noteLatency(uint32_t micros);
+    uint32_t getPeakLatency() { return peakLatency; }
+
+    // Visits all records oldest first, the ones in RAM last
+    void forEach(const std::function<void(const knxHistoryRecord_t &)> &visit);
+    static const char *getTypeName(uint8_t type);
+    static const char *getReasonName(uint8_t reason);
+
+private:
+    knxHistoryRecord_t pending[KNXWEB_HISTORY_BATCH] = {};
+    uint8_t pendingCount = 0;
+    uint16_t boot = 0;
+    // Records in the current log file
+    uint32_t fileRecords = 0;
+    unsigned long lastStats = 0;
+    volatile uint32_t peakLatency = 0;
+#if defined(ESP32)
+    SemaphoreHandle_t lock = nullptr;
+#endif
+
+    // Writes the collected records, returns false when they stay in RAM
+    bool flush();
+    // Returns the number of records in the file
+    uint32_t readLast(const char *path, knxHistoryRecord_t &record);
+    void readFile(const char *path, const std::function<void(const knxHistoryRecord_t &)> &visit);
+};
@@ -0,0 +1,327 @@
+#include "esp-knx-json.h"
+
+void KnxJsonReader::skipWhitespace()
+{
+    while (position < length && (data[position] == ' ' || data[position] == '\t' || data[position] == '\n' || data[position] == '\r'))
+    {
+        position++;
+    }
+}
+
+knxJsonToken_t KnxJsonReader::fail()
+{
+    state = FAILED;
+    return lastToken = KNXJSON_ERROR;
+}
+
+knxJsonToken_t KnxJsonReader::next()
+{
+    skipWhitespace();
+    if (state == FAILED)
+    {
+        return KNXJSON_ERROR;
+    }
+    if (state == DONE)
+    {
+        // Only whitespace may follow the top level value
+        return position == length ? (lastToken = KNXJSON_END) : fail();
+    }
+    if (position == length)
+    {
+        return fail();
+    }
+    char c = data[position];
+    bool inObject = depth > 0 && (objects >> (depth - 1)) & 1;
+    switch (state)
+    {
+    case KEY:
+        if (c == '}')
+        {
+            return close(true);
+        }
+        if (c != '"' || !readString())
+        {
+            return fail();
+        }
+        state = COLON;
+        return lastToken = KNXJSON_KEY;
+    case FIRST:
+        if (c == ']')
+        {
+            return close(false);
+        }
+        return value(c);
+    case COLON:
+        if (c != ':')
+        {
+            return fail();
+        }
+        position++;
+        skipWhitespace();
+        if (position == length)
+        {
+            return fail();
+        }
+        return value(data[position]);
+    case SEPARATOR:
+        if (c == (inObject ? '}' : ']'))
+        {
+            return close(inObject);
+        }
+        if (c != ',')
+        {
+            return fail();
+        }
+        position++;
+        skipWhitespace();
+        if (position == length)
+        {
+            return fail();
+        }
+        if (inObject)
+        {
+            if (data[position] != '"' || !readString())
+            {
+                return fail();
+            }
+            state = COLON;
+            return lastToken = KNXJSON_KEY;
+        }
+        return value(data[position]);
+    default:
+        return value(c);
+    }
+}
+
+knxJsonToken_t KnxJsonReader::value(char c)
+{
+    knxJsonToken_t token;
+    if (c == '{' || c == '[')
+    {
+        return open(c == '{');
+    }
+    if (c == '"')
+    {
+        token = readString() ? KNXJSON_STRING : KNXJSON_ERROR;
+    }
+    else if (c == '-' || (c >= '0' && c <= '9'))
+    {
+        token = readNumber() ? KNXJSON_NUMBER : KNXJSON_ERROR;
+    }
+    else if (c == 't')
+    {
+        token = readLiteral("true") ? KNXJSON_TRUE : KNXJSON_ERROR;
+    }
+    else if (c == 'f')
+    {
+        token = readLiteral("false") ? KNXJSON_FALSE : KNXJSON_ERROR;
+    }
+    else if (c == 'n')
+    {
+        token = readLiteral("null") ? KNXJSON_NULL : KNXJSON_ERROR;
+    }
+    else
+    {
+        token = KNXJSON_ERROR;
+    }
+    if (token == KNXJSON_ERROR)
+    {
+        return fail();
+    }
+    state = depth == 0 ? DONE : SEPARATOR;
+    return lastToken = token;
+}
+
+knxJsonToken_t KnxJsonReader::open(bool object)
+{
+    if (depth == KNXJSON_MAX_DEPTH)
+    {
+        return fail();
+    }
+    position++;
+    objects = (objects & ~(1UL << depth)) | ((uint32_t)object << depth);
+    depth++;
+    state = object ? KEY : FIRST;
+    return lastToken = object ? KNXJSON_OBJECT_BEGIN : KNXJSON_ARRAY_BEGIN;
+}
+
+knxJsonToken_t KnxJsonReader::close(bool object)
+{
+    position++;
+    depth--;
+    state = depth == 0 ? DONE : SEPARATOR;
+    return lastToken = object ? KNXJSON_OBJECT_END : KNXJSON_ARRAY_END;
+}
+
+bool KnxJsonReader::readString()
+{
+    // Starts on the opening quote, checks the escapes but leaves them in the text
+    textStart = ++position;
+    while (position < length)
+    {
+        char c = data[position];
+        if (c == '"')
+        {
+            textEnd = position++;
+            return true;
+        }
+        if ((uint8_t)c < 0x20)
+        {
+            return false;
+        }
+        if (c == '\\')
+        {
+            if (++position == length)
+            {
+                return false;
+            }
+            c = data[position];
+            if (c == 'u')
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    if (++position == length || !isxdigit((uint8_t)data[position]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (strchr("\"\\/bfnrt", c) == nullptr || c == 0)
+            {
+                return false;
+            }
+        }
+        position++;
+    }
+    return false;
+}
+
+bool KnxJsonReader::readNumber()
+{
+    textStart = position;
+    if (data[position] == '-')
+    {
+        position++;
+    }
+    // No leading zeros, then optional fraction and exponent
+    if (position < length && data[position] == '0')
+    {
+        position++;
+    }
+    else
+    {
+        size_t digits = position;
+        while (position < length && isdigit((uint8_t)data[position]))
+        {
+            position++;
+        }
+        if (position == digits)
+        {
+            return false;
+        }
+    }
+    if (position < length && data[position] == '.')
+    {
+        size_t digits = ++position;
+        while (position < length && isdigit((uint8_t)data[position]))
+        {
+            position++;
+        }
+        if (position == digits)
+        {
+            return false;
+        }
+    }
+    if (position < length && (data[position] == 'e' || data[position] == 'E'))
+    {
+        position++;
+        if (position < length && (data[position] == '+' || data[position] == '-'))
+        {
+            position++;
+        }
+        size_t digits = position;
+        while (position < length && isdigit((uint8_t)data[position]))
+        {
+            position++;
+        }
+        if (position == digits)
+        {
+            return false;
+        }
+    }
+    textEnd = position;
+    return true;
+}
+
+bool KnxJsonReader::readLiteral(const char *literal)
+{
+    size_t literalLength = strlen(literal);
+    if (length - position < literalLength || memcmp(data + position, literal, literalLength) != 0)
+    {
+        return false;
+    }
+    position += literalLength;
+    return true;
+}
+
+bool KnxJsonReader::skip()
+{
+    // Containers are read to their end, a key skips its value
+    knxJsonToken_t token = lastToken;
+    if (token == KNXJSON_KEY)
+    {
+        token = next();
+    }
+    if (token == KNXJSON_ERROR)
+    {
+        return false;
+    }
+    if (token != KNXJSON_OBJECT_BEGIN && token != KNXJSON_ARRAY_BEGIN)
+    {
+        return true;
+    }
+    uint8_t target = depth - 1;
+    while (depth > target)
+    {
+        if (next() == KNXJSON_ERROR)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool KnxJsonReader::textEquals(const char *value)
+{
+    size_t valueLength = strlen(value);
+    return valueLength == textLength() && memcmp(text(), value, valueLength) == 0;
+}
+
+bool KnxJsonReader::textToInt(int32_t &value)
+{
+    // The text is not terminated, a fraction or exponent is cut off
+    const char *c = text();
+    const char *end = c + textLength();
+    bool negative = c < end && *c == '-';
+    if (negative)
+    {
+        c++;
+    }
+    // Accumulated as a negative number, its range includes INT32_MIN
+    int32_t result = 0;
+    while (c < end && isdigit((uint8_t)*c))
+    {
+        int digit = *c++ - '0';
+        if (result < (INT32_MIN + digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 - digit;
+    }
+    if (!negative && result == INT32_MIN)
+    {
+        return false;
+    }
+    value = negative ? result : -result;
+    return true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Nesting supported by KnxJsonReader, one bit per level
+#define KNXJSON_MAX_DEPTH 32
+
+typedef enum __knxJsonToken
+{
+    KNXJSON_END = 0,
+    KNXJSON_ERROR = 1,
+    KNXJSON_OBJECT_BEGIN = 2,
+    KNXJSON_OBJECT_END = 3,
+    KNXJSON_ARRAY_BEGIN = 4,
+    KNXJSON_ARRAY_END = 5,
+    KNXJSON_KEY = 6,
+    KNXJSON_STRING = 7,
+    KNXJSON_NUMBER = 8,
+    KNXJSON_TRUE = 9,
+    KNXJSON_FALSE = 10,
+    KNXJSON_NULL = 11,
+} knxJsonToken_t;
+
+// Pull parser over a JSON text in memory. It checks the syntax while reading and never
+// allocates: keys, strings and numbers are returned as pointers into the text, strings
+// without their quotes but with their escapes as they were sent.
+class KnxJsonReader
+{
+public:
+    KnxJsonReader(const char *data, size_t length) : data(data), length(length) {}
+
+    // Returns KNXJSON_END after the top level value, KNXJSON_ERROR on the first syntax error and after it
+    knxJsonToken_t next();
+    // Skips the rest of the value started by the last token, returns false on a syntax error
+    bool skip();
+
+    // Text of the last KEY, STRING or NUMBER token
+    const char *text() { return data + textStart; }
+    size_t textLength() { return textEnd - textStart; }
+    bool textEquals(const char *value);
+    // Returns false when the integer part does not fit into an int32_t
+    bool textToInt(int32_t &value);
+
+private:
+    enum State : uint8_t
+    {
+        VALUE,      // a value has to follow
+        KEY,        // a key or the end of an empty object
+        FIRST,      // a value or the end of an empty array
+        COLON,      // the colon after a key
+        SEPARATOR,  // a comma or the end of the container
+        DONE,
+        FAILED,
+    };
+
+    const char *data;
+    size_t length;
+    size_t position = 0;
+    size_t textStart = 0;
+    size_t textEnd = 0;
+    uint32_t objects = 0; // bit set for every open object, clear for arrays
+    uint8_t depth = 0;
+    State state = VALUE;
+    knxJsonToken_t lastToken = KNXJSON_END;
+
+    knxJsonToken_t fail();
+    knxJsonToken_t value(char c);
+    knxJsonToken_t open(bool object);
+    knxJsonToken_t close(bool object);
+    bool readString();
+    bool readNumber();
+    bool readLiteral(const char *literal);
+    void skipWhitespace();
+};
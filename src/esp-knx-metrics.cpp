@@ -0,0 +1,68 @@
+#include "esp-knx-metrics.h"
+
+const uint32_t KnxMetrics::bucketBounds[KNXWEB_METRICS_BUCKETS] = {1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+
+void KnxMetrics::recordRequest(uint8_t slot, uint32_t duration, uint32_t bytes, int32_t heapDelta)
+{
+    if (slot >= KNXWEB_METRICS_SLOTS)
+    {
+        return;
+    }
+    // Buckets are counted without the ones below, the Prometheus output adds them up
+    uint8_t bucket = 0;
+    while (bucket < KNXWEB_METRICS_BUCKETS && duration > bucketBounds[bucket])
+    {
+        bucket++;
+    }
+    if (bucket < KNXWEB_METRICS_BUCKETS)
+    {
+        buckets[slot][bucket]++;
+    }
+    durationMicros[slot] += duration;
+    if (duration > maxDuration[slot])
+    {
+        maxDuration[slot] = duration;
+    }
+    responseBytes[slot] += bytes;
+    if (heapDelta > maxHeapDelta[slot])
+    {
+        maxHeapDelta[slot] = heapDelta;
+    }
+    requests[slot]++;
+}
+
+// Estimated from the histogram, the result is the upper bound of the bucket holding the
+// percentile. Requests slower than the last bound report the slowest request seen.
+uint32_t KnxMetrics::getPercentile(uint8_t slot, uint8_t percent)
+{
+    uint32_t count = requests[slot];
+    if (count == 0)
+    {
+        return 0;
+    }
+    uint32_t rank = ((uint64_t)count * percent + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t bucket = 0; bucket < KNXWEB_METRICS_BUCKETS; bucket++)
+    {
+        cumulative += buckets[slot][bucket];
+        if (cumulative >= rank)
+        {
+            return min(bucketBounds[bucket], maxDuration[slot]);
+        }
+    }
+    return maxDuration[slot];
+}
+
+void KnxMetrics::recordUpload(bool success, size_t bytes, uint32_t bytesPerSecond)
+{
+    if (success)
+    {
+        uploadsDone++;
+    }
+    else
+    {
+        uploadsFailed++;
+    }
+    uploadBytes += bytes;
+    uploadBytesPerSecond = bytesPerSecond;
+}
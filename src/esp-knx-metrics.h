@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Number of request counters, one per route, static asset and one for unknown paths
+#ifndef KNXWEB_METRICS_SLOTS
+#define KNXWEB_METRICS_SLOTS 32
+#endif
+
+#define KNXWEB_METRICS_BUCKETS 7
+
+// Counters and histograms of KnxWebserver. Every value has a single writer, either the
+// request handling or the upload, so the 32 bit values need no lock. A reader may see a
+// request counted before its latency, which is fine for monitoring.
+class KnxMetrics
+{
+public:
+    // Upper bounds of the latency buckets in microseconds, slower requests only show up in the count
+    static const uint32_t bucketBounds[KNXWEB_METRICS_BUCKETS];
+
+    // bytes is the size of the response body, heapDelta the free heap lost during the request
+    void recordRequest(uint8_t slot, uint32_t duration, uint32_t bytes, int32_t heapDelta);
+    void recordAuthFailure() { authFailures++; }
+    void recordUpload(bool success, size_t bytes, uint32_t bytesPerSecond);
+    void recordOtaSession() { otaSessions++; }
+
+    uint32_t getRequests(uint8_t slot) { return requests[slot]; }
+    uint32_t getBucket(uint8_t slot, uint8_t bucket) { return buckets[slot][bucket]; }
+    uint64_t getDurationMicros(uint8_t slot) { return durationMicros[slot]; }
+    uint32_t getMaxDuration(uint8_t slot) { return maxDuration[slot]; }
+    uint32_t getPercentile(uint8_t slot, uint8_t percent);
+    uint32_t getResponseBytes(uint8_t slot) { return responseBytes[slot]; }
+    int32_t getMaxHeapDelta(uint8_t slot) { return maxHeapDelta[slot]; }
+    uint32_t getAuthFailures() { return authFailures; }
+    uint32_t getUploads(bool success) { return success ? uploadsDone : uploadsFailed; }
+    uint32_t getUploadBytes() { return uploadBytes; }
+    uint32_t getUploadBytesPerSecond() { return uploadBytesPerSecond; }
+    uint32_t getOtaSessions() { return otaSessions; }
+
+private:
+    uint32_t requests[KNXWEB_METRICS_SLOTS] = {};
+    uint32_t buckets[KNXWEB_METRICS_SLOTS][KNXWEB_METRICS_BUCKETS] = {};
+    uint64_t durationMicros[KNXWEB_METRICS_SLOTS] = {};
+    uint32_t maxDuration[KNXWEB_METRICS_SLOTS] = {};
+    uint32_t responseBytes[KNXWEB_METRICS_SLOTS] = {};
+    int32_t maxHeapDelta[KNXWEB_METRICS_SLOTS] = {};
+    uint32_t authFailures = 0;
+    uint32_t uploadsDone = 0;
+    uint32_t uploadsFailed = 0;
+    uint32_t uploadBytes = 0;
+    uint32_t uploadBytesPerSecond = 0;
+    uint32_t otaSessions = 0;
+};
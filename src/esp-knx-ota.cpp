@@ -0,0 +1,147 @@
+#include "esp-knx-ota.h"
+
+void KnxOtaService::start(unsigned long now)
+{
+#if defined(ESP32) || defined(ESP8266)
+    setCallbacks();
+    if (!active)
+    {
+        ArduinoOTA.begin();
+    }
+#endif
+    active = true;
+    state = KNX_OTA_WAITING;
+    progress = 0;
+    error = "";
+    activityTime = now;
+    // The uploader is most likely started right after OTA was enabled
+    lastPoll = now - KNXWEB_OTA_POLL_MIN;
+    pollInterval = KNXWEB_OTA_POLL_MIN;
+    activitySeen = false;
+}
+
+void KnxOtaService::stop()
+{
+    if (!active)
+    {
+        return;
+    }
+    active = false;
+    state = KNX_OTA_OFF;
+#if defined(ESP32) || defined(ESP8266)
+    ArduinoOTA.end();
+#endif
+}
+
+bool KnxOtaService::loop(unsigned long now)
+{
+    if (!active)
+    {
+        return false;
+    }
+    // Taken from the next call, the update itself may have kept the last one busy for minutes.
+    // The uploader may retry right away after a failed attempt.
+    if (activitySeen)
+    {
+        activitySeen = false;
+        activityTime = now;
+        pollInterval = KNXWEB_OTA_POLL_MIN;
+    }
+    if (state != KNX_OTA_RUNNING && now - activityTime >= timeout * 1000UL)
+    {
+        stop();
+        return false;
+    }
+    if (now - lastPoll < pollInterval)
+    {
+        return false;
+    }
+    lastPoll = now;
+    polls++;
+#if defined(ESP32) || defined(ESP8266)
+    ArduinoOTA.handle();
+#endif
+    pollInterval = min((uint32_t)KNXWEB_OTA_POLL_MAX, pollInterval * 2);
+    return true;
+}
+
+void KnxOtaService::setTimeout(uint32_t seconds)
+{
+    timeout = constrain(seconds, (uint32_t)KNXWEB_OTA_TIMEOUT_MIN, (uint32_t)KNXWEB_OTA_TIMEOUT_MAX);
+}
+
+const char *KnxOtaService::getStateName()
+{
+    static const char *const names[] = {"off", "waiting", "running", "done", "failed"};
+    return names[state];
+}
+
+int32_t KnxOtaService::getRemaining(unsigned long now)
+{
+    if (!active)
+    {
+        return 0;
+    }
+    int32_t remaining = (int32_t)timeout - (int32_t)((now - activityTime) / 1000);
+    return max(remaining, (int32_t)0);
+}
+
+void KnxOtaService::onActivity(knxOtaState_t newState)
+{
+    state = newState;
+    activitySeen = true;
+}
+
+void KnxOtaService::setCallbacks()
+{
+#if defined(ESP32) || defined(ESP8266)
+    if (callbacksSet)
+    {
+        return;
+    }
+    callbacksSet = true;
+    ArduinoOTA.onStart([this]()
+                       {
+        progress = 0;
+        error = "";
+        onActivity(KNX_OTA_RUNNING); });
+    ArduinoOTA.onEnd([this]()
+                     {
+        progress = 100;
+        onActivity(KNX_OTA_DONE);
+        if (resultCallback)
+        {
+            resultCallback(true);
+        } });
+    ArduinoOTA.onProgress([this](unsigned int done, unsigned int total)
+                          { progress = total != 0 ? (uint64_t)done * 100 / total : 0; });
+    ArduinoOTA.onError([this](ota_error_t otaError)
+                       {
+        switch (otaError)
+        {
+        case OTA_AUTH_ERROR:
+            error = "Auth failed";
+            break;
+        case OTA_BEGIN_ERROR:
+            error = "Begin failed";
+            break;
+        case OTA_CONNECT_ERROR:
+            error = "Connect failed";
+            break;
+        case OTA_RECEIVE_ERROR:
+            error = "Receive failed";
+            break;
+        case OTA_END_ERROR:
+            error = "End failed";
+            break;
+        default:
+            error = "Unknown error";
+            break;
+        }
+        onActivity(KNX_OTA_FAILED);
+        if (resultCallback)
+        {
+            resultCallback(false);
+        } });
+#endif
+}
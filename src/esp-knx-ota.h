@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+#if defined(ESP32) || defined(ESP8266)
+#include <ArduinoOTA.h>
+#endif
+
+// Seconds OTA stays enabled without update activity, changed at runtime with the otaTimeout command
+#ifndef KNXWEB_OTA_TIMEOUT
+#define KNXWEB_OTA_TIMEOUT (5 * 60)
+#endif
+#define KNXWEB_OTA_TIMEOUT_MIN 30
+#define KNXWEB_OTA_TIMEOUT_MAX (24 * 60 * 60)
+
+// ArduinoOTA poll interval in ms. Polling starts at the minimum when OTA is enabled or an
+// update was seen and doubles up to the maximum while nothing happens. The uploader waits
+// seconds for the answer to its invitation, so the slow polling only saves load.
+#ifndef KNXWEB_OTA_POLL_MIN
+#define KNXWEB_OTA_POLL_MIN 20
+#endif
+#ifndef KNXWEB_OTA_POLL_MAX
+#define KNXWEB_OTA_POLL_MAX 500
+#endif
+
+typedef enum __knxOtaState
+{
+    KNX_OTA_OFF = 0,
+    KNX_OTA_WAITING = 1,
+    KNX_OTA_RUNNING = 2,
+    KNX_OTA_DONE = 3,
+    KNX_OTA_FAILED = 4,
+} knxOtaState_t;
+
+// Runs ArduinoOTA for a limited time and keeps the state of the last update for the web API.
+// ArduinoOTA receives the whole image inside one handle() call, the progress is only
+// visible to requests served meanwhile, with KNXWEB_ASYNC.
+class KnxOtaService
+{
+public:
+    void start(unsigned long now);
+    void stop();
+    // Polls ArduinoOTA when due and switches OTA off after the timeout, returns true when it polled
+    bool loop(unsigned long now);
+
+    // Seconds, limited to KNXWEB_OTA_TIMEOUT_MIN to KNXWEB_OTA_TIMEOUT_MAX
+    void setTimeout(uint32_t seconds);
+    uint32_t getTimeout() { return timeout; }
+    bool isActive() { return active; }
+    knxOtaState_t getState() { return state; }
+    const char *getStateName();
+    uint8_t getProgress() { return progress; }
+    // Empty unless the last update failed
+    const char *getError() { return error; }
+    // Start of OTA or the last update activity, the timeout counts from here
+    unsigned long getActivityTime() { return activityTime; }
+    int32_t getRemaining(unsigned long now);
+    uint32_t getPollInterval() { return pollInterval; }
+    uint32_t getPolls() { return polls; }
+    // Called when an update ends, before ArduinoOTA restarts after a successful one
+    void setResultCallback(std::function<void(bool success)> callback) { resultCallback = callback; }
+
+private:
+    bool active = false;
+    bool callbacksSet = false;
+    volatile knxOtaState_t state = KNX_OTA_OFF;
+    volatile uint8_t progress = 0;
+    const char *error = "";
+    uint32_t timeout = KNXWEB_OTA_TIMEOUT;
+    unsigned long activityTime = 0;
+    unsigned long lastPoll = 0;
+    uint32_t pollInterval = KNXWEB_OTA_POLL_MIN;
+    uint32_t polls = 0;
+    bool activitySeen = false;
+    std::function<void(bool success)> resultCallback;
+
+    void setCallbacks();
+    void onActivity(knxOtaState_t newState);
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Marks the place of a value in a page template, the text between the markers is sent unchanged
+#define KNXPAGE_SLOT "\x01"
+
+typedef enum __knxPageValueType
+{
+    KNXPAGE_TEXT = 0,
+    KNXPAGE_TEXT_P = 1,
+    KNXPAGE_JSON_STRING = 2,
+} knxPageValueType_t;
+
+typedef struct __knxPageValue
+{
+    const char *text;
+    knxPageValueType_t type;
+} knxPageValue_t;
+
+// Positions of the slots in a template, computed by the compiler. Rendering copies the
+// fragments between the slots from flash and knows the response length before it starts.
+template <size_t N>
+struct KnxPageLayout
+{
+    // Template length without the markers
+    uint16_t length;
+    uint16_t slots[N];
+};
+
+// Halves the text to keep the constexpr recursion depth logarithmic, like knxWebHash()
+constexpr size_t knxPageCountSlots(const char *text, size_t length)
+{
+    return length == 0   ? 0
+           : length == 1 ? (text[0] == KNXPAGE_SLOT[0] ? 1 : 0)
+                         : knxPageCountSlots(text, length / 2) + knxPageCountSlots(text + length / 2, length - length / 2);
+}
+
+// Offset of slot n, a binary search for the largest prefix holding n slots
+constexpr uint16_t knxPageFindSlot(const char *text, size_t n, size_t low, size_t high)
+{
+    return low + 1 >= high ? low
+           : knxPageCountSlots(text, (low + high) / 2) > n ? knxPageFindSlot(text, n, low, (low + high) / 2)
+                                                           : knxPageFindSlot(text, n, (low + high) / 2, high);
+}
+
+template <size_t... I>
+struct KnxPageIndices
+{
+};
+template <size_t N, size_t... I>
+struct KnxPageMakeIndices : KnxPageMakeIndices<N - 1, N - 1, I...>
+{
+};
+template <size_t... I>
+struct KnxPageMakeIndices<0, I...>
+{
+    typedef KnxPageIndices<I...> type;
+};
+
+template <size_t N, size_t... I>
+constexpr KnxPageLayout<N> knxPageLayout(const char *text, size_t length, KnxPageIndices<I...>)
+{
+    return {(uint16_t)(length - N), {knxPageFindSlot(text, I, 0, length)...}};
+}
+
+// length is the size of the template without the terminating zero
+template <size_t N>
+constexpr KnxPageLayout<N> knxPageLayout(const char *text, size_t length)
+{
+    return knxPageLayout<N>(text, length, typename KnxPageMakeIndices<N>::type());
+}
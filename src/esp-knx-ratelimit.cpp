@@ -0,0 +1,67 @@
+#include "esp-knx-ratelimit.h"
+
+uint32_t KnxRateLimiter::admit(uint32_t ip, uint8_t cost, unsigned long now)
+{
+    if (!started)
+    {
+        started = true;
+        global.lastRefill = now;
+    }
+    Bucket &client = findClient(ip, now);
+    refill(client, now, KNXWEB_RATE_PER_SECOND, KNXWEB_RATE_BURST);
+    refill(global, now, KNXWEB_RATE_GLOBAL_PER_SECOND, KNXWEB_RATE_GLOBAL_BURST);
+
+    uint32_t needed = cost * 1000;
+    // Expensive requests have to leave the reserve to the cheap ones
+    uint32_t globalNeeded = needed + (cost > 1 ? KNXWEB_RATE_RESERVE * 1000 : 0);
+    uint32_t wait = 0;
+    if (client.tokens < needed)
+    {
+        wait = waitSeconds(client, needed, KNXWEB_RATE_PER_SECOND);
+    }
+    if (global.tokens < globalNeeded)
+    {
+        wait = max(wait, waitSeconds(global, globalNeeded, KNXWEB_RATE_GLOBAL_PER_SECOND));
+    }
+    if (wait != 0)
+    {
+        rejected++;
+        return wait;
+    }
+    client.tokens -= needed;
+    global.tokens -= needed;
+    return 0;
+}
+
+KnxRateLimiter::Bucket &KnxRateLimiter::findClient(uint32_t ip, unsigned long now)
+{
+    uint8_t oldest = 0;
+    for (uint8_t i = 0; i < clientCount; i++)
+    {
+        if (clients[i].ip == ip)
+        {
+            return clients[i];
+        }
+        if (now - clients[i].lastRefill > now - clients[oldest].lastRefill)
+        {
+            oldest = i;
+        }
+    }
+    uint8_t index = clientCount < KNXWEB_RATE_CLIENTS ? clientCount++ : oldest;
+    clients[index] = {ip, KNXWEB_RATE_BURST * 1000, now};
+    return clients[index];
+}
+
+void KnxRateLimiter::refill(Bucket &bucket, unsigned long now, uint32_t perSecond, uint32_t burst)
+{
+    // perSecond units per second are perSecond thousandths per ms
+    uint32_t elapsed = min(now - bucket.lastRefill, (unsigned long)burst * 1000);
+    bucket.tokens = min(bucket.tokens + elapsed * perSecond, burst * 1000);
+    bucket.lastRefill = now;
+}
+
+uint32_t KnxRateLimiter::waitSeconds(const Bucket &bucket, uint32_t needed, uint32_t perSecond)
+{
+    uint32_t waitMillis = (needed - bucket.tokens + perSecond - 1) / perSecond;
+    return max((uint32_t)1, (waitMillis + 999) / 1000);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Set to 0 to serve every request without admission control
+#ifndef KNXWEB_RATE_LIMIT
+#define KNXWEB_RATE_LIMIT 1
+#endif
+
+// Clients tracked at the same time, the one seen longest ago makes room for a new one
+#ifndef KNXWEB_RATE_CLIENTS
+#define KNXWEB_RATE_CLIENTS 8
+#endif
+// Cost units a client may use per second and at once. A request costs the cost of its
+// route, a page load with its status request and event stream about 8.
+#ifndef KNXWEB_RATE_PER_SECOND
+#define KNXWEB_RATE_PER_SECOND 10
+#endif
+#ifndef KNXWEB_RATE_BURST
+#define KNXWEB_RATE_BURST 20
+#endif
+// Cost units all clients together may use, the last KNXWEB_RATE_RESERVE of them are left
+// to requests of cost 1, so status polls still get through while pages are refused
+#ifndef KNXWEB_RATE_GLOBAL_PER_SECOND
+#define KNXWEB_RATE_GLOBAL_PER_SECOND 40
+#endif
+#ifndef KNXWEB_RATE_GLOBAL_BURST
+#define KNXWEB_RATE_GLOBAL_BURST 40
+#endif
+#ifndef KNXWEB_RATE_RESERVE
+#define KNXWEB_RATE_RESERVE 10
+#endif
+// Requests the async server works on at once, more are refused before they use buffers.
+// The synchronous server handles one request at a time and needs no such limit.
+#ifndef KNXWEB_RATE_IN_FLIGHT
+#define KNXWEB_RATE_IN_FLIGHT 4
+#endif
+
+// Token buckets per client IP and for the whole server. Buckets hold thousandths of a cost
+// unit so slow refill rates need no floating point.
+class KnxRateLimiter
+{
+public:
+    // Returns 0 when the request is admitted and charged, otherwise the seconds to wait
+    uint32_t admit(uint32_t ip, uint8_t cost, unsigned long now);
+
+    uint32_t getRejected() { return rejected; }
+
+private:
+    struct Bucket
+    {
+        uint32_t ip;
+        uint32_t tokens;
+        unsigned long lastRefill;
+    };
+    Bucket clients[KNXWEB_RATE_CLIENTS] = {};
+    uint8_t clientCount = 0;
+    Bucket global = {0, KNXWEB_RATE_GLOBAL_BURST * 1000, 0};
+    bool started = false;
+    uint32_t rejected = 0;
+
+    Bucket &findClient(uint32_t ip, unsigned long now);
+    static void refill(Bucket &bucket, unsigned long now, uint32_t perSecond, uint32_t burst);
+    static uint32_t waitSeconds(const Bucket &bucket, uint32_t needed, uint32_t perSecond);
+};
@@ -0,0 +1,107 @@
+#include "esp-knx-settings.h"
+
+#if KNXWEB_SETTINGS
+#include <LittleFS.h>
+#endif
+
+bool knxWebMountFileSystem()
+{
+    static bool mounted = false;
+#if KNXWEB_SETTINGS
+    static bool mountTried = false;
+    if (!mountTried)
+    {
+        mountTried = true;
+#if defined(ESP32)
+        // Returns right away when it is mounted already
+        mounted = LittleFS.begin(false);
+#else
+        // Uses the configuration of the sketch, see the README on formatting
+        mounted = LittleFS.begin();
+#endif
+    }
+#endif
+    return mounted;
+}
+
+bool KnxSettings::load(knxWebSettings_t &settings)
+{
+#if KNXWEB_SETTINGS
+    if (!knxWebMountFileSystem())
+    {
+        return false;
+    }
+    // Only the new file is left when save() was interrupted before the rename
+    const char *path = LittleFS.exists(KNXWEB_SETTINGS_FILE) ? KNXWEB_SETTINGS_FILE : KNXWEB_SETTINGS_FILE ".new";
+    if (!LittleFS.exists(path))
+    {
+        return false;
+    }
+    File file = LittleFS.open(path, "r");
+    if (!file)
+    {
+        return false;
+    }
+    char text[128];
+    size_t length = file.read((uint8_t *)text, sizeof(text) - 1);
+    file.close();
+    text[length] = 0;
+
+    // Unknown keys are skipped, they come from a newer firmware
+    char *line = text;
+    while (*line != 0)
+    {
+        char *end = strchr(line, '\n');
+        if (end != nullptr)
+        {
+            *end = 0;
+        }
+        char *value = strchr(line, '=');
+        if (value != nullptr)
+        {
+            *value++ = 0;
+            if (strcmp(line, "otaTimeout") == 0)
+            {
+                settings.otaTimeout = strtoul(value, nullptr, 10);
+            }
+        }
+        if (end == nullptr)
+        {
+            break;
+        }
+        line = end + 1;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool KnxSettings::save(const knxWebSettings_t &settings)
+{
+#if KNXWEB_SETTINGS
+    if (!knxWebMountFileSystem())
+    {
+        return false;
+    }
+    char text[128];
+    int length = snprintf(text, sizeof(text), "otaTimeout=%lu\n", (unsigned long)settings.otaTimeout);
+    // Written next to the old file and renamed, a power loss keeps one of both
+    File file = LittleFS.open(KNXWEB_SETTINGS_FILE ".new", "w");
+    if (!file)
+    {
+        return false;
+    }
+    bool ok = file.write((const uint8_t *)text, length) == (size_t)length;
+    file.close();
+    if (!ok)
+    {
+        LittleFS.remove(KNXWEB_SETTINGS_FILE ".new");
+        return false;
+    }
+    LittleFS.remove(KNXWEB_SETTINGS_FILE);
+    return LittleFS.rename(KNXWEB_SETTINGS_FILE ".new", KNXWEB_SETTINGS_FILE);
+#else
+    return false;
+#endif
+}
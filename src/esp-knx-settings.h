@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Set to 1 to keep the settings changed at runtime and the history in LittleFS. The files
+// are /knxweb.cfg, /knxweb.log and /knxweb.old. Only on ESP32 and ESP8266.
+#ifndef KNXWEB_SETTINGS
+#define KNXWEB_SETTINGS 0
+#endif
+#if KNXWEB_SETTINGS && !defined(ESP32) && !defined(ESP8266)
+#error "KNXWEB_SETTINGS needs ESP32 or ESP8266"
+#endif
+
+#define KNXWEB_SETTINGS_FILE "/knxweb.cfg"
+
+typedef struct __knxWebSettings
+{
+    uint32_t otaTimeout;
+} knxWebSettings_t;
+
+// Mounts LittleFS once for the settings and the history, returns false without a usable file
+// system. A file system the sketch mounted before stays as it is, with its configuration.
+bool knxWebMountFileSystem();
+
+// Settings changed at runtime, kept as key=value lines in LittleFS. The file system is
+// mounted but never formatted, without a usable file system the defaults stay.
+class KnxSettings
+{
+public:
+    // Overwrites the fields of settings found in the file
+    bool load(knxWebSettings_t &settings);
+    bool save(const knxWebSettings_t &settings);
+    bool isMounted() { return knxWebMountFileSystem(); }
+};
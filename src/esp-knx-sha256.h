@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define KNXWEB_SHA256_SIZE 32
+
+// Incremental SHA-256 (FIPS 180-4), used to check uploaded firmware images
+class KnxSha256
+{
+public:
+    void begin();
+    void update(const uint8_t *data, size_t length);
+    void finish(uint8_t digest[KNXWEB_SHA256_SIZE]);
+
+private:
+    uint32_t state[8];
+    uint8_t block[64];
+    size_t blockLength;
+    uint64_t totalLength;
+
+    void transform(const uint8_t *data);
+};
@@ -0,0 +1,130 @@
+#include "esp-knx-sysinfo.h"
+
+#if defined(ESP32) || defined(LIBRETINY)
+#include <WiFi.h>
+#elif defined(ESP8266)
+#include <ESP8266WiFi.h>
+#endif
+
+void KnxSystemInfo::begin()
+{
+#if defined(ESP32)
+    flashSize = spi_flash_get_chip_size();
+    psramSize = ESP.getPsramSize();
+    heapSize = ESP.getHeapSize();
+#else
+    flashSize = ESP.getFlashChipRealSize();
+#endif
+    cpuFreqMHz = ESP.getCpuFreqMHz();
+    WiFi.macAddress(mac);
+    sdkVersion = ESP.getSdkVersion();
+#if defined(ESP32)
+    resetCode = esp_reset_reason();
+    resetReason = getResetName(resetCode);
+#elif defined(ESP8266)
+    resetCode = ESP.getResetInfoPtr()->reason;
+    resetReason = ESP.getResetInfo();
+#else
+    resetReason = ESP.getResetInfo();
+#endif
+    // The page has values to show right away
+    sample();
+}
+
+const char *KnxSystemInfo::getResetName(uint8_t code)
+{
+#if defined(ESP32)
+    static const char *const names[] = {"unknown", "power on", "external", "software", "panic", "interrupt watchdog",
+                                        "task watchdog", "watchdog", "deep sleep", "brownout", "sdio"};
+#elif defined(ESP8266)
+    static const char *const names[] = {"power on", "hardware watchdog", "exception", "software watchdog", "software",
+                                        "deep sleep", "external"};
+#else
+    static const char *const names[] = {"unknown"};
+#endif
+    return code < sizeof(names) / sizeof(names[0]) ? names[code] : "unknown";
+}
+
+void KnxSystemInfo::loop()
+{
+    if (millis() - lastSample >= KNXWEB_SYSINFO_INTERVAL)
+    {
+        sample();
+    }
+}
+
+void KnxSystemInfo::sample()
+{
+    lastSample = millis();
+    uint32_t heap = ESP.getFreeHeap();
+    if (heap < minFreeHeap)
+    {
+        minFreeHeap = heap;
+    }
+    heapSamples[sampleIndex] = heap;
+    rssiSamples[sampleIndex] = WiFi.RSSI();
+#if defined(ESP32)
+    freePsram = ESP.getFreePsram();
+    temperatureSamples[sampleIndex] = temperatureRead() * 10;
+#endif
+    sampleIndex = (sampleIndex + 1) % KNXWEB_SYSINFO_SAMPLES;
+    if (sampleCount < KNXWEB_SYSINFO_SAMPLES)
+    {
+        sampleCount++;
+    }
+}
+
+uint32_t KnxSystemInfo::getMinFreeHeap()
+{
+#if defined(ESP32)
+    // Tracked by the heap allocator itself, this also catches short peaks between samples
+    return ESP.getMinFreeHeap();
+#else
+    return minFreeHeap;
+#endif
+}
+
+template <typename T>
+static knxSysInfoRange_t rangeOf(const T *samples, uint8_t count)
+{
+    knxSysInfoRange_t range = {0, 0, 0};
+    if (count == 0)
+    {
+        return range;
+    }
+    int64_t sum = 0;
+    range.min = INT32_MAX;
+    range.max = INT32_MIN;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        int32_t value = samples[i];
+        sum += value;
+        if (value < range.min)
+        {
+            range.min = value;
+        }
+        if (value > range.max)
+        {
+            range.max = value;
+        }
+    }
+    range.avg = sum / count;
+    return range;
+}
+
+knxSysInfoRange_t KnxSystemInfo::getHeapRange()
+{
+    return rangeOf(heapSamples, sampleCount);
+}
+
+knxSysInfoRange_t KnxSystemInfo::getRssiRange()
+{
+    return rangeOf(rssiSamples, sampleCount);
+}
+
+#if defined(ESP32)
+knxSysInfoRange_t KnxSystemInfo::getTemperatureRange()
+{
+    return rangeOf(temperatureSamples, sampleCount);
+}
+#endif
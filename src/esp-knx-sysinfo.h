@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Free heap, RSSI and temperature are sampled every KNXWEB_SYSINFO_INTERVAL ms,
+// the last KNXWEB_SYSINFO_SAMPLES samples are kept
+#ifndef KNXWEB_SYSINFO_INTERVAL
+#define KNXWEB_SYSINFO_INTERVAL 2000
+#endif
+#ifndef KNXWEB_SYSINFO_SAMPLES
+#define KNXWEB_SYSINFO_SAMPLES 30
+#endif
+
+typedef struct __knxSysInfoRange
+{
+    int32_t min;
+    int32_t avg;
+    int32_t max;
+} knxSysInfoRange_t;
+
+// Hardware and system values for the status page. Values that can't change while running
+// are read once by begin(), the others are sampled by loop(), so a page view never waits
+// for the hardware. Only loop() writes, a reader on the AsyncTCP task may see a sample
+// that is being replaced, which is fine for a status page.
+class KnxSystemInfo
+{
+public:
+    void begin();
+    void loop();
+
+    uint32_t getFlashSize() { return flashSize; }
+    uint32_t getCpuFreqMHz() { return cpuFreqMHz; }
+    const uint8_t *getMac() { return mac; }
+    const String &getSdkVersion() { return sdkVersion; }
+    const String &getResetReason() { return resetReason; }
+    // esp_reset_reason() on ESP32, rst_info.reason on ESP8266, 0 when unknown
+    uint8_t getResetCode() { return resetCode; }
+    static const char *getResetName(uint8_t code);
+#if defined(ESP32)
+    uint32_t getPsramSize() { return psramSize; }
+    uint32_t getHeapSize() { return heapSize; }
+    uint32_t getFreePsram() { return freePsram; }
+    // Tenths of a degree Celsius
+    int16_t getTemperature() { return temperatureSamples[lastIndex()]; }
+    knxSysInfoRange_t getTemperatureRange();
+#endif
+
+    // Latest sample
+    uint32_t getFreeHeap() { return heapSamples[lastIndex()]; }
+    int8_t getRssi() { return rssiSamples[lastIndex()]; }
+    uint32_t getMinFreeHeap();
+    knxSysInfoRange_t getHeapRange();
+    knxSysInfoRange_t getRssiRange();
+
+private:
+    uint32_t flashSize = 0;
+    uint32_t cpuFreqMHz = 0;
+    uint8_t mac[6] = {};
+    String sdkVersion;
+    String resetReason;
+    uint8_t resetCode = 0;
+#if defined(ESP32)
+    uint32_t psramSize = 0;
+    uint32_t heapSize = 0;
+    uint32_t freePsram = 0;
+    int16_t temperatureSamples[KNXWEB_SYSINFO_SAMPLES] = {};
+#endif
+    uint32_t heapSamples[KNXWEB_SYSINFO_SAMPLES] = {};
+    int8_t rssiSamples[KNXWEB_SYSINFO_SAMPLES] = {};
+    uint32_t minFreeHeap = UINT32_MAX;
+    unsigned long lastSample = 0;
+    uint8_t sampleCount = 0;
+    uint8_t sampleIndex = 0;
+
+    uint8_t lastIndex() { return (sampleIndex + KNXWEB_SYSINFO_SAMPLES - 1) % KNXWEB_SYSINFO_SAMPLES; }
+    void sample();
+};
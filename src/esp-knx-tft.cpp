@@ -0,0 +1,152 @@
+#include "esp-knx-tft.h"
+
+void KnxTftRelay::setSink(callbackTftUploadBegin *begin, callbackTftUploadWrite *write, callbackTftUploadEnd *end)
+{
+    beginFctn = begin;
+    writeFctn = write;
+    endFctn = end;
+}
+
+bool KnxTftRelay::begin(size_t size)
+{
+    // drain() releases the buffer when it is done with the previous image
+    if (buffer != nullptr)
+    {
+        return false;
+    }
+    total = size;
+    received = 0;
+    written = 0;
+    error = "";
+    startTime = millis();
+    endTime = 0;
+    lastProgress = startTime;
+    inputDone = false;
+    buffer = (uint8_t *)malloc(KNXWEB_TFT_BUFFER);
+    state = UPLOAD_RUNNING;
+    if (buffer == nullptr)
+    {
+        abort("Out of memory");
+    }
+    return true;
+}
+
+size_t KnxTftRelay::push(const uint8_t *data, size_t length)
+{
+    if (state != UPLOAD_RUNNING || inputDone)
+    {
+        return 0;
+    }
+    length = min(length, KNXWEB_TFT_BUFFER - (received - written));
+    size_t offset = received % KNXWEB_TFT_BUFFER;
+    size_t first = min(length, KNXWEB_TFT_BUFFER - offset);
+    memcpy(buffer + offset, data, first);
+    memcpy(buffer, data + first, length - first);
+    // Published after the copy, drain() never reads beyond received
+    received += length;
+    return length;
+}
+
+void KnxTftRelay::abort(const char *message)
+{
+    if (state == UPLOAD_RUNNING)
+    {
+        error = message;
+        endTime = millis();
+        state = UPLOAD_FAILED;
+    }
+}
+
+size_t KnxTftRelay::drain(unsigned long now)
+{
+    if (buffer == nullptr)
+    {
+        return 0;
+    }
+    if (state == UPLOAD_RUNNING && !sinkOpen)
+    {
+        sinkOpen = true;
+        lastProgress = now;
+        if (beginFctn != nullptr && !beginFctn(total))
+        {
+            abort("Refused by display");
+        }
+    }
+    size_t drained = 0;
+    while (state == UPLOAD_RUNNING && drained < KNXWEB_TFT_CHUNK && received != written)
+    {
+        size_t offset = written % KNXWEB_TFT_BUFFER;
+        size_t length = min(received - written, KNXWEB_TFT_BUFFER - offset);
+        length = min(length, KNXWEB_TFT_CHUNK - written % KNXWEB_TFT_CHUNK);
+        size_t taken = min(writeFctn(buffer + offset, length), length);
+        if (taken == 0)
+        {
+            break;
+        }
+        written += taken;
+        drained += taken;
+        lastProgress = now;
+    }
+    if (state == UPLOAD_RUNNING && inputDone && received == written)
+    {
+        state = UPLOAD_DONE;
+        endTime = now;
+    }
+    else if (state == UPLOAD_RUNNING && received != written && now - lastProgress > KNXWEB_TFT_TIMEOUT)
+    {
+        abort("Display timeout");
+    }
+    if (state != UPLOAD_RUNNING && sinkOpen)
+    {
+        closeSink(state == UPLOAD_DONE);
+    }
+    // The upload side may still push until it finishes, even to a failed relay
+    if (state != UPLOAD_RUNNING && inputDone)
+    {
+        free(buffer);
+        buffer = nullptr;
+    }
+    return drained;
+}
+
+void KnxTftRelay::closeSink(bool success)
+{
+    sinkOpen = false;
+    if (endFctn != nullptr)
+    {
+        endFctn(success);
+    }
+}
+
+uint8_t KnxTftRelay::getProgress()
+{
+    if (state == UPLOAD_DONE)
+    {
+        return 100;
+    }
+    if (total == 0)
+    {
+        return 0;
+    }
+    return min((size_t)100, 100 * written / total);
+}
+
+uint32_t KnxTftRelay::getBytesPerSecond()
+{
+    unsigned long elapsed = (endTime != 0 ? endTime : millis()) - startTime;
+    if (state == UPLOAD_IDLE || elapsed == 0)
+    {
+        return 0;
+    }
+    return (uint64_t)written * 1000 / elapsed;
+}
+
+uint32_t KnxTftRelay::getEtaSeconds()
+{
+    uint32_t rate = getBytesPerSecond();
+    if (state != UPLOAD_RUNNING || rate == 0 || total <= written)
+    {
+        return 0;
+    }
+    return (total - written) / rate;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp-knx-upload.h"
+
+// Bytes of the image held between the HTTP receive and the display. With KNXWEB_ASYNC the
+// buffer has to take a full TCP window, see KnxWebTransport::holdUpload().
+#ifndef KNXWEB_TFT_BUFFER
+#define KNXWEB_TFT_BUFFER 8192
+#endif
+// Largest piece passed to the sink, pieces never cross a multiple of it in the image
+#ifndef KNXWEB_TFT_CHUNK
+#define KNXWEB_TFT_CHUNK 4096
+#endif
+// ms the sink may take nothing while data is waiting before the relay fails. The
+// synchronous server waits this long inside loop(), it stays well below the task watchdog.
+//
+// Without KNXWEB_ASYNC the server reads the whole image within one loop() call, so the
+// sketch's loop() waits for the network and the display for the whole upload. The handler
+// runs the loop of the library meanwhile and calls the callback registered with
+// KnxWebserver::registerIdleCallback(), where the sketch keeps its KNX stack running.
+// KNXWEB_ASYNC avoids the wait altogether.
+#ifndef KNXWEB_TFT_TIMEOUT
+#define KNXWEB_TFT_TIMEOUT 2000
+#endif
+
+// Display firmware sink. begin gets the image size, 0 when unknown, and returns false to
+// refuse it. write returns the bytes it took, 0 while the display is busy, and must not
+// block. end tells whether the whole image was passed on. All are called from loop().
+typedef bool callbackTftUploadBegin(size_t size);
+typedef size_t callbackTftUploadWrite(const uint8_t *data, size_t length);
+typedef void callbackTftUploadEnd(bool success);
+
+// Passes an uploaded display image to the sink through a ring buffer of KNXWEB_TFT_BUFFER
+// bytes, allocated only while a relay runs. The upload side calls push() and finish(),
+// loop() calls drain(). Each side writes only its own counter, so with KNXWEB_ASYNC both
+// may run in different tasks.
+class KnxTftRelay
+{
+public:
+    void setSink(callbackTftUploadBegin *begin, callbackTftUploadWrite *write, callbackTftUploadEnd *end);
+    bool hasSink() { return writeFctn != nullptr; }
+
+    // Returns false while the previous image is still drained, other failures show in getState()
+    bool begin(size_t size);
+    // Copies what fits into the buffer, returns the bytes taken
+    size_t push(const uint8_t *data, size_t length);
+    // No more data follows, also after abort()
+    void finish() { inputDone = true; }
+    void abort(const char *message);
+    // Passes buffered data to the sink, at most KNXWEB_TFT_CHUNK bytes per call, and
+    // returns the bytes it took. Fails the relay when the sink stalls.
+    size_t drain(unsigned long now);
+    // Done or failed and nothing left to call the sink for
+    bool isFinished() { return inputDone && state != UPLOAD_RUNNING && !sinkOpen; }
+
+    uploadState_t getState() { return state; }
+    const char *getError() { return error; }
+    size_t getReceived() { return received; }
+    size_t getTotal() { return total; }
+    // Bytes the sink took
+    size_t getWritten() { return written; }
+    size_t getBuffered() { return received - written; }
+    uint8_t getProgress();
+    uint32_t getBytesPerSecond();
+    uint32_t getEtaSeconds();
+
+private:
+    callbackTftUploadBegin *beginFctn = nullptr;
+    callbackTftUploadWrite *writeFctn = nullptr;
+    callbackTftUploadEnd *endFctn = nullptr;
+    uint8_t *buffer = nullptr;
+    volatile uploadState_t state = UPLOAD_IDLE;
+    const char *error = "";
+    size_t total = 0;
+    volatile size_t received = 0;
+    volatile size_t written = 0;
+    volatile bool inputDone = true;
+    bool sinkOpen = false;
+    unsigned long startTime = 0;
+    unsigned long endTime = 0;
+    unsigned long lastProgress = 0;
+
+    void closeSink(bool success);
+};
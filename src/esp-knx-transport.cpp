@@ -0,0 +1,712 @@
+#include "esp-knx-transport.h"
+#include "esp-knx-webserver.h"
+
+#if KNXWEB_NATIVE
+
+// Implemented by test/mock/KnxMockHttp.cpp
+
+#elif KNXWEB_ASYNC
+
+// AsyncWebHandler got const members with version 3, which also collects all headers by default
+#if defined(ASYNCWEBSERVER_VERSION_MAJOR) && ASYNCWEBSERVER_VERSION_MAJOR >= 3
+#define KNXWEB_ASYNC_CONST const
+#else
+#define KNXWEB_ASYNC_CONST
+#endif
+
+static uint8_t methodFlag(WebRequestMethodComposite method)
+{
+    return method == HTTP_GET ? KNXWEB_HTTP_GET : method == HTTP_POST ? KNXWEB_HTTP_POST
+                                                                      : KNXWEB_HTTP_OTHER;
+}
+
+// Single handler for all routes of KnxWebserver, see the synchronous variant below
+class KnxRouteHandler : public AsyncWebHandler
+{
+public:
+    KnxRouteHandler(KnxWebserver &webserver, KnxWebTransport &transport) : webserver(webserver), transport(transport) {}
+
+    bool canHandle(AsyncWebServerRequest *request) KNXWEB_ASYNC_CONST override
+    {
+        uint8_t method = methodFlag(request->method());
+        if (webserver.findRoute(method, request->url()) == nullptr && webserver.findStaticAsset(method, request->url()) == nullptr)
+        {
+            return false;
+        }
+#if !defined(ASYNCWEBSERVER_VERSION_MAJOR) || ASYNCWEBSERVER_VERSION_MAJOR < 3
+        request->addInterestingHeader("If-None-Match");
+        request->addInterestingHeader("Accept-Encoding");
+        request->addInterestingHeader("Cookie");
+#endif
+        // In flight until the connection closes, the async server closes it after the response.
+        // The request is deleted only after the callback, two captured pointers need no heap.
+        if (++transport.requestsInFlight > transport.maxRequestsInFlight)
+        {
+            transport.maxRequestsInFlight = transport.requestsInFlight;
+        }
+        request->onDisconnect([this, request]()
+                              {
+            transport.requestsInFlight--;
+            // A client that goes away before the last part aborts the upload
+            if (transport.uploadRequest != request)
+            {
+                return;
+            }
+            transport.setUploadRequest(nullptr);
+            transport.currentUpload.status = KNXWEB_UPLOAD_ABORTED;
+            webserver.dispatchUpload(request->url()); });
+        return true;
+    }
+
+    void handleRequest(AsyncWebServerRequest *request) override
+    {
+        // The async server closes every connection after the response
+        transport.countRequest();
+        transport.setRequest(request);
+        webserver.dispatch(methodFlag(request->method()), request->url());
+        transport.setRequest(nullptr);
+    }
+
+    void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) override
+    {
+        // One call may start, continue and finish the upload, it is split into the steps of the synchronous server
+        knxWebUpload_t &upload = transport.currentUpload;
+        transport.setRequest(request);
+        if (index == 0)
+        {
+            transport.setUploadRequest(request);
+            transport.uploadHeld = false;
+            upload.status = KNXWEB_UPLOAD_START;
+            upload.filename = filename;
+            upload.data = nullptr;
+            upload.length = 0;
+            upload.totalSize = 0;
+            webserver.dispatchUpload(request->url());
+        }
+        if (len > 0)
+        {
+            upload.status = KNXWEB_UPLOAD_WRITE;
+            upload.data = data;
+            upload.length = len;
+            upload.totalSize = index + len;
+            webserver.dispatchUpload(request->url());
+        }
+        if (final)
+        {
+            // The upload is complete, held data needs no more flow control
+            if (transport.uploadHeld)
+            {
+                transport.releaseUpload(SIZE_MAX);
+                transport.uploadHeld = false;
+            }
+            transport.setUploadRequest(nullptr);
+            upload.status = KNXWEB_UPLOAD_END;
+            upload.data = nullptr;
+            upload.length = 0;
+            webserver.dispatchUpload(request->url());
+        }
+        transport.setRequest(nullptr);
+    }
+
+    void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override
+    {
+        transport.appendBody(request, data, len, index, total);
+    }
+
+    bool isRequestHandlerTrivial() KNXWEB_ASYNC_CONST override
+    {
+        // Uploads need the request body
+        return false;
+    }
+
+private:
+    KnxWebserver &webserver;
+    KnxWebTransport &transport;
+};
+
+void KnxWebTransport::begin(KnxWebserver *webserver, KnxArena *arena, uint16_t port)
+{
+    this->arena = arena;
+#if defined(ESP32)
+    uploadLock = xSemaphoreCreateMutex();
+#endif
+    server = new AsyncWebServer(port);
+    // Not added to the server, KnxWebserver checks the login and hands over the request
+    events = new AsyncEventSource("/events");
+    server->addHandler(new KnxRouteHandler(*webserver, *this));
+    server->onNotFound([this, webserver](AsyncWebServerRequest *request)
+                       {
+        countRequest();
+        setRequest(request);
+        webserver->handleNotFound();
+        setRequest(nullptr); });
+    server->begin();
+}
+
+void KnxWebTransport::loop()
+{
+    // Requests are served by the AsyncTCP task
+}
+
+void KnxWebTransport::setRequest(AsyncWebServerRequest *newRequest)
+{
+    request = newRequest;
+    headerCount = 0;
+}
+
+// Headers and arguments are owned by the request, no copy needed
+const char *KnxWebTransport::header(const char *name)
+{
+    const AsyncWebHeader *header = request->getHeader(name);
+    return header != nullptr ? header->value().c_str() : "";
+}
+
+bool KnxWebTransport::hasArg(const char *name)
+{
+    return request->hasArg(name);
+}
+
+const char *KnxWebTransport::arg(const char *name)
+{
+    return request->arg(name).c_str();
+}
+
+bool KnxWebTransport::authenticate(const char *username, const char *password)
+{
+    return request->authenticate(username, password);
+}
+
+uint32_t KnxWebTransport::remoteIP()
+{
+    return request->client()->remoteIP();
+}
+
+void KnxWebTransport::appendBody(AsyncWebServerRequest *bodyOf, const uint8_t *data, size_t length, size_t index, size_t total)
+{
+    if (index == 0)
+    {
+        bodyRequest = bodyOf;
+        bodyLength = total < sizeof(bodyBuffer) ? 0 : sizeof(bodyBuffer);
+    }
+    if (bodyRequest != bodyOf || bodyLength == sizeof(bodyBuffer))
+    {
+        return;
+    }
+    if (index + length >= sizeof(bodyBuffer))
+    {
+        bodyLength = sizeof(bodyBuffer);
+        return;
+    }
+    memcpy(bodyBuffer + index, data, length);
+    bodyLength = index + length;
+}
+
+const char *KnxWebTransport::body(size_t &length)
+{
+    length = 0;
+    if (bodyRequest != request)
+    {
+        return "";
+    }
+    if (bodyLength == sizeof(bodyBuffer))
+    {
+        return nullptr;
+    }
+    bodyBuffer[bodyLength] = 0;
+    length = bodyLength;
+    return bodyBuffer;
+}
+
+void KnxWebTransport::sendHeader(const char *name, const char *value)
+{
+    // The value may be a buffer of the handler that is gone when the response is created
+    char *copy = arena->copy(value, strlen(value));
+    if (headerCount < MAX_HEADERS && copy != nullptr)
+    {
+        headerNames[headerCount] = name;
+        headerValues[headerCount] = copy;
+        headerCount++;
+    }
+}
+
+void KnxWebTransport::addHeaders(AsyncWebServerResponse *response)
+{
+    for (size_t i = 0; i < headerCount; i++)
+    {
+        response->addHeader(headerNames[i], headerValues[i]);
+    }
+    headerCount = 0;
+}
+
+void KnxWebTransport::send(int code, const char *contentType, const char *content)
+{
+    bytesSent += strlen(content);
+    AsyncWebServerResponse *response = request->beginResponse(code, contentType != nullptr ? contentType : "", content);
+    addHeaders(response);
+    request->send(response);
+}
+
+void KnxWebTransport::send_P(int code, const char *contentType, PGM_P content, size_t length)
+{
+    bytesSent += length;
+    AsyncWebServerResponse *response = request->beginResponse_P(code, contentType, (const uint8_t *)content, length);
+    addHeaders(response);
+    request->send(response);
+}
+
+void KnxWebTransport::requestAuthentication()
+{
+    AsyncWebServerResponse *response = request->beginResponse(401);
+    response->addHeader("WWW-Authenticate", "Basic realm=\"Login Required\"");
+    addHeaders(response);
+    request->send(response);
+}
+
+void KnxWebTransport::beginChunked(int code, const char *contentType)
+{
+    // The stream collects the whole response and sends it when the handler is done
+    stream = request->beginResponseStream(contentType);
+    stream->setCode(code);
+    addHeaders(stream);
+}
+
+void KnxWebTransport::sendChunk(const char *data, size_t length)
+{
+    bytesSent += length;
+    stream->write((const uint8_t *)data, length);
+}
+
+void KnxWebTransport::endChunked()
+{
+    request->send(stream);
+    stream = nullptr;
+}
+
+void KnxWebTransport::beginResponse(int code, const char *contentType, size_t length)
+{
+    // The stream sets the length itself when it is sent
+    beginChunked(code, contentType);
+}
+
+void KnxWebTransport::endResponse()
+{
+    endChunked();
+}
+
+void KnxWebTransport::closeConnection()
+{
+    sendHeader("Connection", "close");
+}
+
+void KnxWebTransport::holdUpload()
+{
+    // Runs in the AsyncTCP task like every change of uploadRequest
+    if (uploadRequest != nullptr)
+    {
+        uploadRequest->client()->ackLater();
+        uploadHeld = true;
+    }
+}
+
+void KnxWebTransport::releaseUpload(size_t length)
+{
+    // AsyncTCP acknowledges at most the held bytes
+#if defined(ESP32)
+    // Called from loop(), the lock keeps the AsyncTCP task from ending the request meanwhile
+    xSemaphoreTake(uploadLock, portMAX_DELAY);
+#endif
+    if (uploadRequest != nullptr)
+    {
+        uploadRequest->client()->ack(length);
+    }
+#if defined(ESP32)
+    xSemaphoreGive(uploadLock);
+#endif
+}
+
+void KnxWebTransport::setUploadRequest(AsyncWebServerRequest *uploadOf)
+{
+#if defined(ESP32)
+    xSemaphoreTake(uploadLock, portMAX_DELAY);
+#endif
+    uploadRequest = uploadOf;
+#if defined(ESP32)
+    xSemaphoreGive(uploadLock);
+#endif
+}
+
+void KnxWebTransport::beginEventStream()
+{
+    // The event source takes the connection and deletes the request without its disconnect callback
+    requestsInFlight--;
+    events->handleRequest(request);
+}
+
+size_t KnxWebTransport::eventClientCount()
+{
+    return events->count();
+}
+
+void KnxWebTransport::sendEvent(const char *event, const char *data)
+{
+    bytesSent += strlen(data);
+    events->send(data, event);
+}
+
+#else
+
+static uint8_t methodFlag(HTTPMethod method)
+{
+    return method == HTTP_GET ? KNXWEB_HTTP_GET : method == HTTP_POST ? KNXWEB_HTTP_POST
+                                                                      : KNXWEB_HTTP_OTHER;
+}
+
+// Comment line sent to idle event streams, finds connections the browser has closed
+#define EVENT_KEEPALIVE_INTERVAL 15000
+
+// keepAlive() came with ESP8266 core 3. The ESP32 and LibreTiny WebServer hard-code
+// Connection: close in every response, see README.md.
+// The core bounds the idle time of a kept connection with HTTP_MAX_CLOSE_WAIT and drops
+// it early when another client connects.
+#if defined(ESP8266)
+#include <core_version.h>
+#endif
+#if defined(ESP8266) && defined(ARDUINO_ESP8266_MAJOR) && ARDUINO_ESP8266_MAJOR >= 3
+#define KNXWEB_KEEPALIVE 1
+#else
+#define KNXWEB_KEEPALIVE 0
+#endif
+
+#if defined(ESP8266) || (defined(ESP32) && ESP_ARDUINO_VERSION_MAJOR >= 3)
+#define KNXWEB_URI_ARG const String &
+#else
+#define KNXWEB_URI_ARG String
+#endif
+
+// Single request handler for all routes of KnxWebserver. Replaces one std::function per
+// route and the linear walk over the handler list with a binary search in the route tables.
+class KnxRouteHandler : public RequestHandler
+{
+public:
+    KnxRouteHandler(KnxWebserver &webserver, KnxWebTransport &transport) : webserver(webserver), transport(transport) {}
+
+    bool canHandle(HTTPMethod method, KNXWEB_URI_ARG uri) override
+    {
+        return webserver.findRoute(methodFlag(method), uri) != nullptr || webserver.findStaticAsset(methodFlag(method), uri) != nullptr;
+    }
+
+    bool canUpload(KNXWEB_URI_ARG uri) override
+    {
+        const KnxWebserver::Route *route = webserver.findRoute(KNXWEB_HTTP_POST, uri);
+        return route != nullptr && route->uploadHandler != nullptr;
+    }
+
+#if defined(ESP8266)
+    bool handle(ESP8266WebServer &server, HTTPMethod requestMethod, KNXWEB_URI_ARG requestUri) override
+#else
+    bool handle(WebServer &server, HTTPMethod requestMethod, KNXWEB_URI_ARG requestUri) override
+#endif
+    {
+        transport.countRequest();
+        webserver.dispatch(methodFlag(requestMethod), requestUri);
+        return true;
+    }
+
+#if defined(ESP8266)
+    void upload(ESP8266WebServer &server, KNXWEB_URI_ARG requestUri, HTTPUpload &upload) override
+#else
+    void upload(WebServer &server, KNXWEB_URI_ARG requestUri, HTTPUpload &upload) override
+#endif
+    {
+        knxWebUpload_t &current = transport.currentUpload;
+        switch (upload.status)
+        {
+        case UPLOAD_FILE_START:
+            current.status = KNXWEB_UPLOAD_START;
+            current.filename = upload.filename;
+            break;
+        case UPLOAD_FILE_WRITE:
+            current.status = KNXWEB_UPLOAD_WRITE;
+            break;
+        case UPLOAD_FILE_END:
+            current.status = KNXWEB_UPLOAD_END;
+            break;
+        default:
+            current.status = KNXWEB_UPLOAD_ABORTED;
+            break;
+        }
+        current.data = upload.buf;
+        current.length = upload.currentSize;
+        current.totalSize = upload.totalSize;
+        webserver.dispatchUpload(requestUri);
+    }
+
+private:
+    KnxWebserver &webserver;
+    KnxWebTransport &transport;
+};
+
+void KnxWebTransport::begin(KnxWebserver *webserver, KnxArena *arena, uint16_t port)
+{
+    this->arena = arena;
+#if defined(ESP32) || defined(LIBRETINY)
+    server = new WebServer(port);
+#elif defined(ESP8266)
+    server = new ESP8266WebServer(port);
+#endif
+    const char *headerKeys[] = {"If-None-Match", "Accept-Encoding", "Cookie"};
+    server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+    server->addHandler(new KnxRouteHandler(*webserver, *this));
+    server->onNotFound([this, webserver]()
+                       {
+        countRequest();
+        webserver->handleNotFound(); });
+#if KNXWEB_KEEPALIVE
+    server->keepAlive(true);
+#endif
+    server->begin();
+}
+
+void KnxWebTransport::loop()
+{
+    server->handleClient();
+    if (millis() - lastKeepAlive >= EVENT_KEEPALIVE_INTERVAL)
+    {
+        lastKeepAlive = millis();
+        for (WiFiClient &client : eventClients)
+        {
+            writeEvent(client, ":\n\n", 3);
+        }
+    }
+}
+
+// WebServer returns a copy on the heap. Moving it to the arena right away frees the heap
+// in the order it was allocated, so nothing is left behind between other allocations.
+const char *KnxWebTransport::copyToArena(const String &text)
+{
+    char *copy = arena->copy(text.c_str(), text.length());
+    // Only with the heap exhausted, KnxArena counts it as a failure
+    return copy != nullptr ? copy : "";
+}
+
+const char *KnxWebTransport::header(const char *name)
+{
+#if defined(ESP8266)
+    // ESP8266WebServer hands out the Strings it keeps until the next request. Found by index
+    // they are used in place, by name the server would build a String of the name.
+    for (int i = 0; i < server->headers(); i++)
+    {
+        if (strcasecmp(server->headerName(i).c_str(), name) == 0)
+        {
+            return server->header(i).c_str();
+        }
+    }
+    return "";
+#else
+    return copyToArena(server->header(name));
+#endif
+}
+
+bool KnxWebTransport::hasArg(const char *name)
+{
+    return server->hasArg(name);
+}
+
+const char *KnxWebTransport::arg(const char *name)
+{
+#if defined(ESP8266)
+    for (int i = 0; i < server->args(); i++)
+    {
+        if (strcmp(server->argName(i).c_str(), name) == 0)
+        {
+            return server->arg(i).c_str();
+        }
+    }
+    return "";
+#else
+    return copyToArena(server->arg(name));
+#endif
+}
+
+bool KnxWebTransport::authenticate(const char *username, const char *password)
+{
+    return server->authenticate(username, password);
+}
+
+uint32_t KnxWebTransport::remoteIP()
+{
+    return server->client().remoteIP();
+}
+
+const char *KnxWebTransport::body(size_t &length)
+{
+    // The server keeps bodies that are not form data in the argument "plain"
+    const String &plain = server->arg("plain");
+    if (plain.length() >= sizeof(bodyBuffer))
+    {
+        length = 0;
+        return nullptr;
+    }
+    memcpy(bodyBuffer, plain.c_str(), plain.length() + 1);
+    length = plain.length();
+    return bodyBuffer;
+}
+
+void KnxWebTransport::sendHeader(const char *name, const char *value)
+{
+    server->sendHeader(name, value);
+}
+
+void KnxWebTransport::send(int code, const char *contentType, const char *content)
+{
+    bytesSent += strlen(content);
+    server->send(code, contentType, content);
+}
+
+void KnxWebTransport::send_P(int code, const char *contentType, PGM_P content, size_t length)
+{
+    bytesSent += length;
+    server->send_P(code, contentType, content, length);
+}
+
+void KnxWebTransport::requestAuthentication()
+{
+    server->requestAuthentication();
+}
+
+void KnxWebTransport::beginChunked(int code, const char *contentType)
+{
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(code, contentType, "");
+}
+
+void KnxWebTransport::sendChunk(const char *data, size_t length)
+{
+    bytesSent += length;
+    server->sendContent(data, length);
+}
+
+void KnxWebTransport::endChunked()
+{
+    // An empty chunk terminates the chunked transfer
+    server->sendContent("", 0);
+}
+
+void KnxWebTransport::beginResponse(int code, const char *contentType, size_t length)
+{
+    server->setContentLength(length);
+    server->send(code, contentType, "");
+}
+
+void KnxWebTransport::endResponse()
+{
+}
+
+void KnxWebTransport::closeConnection()
+{
+#if KNXWEB_KEEPALIVE
+    // The server sends its own Connection header, a second one would contradict it
+    server->keepAlive(false);
+#else
+    server->sendHeader("Connection", "close");
+#endif
+}
+
+// The synchronous server reads the next part only after the upload handler returned
+void KnxWebTransport::holdUpload()
+{
+}
+
+void KnxWebTransport::releaseUpload(size_t length)
+{
+}
+
+void KnxWebTransport::countRequest()
+{
+    WiFiClient client = server->client();
+    bool keepAlive = countConnection(client.remoteIP(), client.remotePort());
+#if KNXWEB_KEEPALIVE
+    // The last request of a connection is answered with Connection: close
+    server->keepAlive(keepAlive);
+#else
+    (void)keepAlive;
+#endif
+}
+
+void KnxWebTransport::beginEventStream()
+{
+    // Prefer a closed slot, otherwise the oldest stream is replaced
+    uint8_t slot = nextEventClient;
+    for (uint8_t i = 0; i < KNXWEB_EVENT_CLIENTS; i++)
+    {
+        if (!eventClients[i].connected())
+        {
+            slot = i;
+            break;
+        }
+    }
+    nextEventClient = (slot + 1) % KNXWEB_EVENT_CLIENTS;
+    eventClients[slot].stop();
+    eventClients[slot] = server->client();
+    // Written directly, a response sent through the server would end when the handler returns
+    eventClients[slot].print(F("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\nretry: 5000\n\n"));
+}
+
+size_t KnxWebTransport::eventClientCount()
+{
+    size_t count = 0;
+    for (WiFiClient &client : eventClients)
+    {
+        if (client.connected())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void KnxWebTransport::sendEvent(const char *event, const char *data)
+{
+    char text[192];
+    int length = snprintf(text, sizeof(text), "event: %s\ndata: %s\n\n", event, data);
+    if (length < 0 || length >= (int)sizeof(text))
+    {
+        return;
+    }
+    for (WiFiClient &client : eventClients)
+    {
+        writeEvent(client, text, length);
+    }
+}
+
+void KnxWebTransport::writeEvent(WiFiClient &client, const char *text, size_t length)
+{
+    if (!client.connected())
+    {
+        return;
+    }
+    if (client.write((const uint8_t *)text, length) != length)
+    {
+        client.stop();
+        return;
+    }
+    bytesSent += length;
+}
+
+#endif
+
+#if KNXWEB_NATIVE || !KNXWEB_ASYNC
+// Also used by the transport of the native tests
+bool KnxWebTransport::countConnection(uint32_t ip, uint16_t port)
+{
+    if (ip != connectionIP || port != connectionPort)
+    {
+        connectionIP = ip;
+        connectionPort = port;
+        connectionRequests = 0;
+        connections++;
+    }
+    connectionRequests++;
+    return connectionRequests < KNXWEB_KEEPALIVE_REQUESTS;
+}
+#endif
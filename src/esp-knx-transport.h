@@ -0,0 +1,208 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp-knx-arena.h"
+
+// Set to 1 to serve the pages with ESPAsyncWebServer instead of the synchronous WebServer
+// of the core. The async server handles several connections at once, so a slow client or a
+// running upload no longer blocks other requests. Handlers then run in the AsyncTCP task.
+#ifndef KNXWEB_ASYNC
+#define KNXWEB_ASYNC 0
+#endif
+
+// Set by the native env of platformio.ini. The transport is then the mock of test/mock,
+// which serves the requests of the tests without a network.
+#ifndef KNXWEB_NATIVE
+#define KNXWEB_NATIVE 0
+#endif
+
+#if KNXWEB_NATIVE
+#include <KnxMockHttp.h>
+#elif KNXWEB_ASYNC
+#if !defined(ESP32) && !defined(ESP8266)
+#error "KNXWEB_ASYNC needs ESP32 or ESP8266"
+#endif
+#include <ESPAsyncWebServer.h>
+#elif defined(ESP32) || defined(LIBRETINY)
+#include <WebServer.h>
+#elif defined(ESP8266)
+#include <ESP8266WebServer.h>
+#endif
+
+// Number of browsers receiving server-sent events at the same time
+#ifndef KNXWEB_EVENT_CLIENTS
+#define KNXWEB_EVENT_CLIENTS 2
+#endif
+
+// Requests served over one persistent connection before the client is asked to close it.
+// Only the synchronous server of ESP8266 core 3 or later keeps connections open.
+#ifndef KNXWEB_KEEPALIVE_REQUESTS
+#define KNXWEB_KEEPALIVE_REQUESTS 16
+#endif
+
+// Largest request body that is not an upload, like the commands for /api/command
+#ifndef KNXWEB_BODY_SIZE
+#define KNXWEB_BODY_SIZE 256
+#endif
+
+// Request methods as bit mask, a route can accept several of them
+#define KNXWEB_HTTP_GET 0x01
+#define KNXWEB_HTTP_POST 0x02
+#define KNXWEB_HTTP_OTHER 0x80
+#define KNXWEB_HTTP_ANY 0xFF
+
+typedef enum __knxWebUploadStatus
+{
+    KNXWEB_UPLOAD_START = 0,
+    KNXWEB_UPLOAD_WRITE = 1,
+    KNXWEB_UPLOAD_END = 2,
+    KNXWEB_UPLOAD_ABORTED = 3,
+} knxWebUploadStatus_t;
+
+typedef struct __knxWebUpload
+{
+    knxWebUploadStatus_t status;
+    String filename;
+    const uint8_t *data;
+    size_t length;
+    size_t totalSize;
+} knxWebUpload_t;
+
+class KnxWebserver;
+
+// Connects KnxWebserver to the HTTP server selected with KNXWEB_ASYNC. Handlers access the
+// current request only through this class, so they are the same for both servers.
+class KnxWebTransport
+{
+    friend class KnxRouteHandler;
+
+public:
+    // Request data returned by the transport is kept in arena until KnxWebserver resets it
+    void begin(KnxWebserver *webserver, KnxArena *arena, uint16_t port);
+    void loop();
+
+    // Valid until the end of the request, empty when missing
+    const char *header(const char *name);
+    bool hasArg(const char *name);
+    const char *arg(const char *name);
+    bool authenticate(const char *username, const char *password);
+    uint32_t remoteIP();
+    // Zero terminated body of a POST request, nullptr when it is larger than KNXWEB_BODY_SIZE
+    const char *body(size_t &length);
+    const knxWebUpload_t &upload() { return currentUpload; }
+    // Leaves the data of the current upload part unacknowledged until releaseUpload(), the
+    // client stops sending when the TCP window is full. Only with KNXWEB_ASYNC, where an
+    // upload handler must not wait. releaseUpload() may be called from loop().
+    void holdUpload();
+    void releaseUpload(size_t length);
+
+    // name must be a string literal, value is copied
+    void sendHeader(const char *name, const char *value);
+    void send(int code, const char *contentType = nullptr, const char *content = "");
+    void send_P(int code, const char *contentType, PGM_P content, size_t length);
+    void requestAuthentication();
+    void beginChunked(int code, const char *contentType);
+    void sendChunk(const char *data, size_t length);
+    void endChunked();
+    // Response of known length, sent with sendChunk() like a chunked one
+    void beginResponse(int code, const char *contentType, size_t length);
+    void endResponse();
+    // Closes the connection after the response, for responses followed by a restart
+    void closeConnection();
+
+#if KNXWEB_NATIVE
+    // Serves a request of the mock client right away. Returns false when an upload stopped
+    // at its window, the next call with it continues.
+    bool serve(const KnxMockRequest &request, KnxMockResponse &response);
+    // Text sent to the event streams since the last call
+    std::string takeEvents();
+#endif
+
+    // Turns the current request into a server-sent event stream
+    void beginEventStream();
+    size_t eventClientCount();
+    void sendEvent(const char *event, const char *data);
+
+    // Response bodies and events, without the headers
+    uint32_t getBytesSent() { return bytesSent; }
+    uint32_t getConnections() { return connections; }
+    // Requests received and not answered yet, including the current one. Always 1 with the
+    // synchronous server.
+#if KNXWEB_ASYNC || KNXWEB_NATIVE
+    uint8_t getRequestsInFlight() { return requestsInFlight; }
+#else
+    uint8_t getRequestsInFlight() { return 1; }
+#endif
+    uint8_t getMaxRequestsInFlight() { return maxRequestsInFlight; }
+
+private:
+    knxWebUpload_t currentUpload = {};
+    uint32_t bytesSent = 0;
+    uint32_t connections = 0;
+    uint8_t maxRequestsInFlight = 1;
+#if KNXWEB_NATIVE || !KNXWEB_ASYNC
+    // Connection of the last request, a kept connection sends the next one from the same port
+    uint32_t connectionIP = 0;
+    uint16_t connectionPort = 0;
+    uint16_t connectionRequests = 0;
+
+    // Counts a request of the connection from ip and port, false for the last one it may carry
+    bool countConnection(uint32_t ip, uint16_t port);
+#endif
+    KnxArena *arena = nullptr;
+    char bodyBuffer[KNXWEB_BODY_SIZE];
+#if KNXWEB_NATIVE
+    KnxWebserver *webserver = nullptr;
+    const KnxMockRequest *request = nullptr;
+    KnxMockResponse *response = nullptr;
+    uint8_t requestsInFlight = 0;
+    size_t eventStreams = 0;
+    std::string events;
+    // Upload waiting for held data, the offset and number of its next part
+    const KnxMockRequest *uploadRequest = nullptr;
+    size_t uploadOffset = 0;
+    size_t uploadParts = 0;
+    size_t heldBytes = 0;
+
+    const char *copyToArena(const std::string &text);
+#elif KNXWEB_ASYNC
+    // Headers are collected until the response object exists
+    static const size_t MAX_HEADERS = 8;
+
+    AsyncWebServer *server = nullptr;
+    AsyncWebServerRequest *request = nullptr;
+    AsyncWebServerRequest *uploadRequest = nullptr;
+    bool uploadHeld = false;
+#if defined(ESP32)
+    SemaphoreHandle_t uploadLock = nullptr;
+#endif
+    uint8_t requestsInFlight = 0;
+    // The body arrives in parts before the request is handled, bodyLength is the buffer size when it did not fit
+    AsyncWebServerRequest *bodyRequest = nullptr;
+    size_t bodyLength = 0;
+    AsyncResponseStream *stream = nullptr;
+    AsyncEventSource *events = nullptr;
+    const char *headerNames[MAX_HEADERS];
+    const char *headerValues[MAX_HEADERS];
+    size_t headerCount = 0;
+
+    void setRequest(AsyncWebServerRequest *newRequest);
+    void setUploadRequest(AsyncWebServerRequest *uploadOf);
+    void countRequest() { connections++; }
+    void addHeaders(AsyncWebServerResponse *response);
+    void appendBody(AsyncWebServerRequest *bodyOf, const uint8_t *data, size_t length, size_t index, size_t total);
+#else
+#if defined(ESP32) || defined(LIBRETINY)
+    WebServer *server = nullptr;
+#elif defined(ESP8266)
+    ESP8266WebServer *server = nullptr;
+#endif
+    // The server forgets a request after its handler, the event streams keep a copy of the connection
+    WiFiClient eventClients[KNXWEB_EVENT_CLIENTS];
+    uint8_t nextEventClient = 0;
+    unsigned long lastKeepAlive = 0;
+    void countRequest();
+    const char *copyToArena(const String &text);
+    void writeEvent(WiFiClient &client, const char *text, size_t length);
+#endif
+};
@@ -0,0 +1,434 @@
+#include "esp-knx-upload.h"
+#if defined(ESP8266)
+    #define errorString() getErrorString().c_str()
+#endif
+
+#if defined(ESP32)
+// Queue entry telling the writer task to finish
+#define WRITER_STOP -1
+#endif
+
+bool KnxUpload::begin(size_t size, bool heatshrink, const uint8_t *sha256)
+{
+    if (state == UPLOAD_RUNNING)
+    {
+        abort();
+    }
+    error[0] = 0;
+    total = size == UPDATE_SIZE_UNKNOWN ? 0 : size;
+    received = 0;
+    written = 0;
+    startTime = millis();
+    endTime = 0;
+    lastActivity = startTime;
+    format = heatshrink ? UPLOAD_FORMAT_HEATSHRINK : UPLOAD_FORMAT_DETECT;
+    imageStarted = false;
+    checkHash = sha256 != nullptr;
+    if (checkHash)
+    {
+        memcpy(expectedHash, sha256, KNXWEB_SHA256_SIZE);
+    }
+    verified = false;
+    hash.begin();
+    state = UPLOAD_RUNNING;
+    return true;
+}
+
+bool KnxUpload::write(const uint8_t *data, size_t length)
+{
+    if (state != UPLOAD_RUNNING)
+    {
+        return false;
+    }
+    lastActivity = millis();
+    // Update is started with the first data, the format decides about the image size
+    if (!imageStarted && !startImage(data, length))
+    {
+        return false;
+    }
+    received += length;
+    hash.update(data, length);
+
+    bool ok;
+    switch (format)
+    {
+    case UPLOAD_FORMAT_HEATSHRINK:
+        ok = heatshrinkDecoder.decode(data, length);
+        break;
+#if defined(ESP32)
+    case UPLOAD_FORMAT_GZIP:
+        ok = gzipDecoder.decode(data, length);
+        break;
+#endif
+    default:
+        ok = writeImage(data, length);
+        break;
+    }
+    if (!ok)
+    {
+        // Also after a write error, which failed the upload already, the window is not needed anymore
+        releaseDecoder();
+    }
+    if (!ok && state == UPLOAD_RUNNING)
+    {
+        // Only a decoder error is left, write errors already failed the upload
+        abort();
+        fail("Invalid compressed data");
+    }
+    return ok;
+}
+
+bool KnxUpload::writeAt(size_t offset, const uint8_t *data, size_t length)
+{
+    if (state != UPLOAD_RUNNING || offset > received)
+    {
+        return false;
+    }
+    // A resent chunk overlaps with the data already written
+    size_t skip = min(received - offset, length);
+    return skip == length || write(data + skip, length - skip);
+}
+
+bool KnxUpload::isResumable(size_t size, const uint8_t *sha256)
+{
+    return state == UPLOAD_RUNNING && checkHash && size == total && memcmp(sha256, expectedHash, KNXWEB_SHA256_SIZE) == 0;
+}
+
+bool KnxUpload::end()
+{
+    if (state != UPLOAD_RUNNING)
+    {
+        return false;
+    }
+    if (!imageStarted)
+    {
+        fail("No data received");
+        return false;
+    }
+#if defined(ESP32)
+    if (format == UPLOAD_FORMAT_GZIP && !gzipDecoder.isComplete())
+    {
+        abort();
+        fail("Incomplete gzip image");
+        return false;
+    }
+#endif
+    releaseDecoder();
+#if defined(ESP32)
+    if (fillIndex >= 0 && lengths[fillIndex] > 0)
+    {
+        xQueueSend(fullQueue, &fillIndex, portMAX_DELAY);
+        fillIndex = -1;
+    }
+    stopWriter();
+    if (writeFailed)
+    {
+        failFromUpdate();
+        return false;
+    }
+#endif
+    if (checkHash)
+    {
+        uint8_t digest[KNXWEB_SHA256_SIZE];
+        hash.finish(digest);
+        if (memcmp(digest, expectedHash, KNXWEB_SHA256_SIZE) != 0)
+        {
+            // The new image is never activated, the running firmware stays
+            discardImage();
+            fail("SHA-256 mismatch");
+            return false;
+        }
+        verified = true;
+    }
+    if (!Update.end(true))
+    {
+        failFromUpdate();
+        return false;
+    }
+    endTime = millis();
+    state = UPLOAD_DONE;
+    return true;
+}
+
+void KnxUpload::abort()
+{
+    if (state != UPLOAD_RUNNING)
+    {
+        return;
+    }
+    releaseDecoder();
+    if (imageStarted)
+    {
+#if defined(ESP32)
+        stopWriter();
+#endif
+        discardImage();
+    }
+    fail("Upload aborted");
+}
+
+void KnxUpload::loop(unsigned long now)
+{
+    // Signed, with KNXWEB_ASYNC write() may set lastActivity after now was taken
+    if (state == UPLOAD_RUNNING && (long)(now - lastActivity) > KNXWEB_UPLOAD_IDLE_TIMEOUT * 1000L)
+    {
+        abort();
+        fail("Upload timed out");
+    }
+}
+
+uint8_t KnxUpload::getProgress()
+{
+    if (state == UPLOAD_DONE)
+    {
+        return 100;
+    }
+    if (total == 0)
+    {
+        return 0;
+    }
+    return min((size_t)100, 100 * received / total);
+}
+
+uint32_t KnxUpload::getBytesPerSecond()
+{
+    unsigned long elapsed = (endTime != 0 ? endTime : millis()) - startTime;
+    if (state == UPLOAD_IDLE || elapsed == 0)
+    {
+        return 0;
+    }
+    return (uint64_t)received * 1000 / elapsed;
+}
+
+uint32_t KnxUpload::getEtaSeconds()
+{
+    uint32_t rate = getBytesPerSecond();
+    if (state != UPLOAD_RUNNING || rate == 0 || total <= received)
+    {
+        return 0;
+    }
+    return (total - received) / rate;
+}
+
+bool KnxUpload::startImage(const uint8_t *data, size_t length)
+{
+    imageStarted = true;
+    if (format == UPLOAD_FORMAT_DETECT)
+    {
+        format = length >= 2 && data[0] == 0x1f && data[1] == 0x8b ? UPLOAD_FORMAT_GZIP : UPLOAD_FORMAT_RAW;
+    }
+
+    size_t imageSize = total != 0 ? total : UPDATE_SIZE_UNKNOWN;
+    bool decoderOk = true;
+    switch (format)
+    {
+    case UPLOAD_FORMAT_HEATSHRINK:
+        // The uploaded size is the compressed one
+        imageSize = UPDATE_SIZE_UNKNOWN;
+        decoderOk = heatshrinkDecoder.begin(imageOutput, this);
+        break;
+    case UPLOAD_FORMAT_GZIP:
+#if defined(ESP32)
+        imageSize = UPDATE_SIZE_UNKNOWN;
+        decoderOk = gzipDecoder.begin(imageOutput, this);
+#elif defined(LIBRETINY)
+        imageStarted = false;
+        fail("gzip images are not supported");
+        return false;
+#endif
+        break;
+    default:
+        break;
+    }
+    if (!decoderOk)
+    {
+        releaseDecoder();
+        imageStarted = false;
+        fail("Out of memory");
+        return false;
+    }
+
+#if defined(ESP8266)
+    // The Updater needs a size, end(true) accepts an image smaller than announced
+    if (imageSize == UPDATE_SIZE_UNKNOWN)
+    {
+        imageSize = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
+    }
+#endif
+    if (!Update.begin(imageSize))
+    {
+        releaseDecoder();
+        imageStarted = false;
+        failFromUpdate();
+        return false;
+    }
+#if defined(ESP32)
+    if (!startWriter())
+    {
+        releaseDecoder();
+        imageStarted = false;
+        Update.abort();
+        fail("Out of memory");
+        return false;
+    }
+#endif
+    return true;
+}
+
+bool KnxUpload::writeImage(const uint8_t *data, size_t length)
+{
+#if defined(ESP32)
+    while (length > 0)
+    {
+        if (writeFailed)
+        {
+            stopWriter();
+            failFromUpdate();
+            return false;
+        }
+        if (fillIndex < 0)
+        {
+            // Blocks while both buffers are queued for writing
+            xQueueReceive(freeQueue, &fillIndex, portMAX_DELAY);
+            lengths[fillIndex] = 0;
+        }
+        size_t part = min(length, (size_t)KNXWEB_UPLOAD_BUFFER_SIZE - lengths[fillIndex]);
+        memcpy(buffers[fillIndex] + lengths[fillIndex], data, part);
+        lengths[fillIndex] += part;
+        written += part;
+        data += part;
+        length -= part;
+        if (lengths[fillIndex] == KNXWEB_UPLOAD_BUFFER_SIZE)
+        {
+            xQueueSend(fullQueue, &fillIndex, portMAX_DELAY);
+            fillIndex = -1;
+        }
+    }
+#else
+    if (Update.write((uint8_t *)data, length) != length)
+    {
+        failFromUpdate();
+        // The ESP8266 Updater stays busy after a write error, the next begin() would fail
+        discardImage();
+        return false;
+    }
+    written += length;
+#endif
+    return true;
+}
+
+bool KnxUpload::imageOutput(void *context, const uint8_t *data, size_t length)
+{
+    return ((KnxUpload *)context)->writeImage(data, length);
+}
+
+void KnxUpload::discardImage()
+{
+#if defined(ESP32)
+    Update.abort();
+#elif defined(ESP8266)
+    // The ESP8266 Updater has no abort(). end() resets it without activating an incomplete
+    // image, a complete one is activated unless its MD5 check fails, so it gets one that cannot match.
+    Update.setMD5("00000000000000000000000000000000");
+    Update.end();
+#endif
+}
+
+void KnxUpload::releaseDecoder()
+{
+    heatshrinkDecoder.end();
+#if defined(ESP32)
+    gzipDecoder.end();
+#endif
+}
+
+void KnxUpload::fail(const char *message)
+{
+    strncpy(error, message, sizeof(error) - 1);
+    error[sizeof(error) - 1] = 0;
+    endTime = millis();
+    state = UPLOAD_FAILED;
+}
+
+void KnxUpload::failFromUpdate()
+{
+    fail(Update.errorString());
+}
+
+#if defined(ESP32)
+bool KnxUpload::startWriter()
+{
+    buffers[0] = (uint8_t *)malloc(KNXWEB_UPLOAD_BUFFER_SIZE);
+    buffers[1] = (uint8_t *)malloc(KNXWEB_UPLOAD_BUFFER_SIZE);
+    fullQueue = xQueueCreate(2, sizeof(int));
+    freeQueue = xQueueCreate(2, sizeof(int));
+    writerDone = xSemaphoreCreateBinary();
+    writeFailed = false;
+    fillIndex = -1;
+    if (buffers[0] == nullptr || buffers[1] == nullptr || fullQueue == nullptr || freeQueue == nullptr || writerDone == nullptr ||
+        xTaskCreate(writerTask, "knxUpload", 4096, this, 1, nullptr) != pdPASS)
+    {
+        releaseWriter();
+        return false;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        xQueueSend(freeQueue, &i, 0);
+    }
+    return true;
+}
+
+void KnxUpload::stopWriter()
+{
+    if (writerDone == nullptr)
+    {
+        return;
+    }
+    int stop = WRITER_STOP;
+    xQueueSend(fullQueue, &stop, portMAX_DELAY);
+    xSemaphoreTake(writerDone, portMAX_DELAY);
+    releaseWriter();
+}
+
+void KnxUpload::releaseWriter()
+{
+    if (writerDone != nullptr)
+    {
+        vSemaphoreDelete(writerDone);
+        writerDone = nullptr;
+    }
+    if (fullQueue != nullptr)
+    {
+        vQueueDelete(fullQueue);
+        fullQueue = nullptr;
+    }
+    if (freeQueue != nullptr)
+    {
+        vQueueDelete(freeQueue);
+        freeQueue = nullptr;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        free(buffers[i]);
+        buffers[i] = nullptr;
+    }
+    fillIndex = -1;
+}
+
+void KnxUpload::writerTask(void *arg)
+{
+    KnxUpload *upload = (KnxUpload *)arg;
+    int index;
+    while (xQueueReceive(upload->fullQueue, &index, portMAX_DELAY) == pdTRUE && index != WRITER_STOP)
+    {
+        // After a failed write the buffers are still returned so the receiving side never blocks
+        if (!upload->writeFailed && Update.write(upload->buffers[index], upload->lengths[index]) != upload->lengths[index])
+        {
+            upload->writeFailed = true;
+        }
+        xQueueSend(upload->freeQueue, &index, portMAX_DELAY);
+    }
+    xSemaphoreGive(upload->writerDone);
+    vTaskDelete(nullptr);
+}
+#endif
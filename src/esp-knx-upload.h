@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp-knx-decompress.h"
+#include "esp-knx-sha256.h"
+
+#if defined(ESP32) || defined(LIBRETINY)
+#include <Update.h>
+#elif defined(ESP8266)
+#include <Updater.h>
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#endif
+
+// Size of one write to flash, matches the flash sector size
+#ifndef KNXWEB_UPLOAD_BUFFER_SIZE
+#define KNXWEB_UPLOAD_BUFFER_SIZE 4096
+#endif
+
+// Seconds without data before loop() aborts a running upload and frees Update and the buffers
+#ifndef KNXWEB_UPLOAD_IDLE_TIMEOUT
+#define KNXWEB_UPLOAD_IDLE_TIMEOUT 60
+#endif
+
+typedef enum __uploadState
+{
+    UPLOAD_IDLE = 0,
+    UPLOAD_RUNNING = 1,
+    UPLOAD_DONE = 2,
+    UPLOAD_FAILED = 3,
+} uploadState_t;
+
+typedef enum __uploadFormat
+{
+    UPLOAD_FORMAT_DETECT = 0,
+    UPLOAD_FORMAT_RAW = 1,
+    UPLOAD_FORMAT_GZIP = 2,
+    UPLOAD_FORMAT_HEATSHRINK = 3,
+} uploadFormat_t;
+
+// Feeds a firmware image into Update and keeps progress and throughput figures.
+// gzip images are recognized by their magic number, heatshrink images have to be
+// announced in begin(). Both are decompressed on the fly, except for gzip on ESP8266
+// where the Updater stores the compressed image and the bootloader unpacks it.
+// On ESP32 the incoming data is collected in two sector sized buffers and written
+// to flash by a separate task, so receiving the next buffer overlaps with the
+// flash erase and write of the previous one. The other platforms write straight
+// through, their Updater already collects the data per flash sector.
+// The uploaded bytes are hashed while they arrive. With an expected SHA-256 given to
+// begin() the image is only activated by end() when the digests match.
+class KnxUpload
+{
+public:
+    // sha256 is the expected digest of the uploaded file, nullptr skips the check
+    bool begin(size_t size, bool heatshrink = false, const uint8_t *sha256 = nullptr);
+    bool write(const uint8_t *data, size_t length);
+    // Writes the part of data at offset that was not received yet. Returns false without
+    // failing the upload when offset is beyond getReceived(), the client has to resend from there.
+    bool writeAt(size_t offset, const uint8_t *data, size_t length);
+    bool end();
+    void abort();
+    // Aborts an upload that got no data for KNXWEB_UPLOAD_IDLE_TIMEOUT seconds, a client
+    // that went away would otherwise keep its resources until the next upload
+    void loop(unsigned long now);
+    // True while the upload of the same file is running, it continues at getReceived()
+    bool isResumable(size_t size, const uint8_t *sha256);
+
+    uploadState_t getState() { return state; }
+    const char *getError() { return error; }
+    size_t getReceived() { return received; }
+    size_t getTotal() { return total; }
+    size_t getWritten() { return written; }
+    uploadFormat_t getFormat() { return format; }
+    bool isVerified() { return verified; }
+    uint8_t getProgress();
+    uint32_t getBytesPerSecond();
+    uint32_t getEtaSeconds();
+
+private:
+    uploadState_t state = UPLOAD_IDLE;
+    char error[48] = "";
+    size_t total = 0;
+    size_t received = 0;
+    size_t written = 0;
+    unsigned long startTime = 0;
+    unsigned long endTime = 0;
+    volatile unsigned long lastActivity = 0;
+    uploadFormat_t format = UPLOAD_FORMAT_DETECT;
+    bool imageStarted = false;
+    KnxSha256 hash;
+    uint8_t expectedHash[KNXWEB_SHA256_SIZE];
+    bool checkHash = false;
+    bool verified = false;
+    KnxHeatshrinkDecoder heatshrinkDecoder;
+#if defined(ESP32)
+    KnxGzipDecoder gzipDecoder;
+#endif
+
+    bool startImage(const uint8_t *data, size_t length);
+    bool writeImage(const uint8_t *data, size_t length);
+    static bool imageOutput(void *context, const uint8_t *data, size_t length);
+    // Stops Update without activating the new image
+    void discardImage();
+    void releaseDecoder();
+    void fail(const char *message);
+    void failFromUpdate();
+
+#if defined(ESP32)
+    uint8_t *buffers[2] = {nullptr, nullptr};
+    size_t lengths[2] = {0, 0};
+    int fillIndex = -1;
+    volatile bool writeFailed = false;
+    QueueHandle_t fullQueue = nullptr;
+    QueueHandle_t freeQueue = nullptr;
+    SemaphoreHandle_t writerDone = nullptr;
+
+    bool startWriter();
+    void stopWriter();
+    void releaseWriter();
+    static void writerTask(void *arg);
+#endif
+};
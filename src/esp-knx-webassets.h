@@ -0,0 +1,1053 @@
+// Generated by tools/embed_assets.py from the files in web/, do not edit.
+#pragma once
+
+// index.html: 5611 bytes, gzip 2471 bytes
+constexpr char ROOT_HTML[] PROGMEM = {
+    '\x3C', '\x21', '\x44', '\x4F', '\x43', '\x54', '\x59', '\x50', '\x45', '\x20', '\x68', '\x74', '\x6D', '\x6C', '\x3E', '\x3C',
+    '\x68', '\x74', '\x6D', '\x6C', '\x3E', '\x0A', '\x3C', '\x68', '\x65', '\x61', '\x64', '\x3E', '\x3C', '\x6D', '\x65', '\x74',
+    '\x61', '\x20', '\x6E', '\x61', '\x6D', '\x65', '\x3D', '\x22', '\x76', '\x69', '\x65', '\x77', '\x70', '\x6F', '\x72', '\x74',
+    '\x22', '\x20', '\x63', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74', '\x3D', '\x22', '\x77', '\x69', '\x64', '\x74', '\x68',
+    '\x3D', '\x64', '\x65', '\x76', '\x69', '\x63', '\x65', '\x2D', '\x77', '\x69', '\x64', '\x74', '\x68', '\x2C', '\x20', '\x69',
+    '\x6E', '\x69', '\x74', '\x69', '\x61', '\x6C', '\x2D', '\x73', '\x63', '\x61', '\x6C', '\x65', '\x3D', '\x31', '\x2E', '\x30',
+    '\x2C', '\x20', '\x75', '\x73', '\x65', '\x72', '\x2D', '\x73', '\x63', '\x61', '\x6C', '\x61', '\x62', '\x6C', '\x65', '\x3D',
+    '\x6E', '\x6F', '\x22', '\x3E', '\x0A', '\x3C', '\x6C', '\x69', '\x6E', '\x6B', '\x20', '\x72', '\x65', '\x6C', '\x3D', '\x27',
+    '\x69', '\x63', '\x6F', '\x6E', '\x27', '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D', '\x27', '\x2F', '\x66', '\x61', '\x76',
+    '\x69', '\x63', '\x6F', '\x6E', '\x2E', '\x69', '\x63', '\x6F', '\x27', '\x20', '\x73', '\x69', '\x7A', '\x65', '\x73', '\x3D',
+    '\x27', '\x61', '\x6E', '\x79', '\x27', '\x3E', '\x0A', '\x3C', '\x74', '\x69', '\x74', '\x6C', '\x65', '\x3E', '\x45', '\x53',
+    '\x50', '\x2D', '\x4B', '\x4E', '\x58', '\x2D', '\x44', '\x65', '\x76', '\x69', '\x63', '\x65', '\x3C', '\x2F', '\x74', '\x69',
+    '\x74', '\x6C', '\x65', '\x3E', '\x0A', '\x3C', '\x73', '\x74', '\x79', '\x6C', '\x65', '\x3E', '\x68', '\x74', '\x6D', '\x6C',
+    '\x20', '\x7B', '\x66', '\x6F', '\x6E', '\x74', '\x2D', '\x66', '\x61', '\x6D', '\x69', '\x6C', '\x79', '\x3A', '\x20', '\x48',
+    '\x65', '\x6C', '\x76', '\x65', '\x74', '\x69', '\x63', '\x61', '\x3B', '\x20', '\x64', '\x69', '\x73', '\x70', '\x6C', '\x61',
+    '\x79', '\x3A', '\x20', '\x69', '\x6E', '\x6C', '\x69', '\x6E', '\x65', '\x2D', '\x62', '\x6C', '\x6F', '\x63', '\x6B', '\x3B',
+    '\x20', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x34', '\x34', '\x34', '\x34', '\x34', '\x34', '\x3B',
+    '\x20', '\x74', '\x65', '\x78', '\x74', '\x2D', '\x61', '\x6C', '\x69', '\x67', '\x6E', '\x3A', '\x20', '\x63', '\x65', '\x6E',
+    '\x74', '\x65', '\x72', '\x3B', '\x7D', '\x0A', '\x68', '\x31', '\x20', '\x7B', '\x6D', '\x61', '\x72', '\x67', '\x69', '\x6E',
+    '\x3A', '\x20', '\x35', '\x30', '\x70', '\x78', '\x20', '\x61', '\x75', '\x74', '\x6F', '\x20', '\x33', '\x30', '\x70', '\x78',
+    '\x3B', '\x7D', '\x0A', '\x2E', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x7B', '\x64', '\x69', '\x73', '\x70',
+    '\x6C', '\x61', '\x79', '\x3A', '\x20', '\x69', '\x6E', '\x6C', '\x69', '\x6E', '\x65', '\x2D', '\x62', '\x6C', '\x6F', '\x63',
+    '\x6B', '\x3B', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3A', '\x20', '\x38', '\x30', '\x70', '\x78', '\x3B', '\x62', '\x61',
+    '\x63', '\x6B', '\x67', '\x72', '\x6F', '\x75', '\x6E', '\x64', '\x2D', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20',
+    '\x23', '\x33', '\x34', '\x39', '\x38', '\x64', '\x62', '\x3B', '\x62', '\x6F', '\x72', '\x64', '\x65', '\x72', '\x3A', '\x20',
+    '\x6E', '\x6F', '\x6E', '\x65', '\x3B', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x77', '\x68', '\x69', '\x74',
+    '\x65', '\x3B', '\x70', '\x61', '\x64', '\x64', '\x69', '\x6E', '\x67', '\x3A', '\x20', '\x31', '\x33', '\x70', '\x78', '\x20',
+    '\x33', '\x30', '\x70', '\x78', '\x3B', '\x74', '\x65', '\x78', '\x74', '\x2D', '\x64', '\x65', '\x63', '\x6F', '\x72', '\x61',
+    '\x74', '\x69', '\x6F', '\x6E', '\x3A', '\x20', '\x6E', '\x6F', '\x6E', '\x65', '\x3B', '\x66', '\x6F', '\x6E', '\x74', '\x2D',
+    '\x73', '\x69', '\x7A', '\x65', '\x3A', '\x20', '\x32', '\x35', '\x70', '\x78', '\x3B', '\x6D', '\x61', '\x72', '\x67', '\x69',
+    '\x6E', '\x3A', '\x20', '\x30', '\x70', '\x78', '\x20', '\x35', '\x70', '\x78', '\x20', '\x33', '\x35', '\x70', '\x78', '\x20',
+    '\x35', '\x70', '\x78', '\x3B', '\x63', '\x75', '\x72', '\x73', '\x6F', '\x72', '\x3A', '\x20', '\x70', '\x6F', '\x69', '\x6E',
+    '\x74', '\x65', '\x72', '\x3B', '\x62', '\x6F', '\x72', '\x64', '\x65', '\x72', '\x2D', '\x72', '\x61', '\x64', '\x69', '\x75',
+    '\x73', '\x3A', '\x20', '\x34', '\x70', '\x78', '\x3B', '\x7D', '\x0A', '\x2E', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E',
+    '\x2D', '\x62', '\x6C', '\x75', '\x65', '\x20', '\x7B', '\x62', '\x61', '\x63', '\x6B', '\x67', '\x72', '\x6F', '\x75', '\x6E',
+    '\x64', '\x2D', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x33', '\x34', '\x39', '\x38', '\x64', '\x62',
+    '\x3B', '\x20', '\x63', '\x75', '\x72', '\x73', '\x6F', '\x72', '\x3A', '\x20', '\x6E', '\x6F', '\x74', '\x2D', '\x61', '\x6C',
+    '\x6C', '\x6F', '\x77', '\x65', '\x64', '\x20', '\x3B', '\x7D', '\x0A', '\x2E', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E',
+    '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x20', '\x7B', '\x62', '\x61', '\x63', '\x6B', '\x67', '\x72', '\x6F', '\x75', '\x6E',
+    '\x64', '\x2D', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x33', '\x34', '\x34', '\x39', '\x35', '\x65',
+    '\x3B', '\x7D', '\x0A', '\x2E', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x3A',
+    '\x61', '\x63', '\x74', '\x69', '\x76', '\x65', '\x20', '\x7B', '\x62', '\x61', '\x63', '\x6B', '\x67', '\x72', '\x6F', '\x75',
+    '\x6E', '\x64', '\x2D', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x32', '\x63', '\x33', '\x65', '\x35',
+    '\x30', '\x3B', '\x7D', '\x0A', '\x2E', '\x77', '\x61', '\x72', '\x6E', '\x69', '\x6E', '\x67', '\x20', '\x7B', '\x63', '\x6F',
+    '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x61', '\x39', '\x33', '\x32', '\x32', '\x36', '\x3B', '\x7D', '\x0A', '\x70',
+    '\x20', '\x7B', '\x66', '\x6F', '\x6E', '\x74', '\x2D', '\x73', '\x69', '\x7A', '\x65', '\x3A', '\x20', '\x31', '\x34', '\x70',
+    '\x78', '\x3B', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A', '\x20', '\x23', '\x38', '\x38', '\x38', '\x3B', '\x6D', '\x61',
+    '\x72', '\x67', '\x69', '\x6E', '\x2D', '\x62', '\x6F', '\x74', '\x74', '\x6F', '\x6D', '\x3A', '\x20', '\x31', '\x30', '\x70',
+    '\x78', '\x3B', '\x7D', '\x0A', '\x23', '\x69', '\x6E', '\x66', '\x6F', '\x20', '\x7B', '\x77', '\x68', '\x69', '\x74', '\x65',
+    '\x2D', '\x73', '\x70', '\x61', '\x63', '\x65', '\x3A', '\x20', '\x70', '\x72', '\x65', '\x2D', '\x6C', '\x69', '\x6E', '\x65',
+    '\x3B', '\x7D', '\x0A', '\x5B', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x5D', '\x20', '\x7B', '\x64', '\x69', '\x73',
+    '\x70', '\x6C', '\x61', '\x79', '\x3A', '\x20', '\x6E', '\x6F', '\x6E', '\x65', '\x20', '\x21', '\x69', '\x6D', '\x70', '\x6F',
+    '\x72', '\x74', '\x61', '\x6E', '\x74', '\x3B', '\x7D', '\x0A', '\x3C', '\x2F', '\x73', '\x74', '\x79', '\x6C', '\x65', '\x3E',
+    '\x0A', '\x3C', '\x2F', '\x68', '\x65', '\x61', '\x64', '\x3E', '\x0A', '\x3C', '\x62', '\x6F', '\x64', '\x79', '\x3E', '\x0A',
+    '\x3C', '\x68', '\x31', '\x3E', '\x45', '\x53', '\x50', '\x20', '\x62', '\x61', '\x73', '\x65', '\x64', '\x20', '\x4B', '\x4E',
+    '\x58', '\x20', '\x64', '\x65', '\x76', '\x69', '\x63', '\x65', '\x3C', '\x2F', '\x68', '\x31', '\x3E', '\x0A', '\x3C', '\x68',
+    '\x33', '\x3E', '\x4E', '\x61', '\x6D', '\x65', '\x3A', '\x20', '\x3C', '\x73', '\x70', '\x61', '\x6E', '\x20', '\x69', '\x64',
+    '\x3D', '\x22', '\x6E', '\x61', '\x6D', '\x65', '\x22', '\x3E', '\x3C', '\x2F', '\x73', '\x70', '\x61', '\x6E', '\x3E', '\x3C',
+    '\x2F', '\x68', '\x33', '\x3E', '\x0A', '\x3C', '\x68', '\x33', '\x3E', '\x50', '\x68', '\x79', '\x73', '\x69', '\x63', '\x61',
+    '\x6C', '\x20', '\x61', '\x64', '\x64', '\x72', '\x65', '\x73', '\x73', '\x3A', '\x20', '\x3C', '\x73', '\x70', '\x61', '\x6E',
+    '\x20', '\x69', '\x64', '\x3D', '\x22', '\x61', '\x64', '\x64', '\x72', '\x22', '\x3E', '\x3C', '\x2F', '\x73', '\x70', '\x61',
+    '\x6E', '\x3E', '\x3C', '\x2F', '\x68', '\x33', '\x3E', '\x0A', '\x3C', '\x68', '\x33', '\x20', '\x63', '\x6C', '\x61', '\x73',
+    '\x73', '\x3D', '\x22', '\x77', '\x61', '\x72', '\x6E', '\x69', '\x6E', '\x67', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22',
+    '\x63', '\x66', '\x67', '\x22', '\x20', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x4B', '\x4E', '\x58', '\x20',
+    '\x63', '\x6F', '\x6E', '\x66', '\x69', '\x67', '\x75', '\x72', '\x61', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x69', '\x6E',
+    '\x63', '\x6F', '\x6D', '\x70', '\x6C', '\x65', '\x74', '\x65', '\x21', '\x3C', '\x2F', '\x68', '\x33', '\x3E', '\x0A', '\x3C',
+    '\x64', '\x69', '\x76', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6D', '\x6F', '\x64', '\x65', '\x22', '\x20', '\x68', '\x69',
+    '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x3C', '\x70', '\x3E', '\x4B', '\x4E', '\x58', '\x20', '\x4D', '\x6F', '\x64', '\x65',
+    '\x3A', '\x3C', '\x2F', '\x70', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62',
+    '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6D', '\x32', '\x22', '\x3E', '\x50',
+    '\x52', '\x4F', '\x47', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D',
+    '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6D', '\x31', '\x22',
+    '\x3E', '\x4E', '\x6F', '\x72', '\x6D', '\x61', '\x6C', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C',
+    '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x22', '\x20', '\x69', '\x64', '\x3D',
+    '\x22', '\x6D', '\x30', '\x22', '\x3E', '\x4F', '\x46', '\x46', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x2F', '\x64', '\x69',
+    '\x76', '\x3E', '\x0A', '\x3C', '\x64', '\x69', '\x76', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6F', '\x74', '\x61', '\x22',
+    '\x20', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x3C', '\x70', '\x3E', '\x4F', '\x54', '\x41', '\x3A', '\x20',
+    '\x3C', '\x73', '\x70', '\x61', '\x6E', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x74', '\x69', '\x6D', '\x65', '\x72', '\x22',
+    '\x3E', '\x3C', '\x2F', '\x73', '\x70', '\x61', '\x6E', '\x3E', '\x20', '\x3C', '\x73', '\x70', '\x61', '\x6E', '\x20', '\x69',
+    '\x64', '\x3D', '\x22', '\x6F', '\x74', '\x61', '\x73', '\x74', '\x22', '\x3E', '\x3C', '\x2F', '\x73', '\x70', '\x61', '\x6E',
+    '\x3E', '\x3C', '\x2F', '\x70', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62',
+    '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6F', '\x31', '\x22', '\x3E', '\x4F',
+    '\x4E', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62',
+    '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6F', '\x30', '\x22', '\x3E', '\x4F',
+    '\x46', '\x46', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x2F', '\x64', '\x69', '\x76', '\x3E', '\x0A', '\x3C', '\x70', '\x20',
+    '\x69', '\x64', '\x3D', '\x22', '\x77', '\x75', '\x22', '\x20', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x57',
+    '\x65', '\x62', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x3A', '\x3C', '\x2F', '\x70', '\x3E', '\x0A', '\x3C', '\x61',
+    '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x62',
+    '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x22', '\x20', '\x68', '\x72', '\x65', '\x66',
+    '\x3D', '\x22', '\x2F', '\x77', '\x65', '\x62', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x22', '\x3E', '\x55', '\x70',
+    '\x6C', '\x6F', '\x61', '\x64', '\x3C', '\x2F', '\x61', '\x3E', '\x0A', '\x3C', '\x70', '\x3E', '\x53', '\x79', '\x73', '\x74',
+    '\x65', '\x6D', '\x3A', '\x3C', '\x2F', '\x70', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D',
+    '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x2D', '\x64',
+    '\x61', '\x72', '\x6B', '\x22', '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D', '\x22', '\x2F', '\x72', '\x65', '\x73', '\x74',
+    '\x61', '\x72', '\x74', '\x22', '\x3E', '\x52', '\x65', '\x73', '\x74', '\x61', '\x72', '\x74', '\x3C', '\x2F', '\x61', '\x3E',
+    '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E',
+    '\x20', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x22', '\x20', '\x69', '\x64',
+    '\x3D', '\x22', '\x74', '\x75', '\x22', '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D', '\x22', '\x2F', '\x74', '\x66', '\x74',
+    '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x22', '\x20', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x54',
+    '\x46', '\x54', '\x20', '\x55', '\x70', '\x64', '\x61', '\x74', '\x65', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x61', '\x20',
+    '\x63', '\x6C', '\x61', '\x73', '\x73', '\x3D', '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x62', '\x75',
+    '\x74', '\x74', '\x6F', '\x6E', '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x74',
+    '\x64', '\x22', '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D', '\x22', '\x2F', '\x74', '\x66', '\x74', '\x64', '\x65', '\x62',
+    '\x75', '\x67', '\x22', '\x20', '\x68', '\x69', '\x64', '\x64', '\x65', '\x6E', '\x3E', '\x54', '\x46', '\x54', '\x20', '\x44',
+    '\x65', '\x62', '\x75', '\x67', '\x3C', '\x2F', '\x61', '\x3E', '\x3C', '\x61', '\x20', '\x63', '\x6C', '\x61', '\x73', '\x73',
+    '\x3D', '\x22', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x2D',
+    '\x64', '\x61', '\x72', '\x6B', '\x22', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x6C', '\x6F', '\x22', '\x20', '\x68', '\x69',
+    '\x64', '\x64', '\x65', '\x6E', '\x20', '\x6F', '\x6E', '\x63', '\x6C', '\x69', '\x63', '\x6B', '\x3D', '\x22', '\x66', '\x65',
+    '\x74', '\x63', '\x68', '\x28', '\x27', '\x2F', '\x6C', '\x6F', '\x67', '\x6F', '\x75', '\x74', '\x27', '\x29', '\x2E', '\x74',
+    '\x68', '\x65', '\x6E', '\x28', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x29', '\x20',
+    '\x7B', '\x20', '\x77', '\x69', '\x6E', '\x64', '\x6F', '\x77', '\x2E', '\x6F', '\x70', '\x65', '\x6E', '\x28', '\x27', '\x68',
+    '\x74', '\x74', '\x70', '\x3A', '\x2F', '\x2F', '\x6C', '\x6F', '\x67', '\x6F', '\x75', '\x74', '\x40', '\x27', '\x20', '\x2B',
+    '\x20', '\x77', '\x69', '\x6E', '\x64', '\x6F', '\x77', '\x2E', '\x6C', '\x6F', '\x63', '\x61', '\x74', '\x69', '\x6F', '\x6E',
+    '\x2E', '\x68', '\x6F', '\x73', '\x74', '\x2C', '\x20', '\x27', '\x5F', '\x73', '\x65', '\x6C', '\x66', '\x27', '\x29', '\x3B',
+    '\x20', '\x7D', '\x29', '\x3B', '\x22', '\x3E', '\x4C', '\x6F', '\x67', '\x6F', '\x75', '\x74', '\x3C', '\x2F', '\x61', '\x3E',
+    '\x0A', '\x3C', '\x68', '\x33', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x63', '\x68', '\x69', '\x70', '\x22', '\x3E', '\x3C',
+    '\x2F', '\x68', '\x33', '\x3E', '\x0A', '\x3C', '\x70', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x69', '\x6E', '\x66', '\x6F',
+    '\x22', '\x3E', '\x3C', '\x2F', '\x70', '\x3E', '\x0A', '\x3C', '\x70', '\x20', '\x69', '\x64', '\x3D', '\x22', '\x62', '\x75',
+    '\x69', '\x6C', '\x64', '\x22', '\x3E', '\x3C', '\x2F', '\x70', '\x3E', '\x0A', '\x3C', '\x73', '\x63', '\x72', '\x69', '\x70',
+    '\x74', '\x3E', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x6D', '\x6F', '\x64', '\x65', '\x73', '\x20', '\x3D', '\x20', '\x5B',
+    '\x27', '\x6F', '\x66', '\x66', '\x27', '\x2C', '\x20', '\x27', '\x6E', '\x6F', '\x72', '\x6D', '\x61', '\x6C', '\x27', '\x2C',
+    '\x20', '\x27', '\x70', '\x72', '\x6F', '\x67', '\x27', '\x5D', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x6D', '\x6F',
+    '\x64', '\x65', '\x4C', '\x69', '\x6E', '\x6B', '\x73', '\x20', '\x3D', '\x20', '\x5B', '\x27', '\x2F', '\x6B', '\x6E', '\x78',
+    '\x6F', '\x66', '\x66', '\x27', '\x2C', '\x20', '\x27', '\x2F', '\x6E', '\x6F', '\x72', '\x6D', '\x61', '\x6C', '\x6D', '\x6F',
+    '\x64', '\x65', '\x27', '\x2C', '\x20', '\x27', '\x2F', '\x70', '\x72', '\x6F', '\x67', '\x6D', '\x6F', '\x64', '\x65', '\x27',
+    '\x5D', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x74', '\x20', '\x3D', '\x20', '\x2D', '\x31', '\x3B', '\x0A', '\x76',
+    '\x61', '\x72', '\x20', '\x73', '\x74', '\x61', '\x74', '\x65', '\x20', '\x3D', '\x20', '\x7B', '\x7D', '\x3B', '\x0A', '\x76',
+    '\x61', '\x72', '\x20', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x73', '\x20', '\x3D', '\x20', '\x6E', '\x75', '\x6C', '\x6C',
+    '\x3B', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x24', '\x28', '\x69', '\x64', '\x29',
+    '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x64', '\x6F', '\x63', '\x75', '\x6D', '\x65',
+    '\x6E', '\x74', '\x2E', '\x67', '\x65', '\x74', '\x45', '\x6C', '\x65', '\x6D', '\x65', '\x6E', '\x74', '\x42', '\x79', '\x49',
+    '\x64', '\x28', '\x69', '\x64', '\x29', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F',
+    '\x6E', '\x20', '\x73', '\x68', '\x6F', '\x77', '\x28', '\x69', '\x64', '\x2C', '\x20', '\x76', '\x69', '\x73', '\x69', '\x62',
+    '\x6C', '\x65', '\x29', '\x20', '\x7B', '\x20', '\x24', '\x28', '\x69', '\x64', '\x29', '\x2E', '\x68', '\x69', '\x64', '\x64',
+    '\x65', '\x6E', '\x20', '\x3D', '\x20', '\x21', '\x76', '\x69', '\x73', '\x69', '\x62', '\x6C', '\x65', '\x3B', '\x20', '\x7D',
+    '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E',
+    '\x28', '\x65', '\x6C', '\x2C', '\x20', '\x61', '\x63', '\x74', '\x69', '\x76', '\x65', '\x2C', '\x20', '\x68', '\x72', '\x65',
+    '\x66', '\x29', '\x20', '\x7B', '\x0A', '\x65', '\x6C', '\x2E', '\x63', '\x6C', '\x61', '\x73', '\x73', '\x4E', '\x61', '\x6D',
+    '\x65', '\x20', '\x3D', '\x20', '\x27', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x20', '\x27', '\x20', '\x2B', '\x20',
+    '\x28', '\x61', '\x63', '\x74', '\x69', '\x76', '\x65', '\x20', '\x3F', '\x20', '\x27', '\x62', '\x75', '\x74', '\x74', '\x6F',
+    '\x6E', '\x2D', '\x62', '\x6C', '\x75', '\x65', '\x27', '\x20', '\x3A', '\x20', '\x27', '\x62', '\x75', '\x74', '\x74', '\x6F',
+    '\x6E', '\x2D', '\x64', '\x61', '\x72', '\x6B', '\x27', '\x29', '\x3B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x61', '\x63',
+    '\x74', '\x69', '\x76', '\x65', '\x29', '\x20', '\x65', '\x6C', '\x2E', '\x72', '\x65', '\x6D', '\x6F', '\x76', '\x65', '\x41',
+    '\x74', '\x74', '\x72', '\x69', '\x62', '\x75', '\x74', '\x65', '\x28', '\x27', '\x68', '\x72', '\x65', '\x66', '\x27', '\x29',
+    '\x3B', '\x20', '\x65', '\x6C', '\x73', '\x65', '\x20', '\x65', '\x6C', '\x2E', '\x68', '\x72', '\x65', '\x66', '\x20', '\x3D',
+    '\x20', '\x68', '\x72', '\x65', '\x66', '\x3B', '\x0A', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F',
+    '\x6E', '\x20', '\x6D', '\x62', '\x28', '\x76', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E',
+    '\x20', '\x2B', '\x28', '\x76', '\x20', '\x2F', '\x20', '\x31', '\x30', '\x34', '\x38', '\x35', '\x37', '\x36', '\x29', '\x2E',
+    '\x74', '\x6F', '\x46', '\x69', '\x78', '\x65', '\x64', '\x28', '\x31', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x4D', '\x42',
+    '\x27', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x6B', '\x62',
+    '\x28', '\x76', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x2B', '\x28', '\x76',
+    '\x20', '\x2F', '\x20', '\x31', '\x30', '\x32', '\x34', '\x29', '\x2E', '\x74', '\x6F', '\x46', '\x69', '\x78', '\x65', '\x64',
+    '\x28', '\x31', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x4B', '\x42', '\x27', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75',
+    '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x71', '\x75', '\x61', '\x6C', '\x69', '\x74', '\x79', '\x28', '\x72',
+    '\x73', '\x73', '\x69', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x28', '\x72',
+    '\x73', '\x73', '\x69', '\x20', '\x3C', '\x3D', '\x20', '\x2D', '\x31', '\x30', '\x30', '\x20', '\x3F', '\x20', '\x30', '\x20',
+    '\x3A', '\x20', '\x72', '\x73', '\x73', '\x69', '\x20', '\x3E', '\x3D', '\x20', '\x2D', '\x35', '\x30', '\x20', '\x3F', '\x20',
+    '\x31', '\x30', '\x30', '\x20', '\x3A', '\x20', '\x32', '\x20', '\x2A', '\x20', '\x28', '\x72', '\x73', '\x73', '\x69', '\x20',
+    '\x2B', '\x20', '\x31', '\x30', '\x30', '\x29', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x25', '\x27', '\x3B', '\x20', '\x7D',
+    '\x0A', '\x2F', '\x2F', '\x20', '\x5B', '\x6D', '\x69', '\x6E', '\x2C', '\x20', '\x61', '\x76', '\x67', '\x2C', '\x20', '\x6D',
+    '\x61', '\x78', '\x5D', '\x20', '\x6F', '\x66', '\x20', '\x74', '\x68', '\x65', '\x20', '\x6C', '\x61', '\x73', '\x74', '\x20',
+    '\x73', '\x61', '\x6D', '\x70', '\x6C', '\x65', '\x73', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E',
+    '\x20', '\x72', '\x61', '\x6E', '\x67', '\x65', '\x28', '\x66', '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x29', '\x20', '\x7B',
+    '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E',
+    '\x20', '\x28', '\x72', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x66', '\x6F',
+    '\x72', '\x6D', '\x61', '\x74', '\x28', '\x72', '\x5B', '\x30', '\x5D', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x20', '\x2D',
+    '\x20', '\x27', '\x20', '\x2B', '\x20', '\x66', '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x28', '\x72', '\x5B', '\x32', '\x5D',
+    '\x29', '\x20', '\x2B', '\x20', '\x27', '\x20', '\x28', '\x61', '\x76', '\x67', '\x20', '\x27', '\x20', '\x2B', '\x20', '\x66',
+    '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x28', '\x72', '\x5B', '\x31', '\x5D', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x29',
+    '\x27', '\x3B', '\x20', '\x7D', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E',
+    '\x20', '\x74', '\x69', '\x63', '\x6B', '\x28', '\x29', '\x20', '\x7B', '\x20', '\x24', '\x28', '\x27', '\x74', '\x69', '\x6D',
+    '\x65', '\x72', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74',
+    '\x20', '\x3D', '\x20', '\x74', '\x20', '\x3E', '\x3D', '\x20', '\x30', '\x20', '\x3F', '\x20', '\x4D', '\x61', '\x74', '\x68',
+    '\x2E', '\x66', '\x6C', '\x6F', '\x6F', '\x72', '\x28', '\x74', '\x20', '\x2F', '\x20', '\x36', '\x30', '\x29', '\x20', '\x2B',
+    '\x20', '\x27', '\x6D', '\x20', '\x27', '\x20', '\x2B', '\x20', '\x74', '\x20', '\x25', '\x20', '\x36', '\x30', '\x20', '\x2B',
+    '\x20', '\x27', '\x73', '\x27', '\x20', '\x3A', '\x20', '\x27', '\x27', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75', '\x6E',
+    '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x72', '\x65', '\x6E', '\x64', '\x65', '\x72', '\x28', '\x73', '\x29', '\x20',
+    '\x7B', '\x0A', '\x64', '\x6F', '\x63', '\x75', '\x6D', '\x65', '\x6E', '\x74', '\x2E', '\x74', '\x69', '\x74', '\x6C', '\x65',
+    '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x6E', '\x61', '\x6D', '\x65', '\x3B', '\x0A', '\x24', '\x28', '\x27', '\x6E', '\x61',
+    '\x6D', '\x65', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74',
+    '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x6E', '\x61', '\x6D', '\x65', '\x3B', '\x0A', '\x24', '\x28', '\x27', '\x61', '\x64',
+    '\x64', '\x72', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74',
+    '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x70', '\x68', '\x79', '\x73', '\x41', '\x64', '\x64', '\x72', '\x3B', '\x0A', '\x73',
+    '\x68', '\x6F', '\x77', '\x28', '\x27', '\x63', '\x66', '\x67', '\x27', '\x2C', '\x20', '\x21', '\x73', '\x2E', '\x63', '\x6F',
+    '\x6E', '\x66', '\x69', '\x67', '\x4F', '\x6B', '\x29', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77', '\x28', '\x27', '\x6D',
+    '\x6F', '\x64', '\x65', '\x27', '\x2C', '\x20', '\x27', '\x6D', '\x6F', '\x64', '\x65', '\x27', '\x20', '\x69', '\x6E', '\x20',
+    '\x73', '\x29', '\x3B', '\x0A', '\x66', '\x6F', '\x72', '\x20', '\x28', '\x76', '\x61', '\x72', '\x20', '\x69', '\x20', '\x3D',
+    '\x20', '\x30', '\x3B', '\x20', '\x69', '\x20', '\x3C', '\x20', '\x33', '\x3B', '\x20', '\x69', '\x2B', '\x2B', '\x29', '\x20',
+    '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x28', '\x24', '\x28', '\x27', '\x6D', '\x27', '\x20', '\x2B', '\x20', '\x69',
+    '\x29', '\x2C', '\x20', '\x6D', '\x6F', '\x64', '\x65', '\x73', '\x5B', '\x69', '\x5D', '\x20', '\x3D', '\x3D', '\x20', '\x73',
+    '\x2E', '\x6D', '\x6F', '\x64', '\x65', '\x2C', '\x20', '\x6D', '\x6F', '\x64', '\x65', '\x4C', '\x69', '\x6E', '\x6B', '\x73',
+    '\x5B', '\x69', '\x5D', '\x29', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77', '\x28', '\x27', '\x6F', '\x74', '\x61', '\x27',
+    '\x2C', '\x20', '\x27', '\x6F', '\x74', '\x61', '\x41', '\x63', '\x74', '\x69', '\x76', '\x65', '\x27', '\x20', '\x69', '\x6E',
+    '\x20', '\x73', '\x29', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77', '\x28', '\x27', '\x77', '\x75', '\x27', '\x2C', '\x20',
+    '\x21', '\x28', '\x27', '\x6F', '\x74', '\x61', '\x41', '\x63', '\x74', '\x69', '\x76', '\x65', '\x27', '\x20', '\x69', '\x6E',
+    '\x20', '\x73', '\x29', '\x29', '\x3B', '\x0A', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x28', '\x24', '\x28', '\x27',
+    '\x6F', '\x31', '\x27', '\x29', '\x2C', '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x41', '\x63', '\x74', '\x69', '\x76',
+    '\x65', '\x2C', '\x20', '\x27', '\x2F', '\x6F', '\x74', '\x61', '\x6F', '\x6E', '\x27', '\x29', '\x3B', '\x0A', '\x62', '\x75',
+    '\x74', '\x74', '\x6F', '\x6E', '\x28', '\x24', '\x28', '\x27', '\x6F', '\x30', '\x27', '\x29', '\x2C', '\x20', '\x21', '\x73',
+    '\x2E', '\x6F', '\x74', '\x61', '\x41', '\x63', '\x74', '\x69', '\x76', '\x65', '\x2C', '\x20', '\x27', '\x2F', '\x6F', '\x74',
+    '\x61', '\x6F', '\x66', '\x66', '\x27', '\x29', '\x3B', '\x0A', '\x24', '\x28', '\x27', '\x6F', '\x74', '\x61', '\x73', '\x74',
+    '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74', '\x20', '\x3D',
+    '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x53', '\x74', '\x61', '\x74', '\x65', '\x20', '\x3D', '\x3D', '\x20', '\x27',
+    '\x66', '\x61', '\x69', '\x6C', '\x65', '\x64', '\x27', '\x20', '\x3F', '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x45',
+    '\x72', '\x72', '\x6F', '\x72', '\x20', '\x3A', '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x53', '\x74', '\x61', '\x74',
+    '\x65', '\x20', '\x3D', '\x3D', '\x20', '\x27', '\x72', '\x75', '\x6E', '\x6E', '\x69', '\x6E', '\x67', '\x27', '\x20', '\x3F',
+    '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x50', '\x72', '\x6F', '\x67', '\x72', '\x65', '\x73', '\x73', '\x20', '\x2B',
+    '\x20', '\x27', '\x25', '\x27', '\x20', '\x3A', '\x20', '\x73', '\x2E', '\x6F', '\x74', '\x61', '\x53', '\x74', '\x61', '\x74',
+    '\x65', '\x20', '\x3D', '\x3D', '\x20', '\x27', '\x64', '\x6F', '\x6E', '\x65', '\x27', '\x20', '\x3F', '\x20', '\x27', '\x64',
+    '\x6F', '\x6E', '\x65', '\x27', '\x20', '\x3A', '\x20', '\x27', '\x27', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77', '\x28',
+    '\x27', '\x74', '\x75', '\x27', '\x2C', '\x20', '\x73', '\x2E', '\x74', '\x66', '\x74', '\x55', '\x70', '\x64', '\x61', '\x74',
+    '\x65', '\x29', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77', '\x28', '\x27', '\x74', '\x64', '\x27', '\x2C', '\x20', '\x73',
+    '\x2E', '\x74', '\x66', '\x74', '\x44', '\x65', '\x62', '\x75', '\x67', '\x29', '\x3B', '\x0A', '\x73', '\x68', '\x6F', '\x77',
+    '\x28', '\x27', '\x6C', '\x6F', '\x27', '\x2C', '\x20', '\x73', '\x2E', '\x61', '\x75', '\x74', '\x68', '\x29', '\x3B', '\x0A',
+    '\x24', '\x28', '\x27', '\x63', '\x68', '\x69', '\x70', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F',
+    '\x6E', '\x74', '\x65', '\x6E', '\x74', '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x63', '\x68', '\x69', '\x70', '\x20', '\x2B',
+    '\x20', '\x27', '\x20', '\x43', '\x68', '\x69', '\x70', '\x20', '\x49', '\x6E', '\x66', '\x6F', '\x27', '\x3B', '\x0A', '\x76',
+    '\x61', '\x72', '\x20', '\x6C', '\x69', '\x6E', '\x65', '\x73', '\x20', '\x3D', '\x20', '\x5B', '\x5D', '\x3B', '\x0A', '\x66',
+    '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x61', '\x64', '\x64', '\x28', '\x6E', '\x61', '\x6D', '\x65',
+    '\x2C', '\x20', '\x6B', '\x65', '\x79', '\x2C', '\x20', '\x66', '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x29', '\x20', '\x7B',
+    '\x20', '\x69', '\x66', '\x20', '\x28', '\x6B', '\x65', '\x79', '\x20', '\x69', '\x6E', '\x20', '\x73', '\x29', '\x20', '\x6C',
+    '\x69', '\x6E', '\x65', '\x73', '\x2E', '\x70', '\x75', '\x73', '\x68', '\x28', '\x6E', '\x61', '\x6D', '\x65', '\x20', '\x2B',
+    '\x20', '\x27', '\x3A', '\x20', '\x27', '\x20', '\x2B', '\x20', '\x28', '\x66', '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x20',
+    '\x3F', '\x20', '\x66', '\x6F', '\x72', '\x6D', '\x61', '\x74', '\x28', '\x73', '\x5B', '\x6B', '\x65', '\x79', '\x5D', '\x29',
+    '\x20', '\x3A', '\x20', '\x73', '\x5B', '\x6B', '\x65', '\x79', '\x5D', '\x29', '\x29', '\x3B', '\x20', '\x7D', '\x0A', '\x61',
+    '\x64', '\x64', '\x28', '\x27', '\x46', '\x6C', '\x61', '\x73', '\x68', '\x20', '\x73', '\x69', '\x7A', '\x65', '\x27', '\x2C',
+    '\x20', '\x27', '\x66', '\x6C', '\x61', '\x73', '\x68', '\x27', '\x2C', '\x20', '\x6D', '\x62', '\x29', '\x3B', '\x0A', '\x61',
+    '\x64', '\x64', '\x28', '\x27', '\x50', '\x53', '\x52', '\x41', '\x4D', '\x20', '\x73', '\x69', '\x7A', '\x65', '\x27', '\x2C',
+    '\x20', '\x27', '\x70', '\x73', '\x72', '\x61', '\x6D', '\x27', '\x2C', '\x20', '\x6D', '\x62', '\x29', '\x3B', '\x0A', '\x61',
+    '\x64', '\x64', '\x28', '\x27', '\x46', '\x72', '\x65', '\x65', '\x20', '\x50', '\x53', '\x52', '\x41', '\x4D', '\x27', '\x2C',
+    '\x20', '\x27', '\x66', '\x72', '\x65', '\x65', '\x50', '\x73', '\x72', '\x61', '\x6D', '\x27', '\x2C', '\x20', '\x6D', '\x62',
+    '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x48', '\x65', '\x61', '\x70', '\x20', '\x73', '\x69', '\x7A',
+    '\x65', '\x27', '\x2C', '\x20', '\x27', '\x68', '\x65', '\x61', '\x70', '\x53', '\x69', '\x7A', '\x65', '\x27', '\x2C', '\x20',
+    '\x6B', '\x62', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x46', '\x72', '\x65', '\x65', '\x20', '\x68',
+    '\x65', '\x61', '\x70', '\x27', '\x2C', '\x20', '\x27', '\x68', '\x65', '\x61', '\x70', '\x27', '\x2C', '\x20', '\x6B', '\x62',
+    '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x46', '\x72', '\x65', '\x65', '\x20', '\x68', '\x65', '\x61',
+    '\x70', '\x20', '\x72', '\x61', '\x6E', '\x67', '\x65', '\x27', '\x2C', '\x20', '\x27', '\x68', '\x65', '\x61', '\x70', '\x52',
+    '\x61', '\x6E', '\x67', '\x65', '\x27', '\x2C', '\x20', '\x72', '\x61', '\x6E', '\x67', '\x65', '\x28', '\x6B', '\x62', '\x29',
+    '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x43', '\x68', '\x69', '\x70', '\x20', '\x74', '\x65', '\x6D',
+    '\x70', '\x65', '\x72', '\x61', '\x74', '\x75', '\x72', '\x65', '\x27', '\x2C', '\x20', '\x27', '\x74', '\x65', '\x6D', '\x70',
+    '\x27', '\x2C', '\x20', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x76', '\x29', '\x20',
+    '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x76', '\x2E', '\x74', '\x6F', '\x46', '\x69', '\x78',
+    '\x65', '\x64', '\x28', '\x31', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x5C', '\x75', '\x30', '\x30', '\x62', '\x30', '\x43',
+    '\x27', '\x3B', '\x20', '\x7D', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x43', '\x50', '\x55', '\x20',
+    '\x66', '\x72', '\x65', '\x71', '\x75', '\x65', '\x6E', '\x63', '\x79', '\x27', '\x2C', '\x20', '\x27', '\x63', '\x70', '\x75',
+    '\x27', '\x2C', '\x20', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x76', '\x29', '\x20',
+    '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x76', '\x20', '\x2B', '\x20', '\x27', '\x4D', '\x48',
+    '\x7A', '\x27', '\x3B', '\x20', '\x7D', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x57', '\x49', '\x46',
+    '\x49', '\x20', '\x4D', '\x41', '\x43', '\x27', '\x2C', '\x20', '\x27', '\x6D', '\x61', '\x63', '\x27', '\x29', '\x3B', '\x0A',
+    '\x61', '\x64', '\x64', '\x28', '\x27', '\x57', '\x49', '\x46', '\x49', '\x20', '\x53', '\x69', '\x67', '\x6E', '\x61', '\x6C',
+    '\x27', '\x2C', '\x20', '\x27', '\x72', '\x73', '\x73', '\x69', '\x27', '\x2C', '\x20', '\x71', '\x75', '\x61', '\x6C', '\x69',
+    '\x74', '\x79', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x57', '\x49', '\x46', '\x49', '\x20', '\x53',
+    '\x69', '\x67', '\x6E', '\x61', '\x6C', '\x20', '\x72', '\x61', '\x6E', '\x67', '\x65', '\x27', '\x2C', '\x20', '\x27', '\x72',
+    '\x73', '\x73', '\x69', '\x52', '\x61', '\x6E', '\x67', '\x65', '\x27', '\x2C', '\x20', '\x72', '\x61', '\x6E', '\x67', '\x65',
+    '\x28', '\x71', '\x75', '\x61', '\x6C', '\x69', '\x74', '\x79', '\x29', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28',
+    '\x27', '\x53', '\x44', '\x4B', '\x20', '\x56', '\x65', '\x72', '\x73', '\x69', '\x6F', '\x6E', '\x27', '\x2C', '\x20', '\x27',
+    '\x73', '\x64', '\x6B', '\x27', '\x29', '\x3B', '\x0A', '\x61', '\x64', '\x64', '\x28', '\x27', '\x4C', '\x61', '\x73', '\x74',
+    '\x20', '\x72', '\x65', '\x73', '\x74', '\x61', '\x72', '\x74', '\x20', '\x72', '\x65', '\x61', '\x73', '\x6F', '\x6E', '\x27',
+    '\x2C', '\x20', '\x27', '\x72', '\x65', '\x73', '\x65', '\x74', '\x52', '\x65', '\x61', '\x73', '\x6F', '\x6E', '\x27', '\x29',
+    '\x3B', '\x0A', '\x24', '\x28', '\x27', '\x69', '\x6E', '\x66', '\x6F', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74',
+    '\x43', '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74', '\x20', '\x3D', '\x20', '\x6C', '\x69', '\x6E', '\x65', '\x73', '\x2E',
+    '\x6A', '\x6F', '\x69', '\x6E', '\x28', '\x27', '\x5C', '\x6E', '\x27', '\x29', '\x3B', '\x0A', '\x24', '\x28', '\x27', '\x62',
+    '\x75', '\x69', '\x6C', '\x64', '\x27', '\x29', '\x2E', '\x74', '\x65', '\x78', '\x74', '\x43', '\x6F', '\x6E', '\x74', '\x65',
+    '\x6E', '\x74', '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x62', '\x75', '\x69', '\x6C', '\x64', '\x3B', '\x0A', '\x7D', '\x0A',
+    '\x2F', '\x2F', '\x20', '\x4D', '\x65', '\x72', '\x67', '\x65', '\x73', '\x20', '\x61', '\x20', '\x66', '\x75', '\x6C', '\x6C',
+    '\x20', '\x73', '\x74', '\x61', '\x74', '\x75', '\x73', '\x20', '\x6F', '\x72', '\x20', '\x61', '\x20', '\x70', '\x75', '\x73',
+    '\x68', '\x65', '\x64', '\x20', '\x64', '\x65', '\x6C', '\x74', '\x61', '\x2C', '\x20', '\x74', '\x68', '\x65', '\x20', '\x4F',
+    '\x54', '\x41', '\x20', '\x63', '\x6F', '\x75', '\x6E', '\x74', '\x64', '\x6F', '\x77', '\x6E', '\x20', '\x72', '\x65', '\x73',
+    '\x74', '\x61', '\x72', '\x74', '\x73', '\x20', '\x77', '\x68', '\x65', '\x6E', '\x20', '\x74', '\x68', '\x65', '\x20', '\x73',
+    '\x65', '\x72', '\x76', '\x65', '\x72', '\x20', '\x73', '\x65', '\x6E', '\x64', '\x73', '\x20', '\x61', '\x20', '\x6E', '\x65',
+    '\x77', '\x20', '\x72', '\x65', '\x6D', '\x61', '\x69', '\x6E', '\x69', '\x6E', '\x67', '\x20', '\x74', '\x69', '\x6D', '\x65',
+    '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65',
+    '\x28', '\x73', '\x29', '\x20', '\x7B', '\x0A', '\x66', '\x6F', '\x72', '\x20', '\x28', '\x76', '\x61', '\x72', '\x20', '\x6B',
+    '\x20', '\x69', '\x6E', '\x20', '\x73', '\x29', '\x20', '\x73', '\x74', '\x61', '\x74', '\x65', '\x5B', '\x6B', '\x5D', '\x20',
+    '\x3D', '\x20', '\x73', '\x5B', '\x6B', '\x5D', '\x3B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x27', '\x6F', '\x74', '\x61',
+    '\x41', '\x63', '\x74', '\x69', '\x76', '\x65', '\x27', '\x20', '\x69', '\x6E', '\x20', '\x73', '\x29', '\x20', '\x7B', '\x20',
+    '\x74', '\x20', '\x3D', '\x20', '\x73', '\x74', '\x61', '\x74', '\x65', '\x2E', '\x6F', '\x74', '\x61', '\x41', '\x63', '\x74',
+    '\x69', '\x76', '\x65', '\x20', '\x3F', '\x20', '\x73', '\x74', '\x61', '\x74', '\x65', '\x2E', '\x6F', '\x74', '\x61', '\x52',
+    '\x65', '\x6D', '\x61', '\x69', '\x6E', '\x69', '\x6E', '\x67', '\x20', '\x3A', '\x20', '\x2D', '\x31', '\x3B', '\x20', '\x74',
+    '\x69', '\x63', '\x6B', '\x28', '\x29', '\x3B', '\x20', '\x7D', '\x0A', '\x72', '\x65', '\x6E', '\x64', '\x65', '\x72', '\x28',
+    '\x73', '\x74', '\x61', '\x74', '\x65', '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69',
+    '\x6F', '\x6E', '\x20', '\x67', '\x65', '\x74', '\x28', '\x75', '\x72', '\x6C', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65',
+    '\x74', '\x75', '\x72', '\x6E', '\x20', '\x66', '\x65', '\x74', '\x63', '\x68', '\x28', '\x75', '\x72', '\x6C', '\x29', '\x2E',
+    '\x74', '\x68', '\x65', '\x6E', '\x28', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x72',
+    '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x72', '\x2E', '\x6A', '\x73', '\x6F',
+    '\x6E', '\x28', '\x29', '\x3B', '\x20', '\x7D', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x75', '\x70', '\x64',
+    '\x61', '\x74', '\x65', '\x29', '\x3B', '\x20', '\x7D', '\x0A', '\x2F', '\x2F', '\x20', '\x54', '\x68', '\x65', '\x20', '\x69',
+    '\x64', '\x65', '\x6E', '\x74', '\x69', '\x74', '\x79', '\x20', '\x64', '\x6F', '\x65', '\x73', '\x20', '\x6E', '\x6F', '\x74',
+    '\x20', '\x63', '\x68', '\x61', '\x6E', '\x67', '\x65', '\x2C', '\x20', '\x6F', '\x6E', '\x6C', '\x79', '\x20', '\x74', '\x68',
+    '\x65', '\x20', '\x73', '\x74', '\x61', '\x74', '\x75', '\x73', '\x20', '\x69', '\x73', '\x20', '\x70', '\x6F', '\x6C', '\x6C',
+    '\x65', '\x64', '\x20', '\x61', '\x67', '\x61', '\x69', '\x6E', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F',
+    '\x6E', '\x20', '\x6C', '\x6F', '\x61', '\x64', '\x28', '\x29', '\x20', '\x7B', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72',
+    '\x6E', '\x20', '\x67', '\x65', '\x74', '\x28', '\x27', '\x2F', '\x61', '\x70', '\x69', '\x2F', '\x73', '\x74', '\x61', '\x74',
+    '\x75', '\x73', '\x27', '\x29', '\x3B', '\x20', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E',
+    '\x20', '\x6C', '\x69', '\x73', '\x74', '\x65', '\x6E', '\x28', '\x29', '\x20', '\x7B', '\x0A', '\x69', '\x66', '\x20', '\x28',
+    '\x21', '\x77', '\x69', '\x6E', '\x64', '\x6F', '\x77', '\x2E', '\x45', '\x76', '\x65', '\x6E', '\x74', '\x53', '\x6F', '\x75',
+    '\x72', '\x63', '\x65', '\x29', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x3B', '\x0A', '\x65', '\x76', '\x65',
+    '\x6E', '\x74', '\x73', '\x20', '\x3D', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x45', '\x76', '\x65', '\x6E', '\x74', '\x53',
+    '\x6F', '\x75', '\x72', '\x63', '\x65', '\x28', '\x27', '\x2F', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x73', '\x27', '\x29',
+    '\x3B', '\x0A', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x73', '\x2E', '\x61', '\x64', '\x64', '\x45', '\x76', '\x65', '\x6E',
+    '\x74', '\x4C', '\x69', '\x73', '\x74', '\x65', '\x6E', '\x65', '\x72', '\x28', '\x27', '\x73', '\x74', '\x61', '\x74', '\x75',
+    '\x73', '\x27', '\x2C', '\x20', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x65', '\x29',
+    '\x20', '\x7B', '\x20', '\x75', '\x70', '\x64', '\x61', '\x74', '\x65', '\x28', '\x4A', '\x53', '\x4F', '\x4E', '\x2E', '\x70',
+    '\x61', '\x72', '\x73', '\x65', '\x28', '\x65', '\x2E', '\x64', '\x61', '\x74', '\x61', '\x29', '\x29', '\x3B', '\x20', '\x7D',
+    '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x2F', '\x2F', '\x20', '\x57', '\x69', '\x74', '\x68', '\x20', '\x74', '\x68', '\x65',
+    '\x20', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x20', '\x73', '\x74', '\x72', '\x65', '\x61', '\x6D', '\x20', '\x74', '\x68',
+    '\x65', '\x20', '\x62', '\x75', '\x74', '\x74', '\x6F', '\x6E', '\x73', '\x20', '\x6F', '\x6E', '\x6C', '\x79', '\x20', '\x73',
+    '\x65', '\x6E', '\x64', '\x20', '\x74', '\x68', '\x65', '\x20', '\x63', '\x6F', '\x6D', '\x6D', '\x61', '\x6E', '\x64', '\x2C',
+    '\x20', '\x74', '\x68', '\x65', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x73', '\x74', '\x61', '\x74', '\x65', '\x20', '\x69',
+    '\x73', '\x20', '\x70', '\x75', '\x73', '\x68', '\x65', '\x64', '\x20', '\x62', '\x61', '\x63', '\x6B', '\x0A', '\x76', '\x61',
+    '\x72', '\x20', '\x63', '\x6F', '\x6D', '\x6D', '\x61', '\x6E', '\x64', '\x73', '\x20', '\x3D', '\x20', '\x7B', '\x20', '\x6D',
+    '\x30', '\x3A', '\x20', '\x7B', '\x20', '\x6B', '\x6E', '\x78', '\x4D', '\x6F', '\x64', '\x65', '\x3A', '\x20', '\x27', '\x6F',
+    '\x66', '\x66', '\x27', '\x20', '\x7D', '\x2C', '\x20', '\x6D', '\x31', '\x3A', '\x20', '\x7B', '\x20', '\x6B', '\x6E', '\x78',
+    '\x4D', '\x6F', '\x64', '\x65', '\x3A', '\x20', '\x27', '\x6E', '\x6F', '\x72', '\x6D', '\x61', '\x6C', '\x27', '\x20', '\x7D',
+    '\x2C', '\x20', '\x6D', '\x32', '\x3A', '\x20', '\x7B', '\x20', '\x6B', '\x6E', '\x78', '\x4D', '\x6F', '\x64', '\x65', '\x3A',
+    '\x20', '\x27', '\x70', '\x72', '\x6F', '\x67', '\x27', '\x20', '\x7D', '\x2C', '\x20', '\x6F', '\x30', '\x3A', '\x20', '\x7B',
+    '\x20', '\x6F', '\x74', '\x61', '\x3A', '\x20', '\x66', '\x61', '\x6C', '\x73', '\x65', '\x20', '\x7D', '\x2C', '\x20', '\x6F',
+    '\x31', '\x3A', '\x20', '\x7B', '\x20', '\x6F', '\x74', '\x61', '\x3A', '\x20', '\x74', '\x72', '\x75', '\x65', '\x20', '\x7D',
+    '\x20', '\x7D', '\x3B', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x61', '\x63', '\x74',
+    '\x69', '\x6F', '\x6E', '\x28', '\x65', '\x29', '\x20', '\x7B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x21', '\x65', '\x2E',
+    '\x63', '\x75', '\x72', '\x72', '\x65', '\x6E', '\x74', '\x54', '\x61', '\x72', '\x67', '\x65', '\x74', '\x2E', '\x67', '\x65',
+    '\x74', '\x41', '\x74', '\x74', '\x72', '\x69', '\x62', '\x75', '\x74', '\x65', '\x28', '\x27', '\x68', '\x72', '\x65', '\x66',
+    '\x27', '\x29', '\x20', '\x7C', '\x7C', '\x20', '\x21', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x73', '\x29', '\x20', '\x72',
+    '\x65', '\x74', '\x75', '\x72', '\x6E', '\x3B', '\x0A', '\x65', '\x2E', '\x70', '\x72', '\x65', '\x76', '\x65', '\x6E', '\x74',
+    '\x44', '\x65', '\x66', '\x61', '\x75', '\x6C', '\x74', '\x28', '\x29', '\x3B', '\x0A', '\x66', '\x65', '\x74', '\x63', '\x68',
+    '\x28', '\x27', '\x2F', '\x61', '\x70', '\x69', '\x2F', '\x63', '\x6F', '\x6D', '\x6D', '\x61', '\x6E', '\x64', '\x27', '\x2C',
+    '\x20', '\x7B', '\x20', '\x6D', '\x65', '\x74', '\x68', '\x6F', '\x64', '\x3A', '\x20', '\x27', '\x50', '\x4F', '\x53', '\x54',
+    '\x27', '\x2C', '\x20', '\x68', '\x65', '\x61', '\x64', '\x65', '\x72', '\x73', '\x3A', '\x20', '\x7B', '\x20', '\x27', '\x43',
+    '\x6F', '\x6E', '\x74', '\x65', '\x6E', '\x74', '\x2D', '\x54', '\x79', '\x70', '\x65', '\x27', '\x3A', '\x20', '\x27', '\x61',
+    '\x70', '\x70', '\x6C', '\x69', '\x63', '\x61', '\x74', '\x69', '\x6F', '\x6E', '\x2F', '\x6A', '\x73', '\x6F', '\x6E', '\x27',
+    '\x20', '\x7D', '\x2C', '\x20', '\x62', '\x6F', '\x64', '\x79', '\x3A', '\x20', '\x4A', '\x53', '\x4F', '\x4E', '\x2E', '\x73',
+    '\x74', '\x72', '\x69', '\x6E', '\x67', '\x69', '\x66', '\x79', '\x28', '\x63', '\x6F', '\x6D', '\x6D', '\x61', '\x6E', '\x64',
+    '\x73', '\x5B', '\x65', '\x2E', '\x63', '\x75', '\x72', '\x72', '\x65', '\x6E', '\x74', '\x54', '\x61', '\x72', '\x67', '\x65',
+    '\x74', '\x2E', '\x69', '\x64', '\x5D', '\x29', '\x20', '\x7D', '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x4F', '\x62', '\x6A',
+    '\x65', '\x63', '\x74', '\x2E', '\x6B', '\x65', '\x79', '\x73', '\x28', '\x63', '\x6F', '\x6D', '\x6D', '\x61', '\x6E', '\x64',
+    '\x73', '\x29', '\x2E', '\x66', '\x6F', '\x72', '\x45', '\x61', '\x63', '\x68', '\x28', '\x66', '\x75', '\x6E', '\x63', '\x74',
+    '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x69', '\x64', '\x29', '\x20', '\x7B', '\x20', '\x24', '\x28', '\x69', '\x64', '\x29',
+    '\x2E', '\x61', '\x64', '\x64', '\x45', '\x76', '\x65', '\x6E', '\x74', '\x4C', '\x69', '\x73', '\x74', '\x65', '\x6E', '\x65',
+    '\x72', '\x28', '\x27', '\x63', '\x6C', '\x69', '\x63', '\x6B', '\x27', '\x2C', '\x20', '\x61', '\x63', '\x74', '\x69', '\x6F',
+    '\x6E', '\x29', '\x3B', '\x20', '\x7D', '\x29', '\x3B', '\x0A', '\x73', '\x65', '\x74', '\x49', '\x6E', '\x74', '\x65', '\x72',
+    '\x76', '\x61', '\x6C', '\x28', '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x28', '\x29', '\x20',
+    '\x7B', '\x20', '\x69', '\x66', '\x20', '\x28', '\x74', '\x20', '\x3E', '\x20', '\x30', '\x29', '\x20', '\x7B', '\x20', '\x74',
+    '\x2D', '\x2D', '\x3B', '\x20', '\x74', '\x69', '\x63', '\x6B', '\x28', '\x29', '\x3B', '\x20', '\x7D', '\x20', '\x65', '\x6C',
+    '\x73', '\x65', '\x20', '\x69', '\x66', '\x20', '\x28', '\x74', '\x20', '\x3D', '\x3D', '\x20', '\x30', '\x20', '\x26', '\x26',
+    '\x20', '\x21', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x73', '\x29', '\x20', '\x7B', '\x20', '\x74', '\x20', '\x3D', '\x20',
+    '\x2D', '\x31', '\x3B', '\x20', '\x6C', '\x6F', '\x61', '\x64', '\x28', '\x29', '\x3B', '\x20', '\x7D', '\x20', '\x7D', '\x2C',
+    '\x20', '\x31', '\x30', '\x30', '\x30', '\x29', '\x3B', '\x0A', '\x67', '\x65', '\x74', '\x28', '\x27', '\x2F', '\x61', '\x70',
+    '\x69', '\x2F', '\x69', '\x6E', '\x66', '\x6F', '\x27', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x6C', '\x6F',
+    '\x61', '\x64', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x6C', '\x69', '\x73', '\x74', '\x65', '\x6E', '\x29',
+    '\x3B', '\x0A', '\x3C', '\x2F', '\x73', '\x63', '\x72', '\x69', '\x70', '\x74', '\x3E', '\x0A', '\x3C', '\x2F', '\x62', '\x6F',
+    '\x64', '\x79', '\x3E', '\x0A', '\x3C', '\x2F', '\x68', '\x74', '\x6D', '\x6C', '\x3E',
+};
+constexpr size_t ROOT_HTML_LEN = sizeof(ROOT_HTML);
+constexpr char ROOT_HTML_GZ[] PROGMEM = {
+    '\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x8D', '\x58', '\x59', '\x77', '\xDB', '\xB8',
+    '\x15', '\x7E', '\xD7', '\xAF', '\x80', '\x35', '\x9D', '\x21', '\xD5', '\x68', '\xF5', '\x92', '\x26', '\xDA', '\xA6', '\x9E',
+    '\xC4', '\x6E', '\xD2', '\xC4', '\xB1', '\x8F', '\xED', '\x34', '\xED', '\xF1', '\xF8', '\xF4', '\x40', '\x24', '\x24', '\x21',
+    '\xE2', '\x36', '\x24', '\x28', '\x45', '\xE3', '\xC9', '\x7F', '\xEF', '\x77', '\x2F', '\x48', '\x89', '\xB2', '\xE5', '\x9E',
+    '\xF1', '\x83', '\x09', '\xDC', '\x1D', '\x17', '\x77', '\x83', '\x86', '\x07', '\x6F', '\x2F', '\xDF', '\xDC', '\xFE', '\xE7',
+    '\xEA', '\x4C', '\xCC', '\x4D', '\x18', '\x8C', '\x87', '\xFC', '\xBF', '\x36', '\x9C', '\x2B', '\xE9', '\x8F', '\x87', '\xA1',
+    '\x32', '\x52', '\x44', '\x32', '\x54', '\xA3', '\xFA', '\x52', '\xAB', '\x55', '\x12', '\xA7', '\xA6', '\x2E', '\xBC', '\x38',
+    '\x32', '\x2A', '\x32', '\xA3', '\xFA', '\x4A', '\xFB', '\x66', '\x3E', '\xF2', '\xD5', '\x52', '\x7B', '\xAA', '\xC5', '\x9B',
+    '\xA6', '\xD0', '\x91', '\x36', '\x5A', '\x06', '\xAD', '\xCC', '\x93', '\x81', '\x1A', '\xF5', '\xDA', '\xDD', '\xA6', '\xC8',
+    '\x33', '\x95', '\xF2', '\x5E', '\x4E', '\x00', '\x8A', '\xE2', '\x3A', '\xC4', '\x07', '\x3A', '\x5A', '\x88', '\x54', '\x05',
+    '\x23', '\x47', '\x43', '\x9C', '\x23', '\xE6', '\xA9', '\x9A', '\x8E', '\x9C', '\xCE', '\x54', '\x2E', '\x69', '\xDF', '\xC6',
+    '\x3F', '\x47', '\x64', '\xFA', '\x77', '\x95', '\x8D', '\x1C', '\x19', '\xAD', '\x1D', '\x70', '\x18', '\x6D', '\x02', '\x35',
+    '\x3E', '\xBB', '\xB9', '\x6A', '\x7D', '\xF8', '\xF4', '\xEF', '\xD6', '\x5B', '\x56', '\x3A', '\xEC', '\x58', '\x68', '\x6D',
+    '\x98', '\x99', '\x35', '\xBE', '\x64', '\xBB', '\x78', '\x98', '\xC2', '\xBE', '\xD6', '\x54', '\x86', '\x3A', '\x58', '\xF7',
+    '\xC5', '\x3B', '\x15', '\x2C', '\x95', '\xD1', '\x9E', '\x1C', '\x08', '\x5F', '\x67', '\x49', '\x20', '\x01', '\xD3', '\x11',
+    '\xD4', '\xAB', '\xD6', '\x24', '\x88', '\xBD', '\xC5', '\x00', '\xC7', '\x09', '\xE2', '\xB4', '\x2F', '\x7E', '\x38', '\xE6',
+    '\xBF', '\x81', '\x30', '\xEA', '\x9B', '\x69', '\xC9', '\x40', '\xCF', '\xA2', '\xBE', '\xF0', '\x70', '\x4E', '\x95', '\x0E',
+    '\xBE', '\xD7', '\xE6', '\x3D', '\xF1', '\x10', '\xCA', '\x74', '\xA6', '\x01', '\x3C', '\xE9', '\x26', '\xDF', '\x84', '\xCC',
+    '\x4D', '\x2C', '\x8E', '\xB0', '\x02', '\xB2', '\x3D', '\xC9', '\x8D', '\x89', '\x23', '\xF1', '\xB0', '\x5F', '\x03', '\x7B',
+    '\xA6', '\x2F', '\x5E', '\x11', '\xF1', '\x44', '\x7A', '\x8B', '\x59', '\x1A', '\xE7', '\x91', '\xDF', '\x2A', '\xF5', '\x1E',
+    '\x1D', '\xBF', '\x7E', '\xE5', '\x4F', '\x06', '\x93', '\x38', '\xF5', '\x15', '\xF6', '\x51', '\x1C', '\xA9', '\x41', '\x81',
+    '\x5B', '\xCD', '\xB5', '\x51', '\x83', '\x44', '\xFA', '\xBE', '\x8E', '\x66', '\x7D', '\xD1', '\x3B', '\x82', '\x62', '\xD6',
+    '\xC9', '\x36', '\xFA', '\xCA', '\x8B', '\x53', '\x69', '\x74', '\x1C', '\x15', '\x5C', '\x7C', '\x70', '\xF2', '\x5A', '\x5F',
+    '\x1C', '\x9E', '\x80', '\xAA', '\x34', '\x98', '\xEC', '\x3D', '\x21', '\xD6', '\x13', '\xBB', '\x18', '\x78', '\x79', '\x9A',
+    '\x91', '\xFC', '\x24', '\xD6', '\x7C', '\x3E', '\xAB', '\xBB', '\x95', '\x4A', '\x5F', '\xE7', '\x59', '\x5F', '\x1C', '\x57',
+    '\x4F', '\x85', '\x43', '\xE4', '\x4A', '\x3C', '\x3C', '\x6F', '\xB8', '\x28', '\xA5', '\x45', '\x31', '\xF9', '\x2D', '\x88',
+    '\x57', '\xCA', '\x17', '\x15', '\x7E', '\x5F', '\xA6', '\x8B', '\x67', '\xF8', '\x8F', '\x5F', '\x9F', '\xA8', '\x47', '\x94',
+    '\x7D', '\xE9', '\x19', '\xBD', '\xDC', '\xAF', '\xF0', '\xD0', '\x3B', '\x52', '\x27', '\x5D', '\x62', '\x58', '\xC9', '\x34',
+    '\x82', '\x4B', '\xC4', '\x43', '\x89', '\x92', '\xAF', '\x8F', '\x0E', '\x0F', '\x5F', '\x02', '\x95', '\x14', '\xF7', '\x6F',
+    '\xDD', '\xD0', '\xA3', '\xA3', '\x94', '\x34', '\xAF', '\x5E', '\xBD', '\x2A', '\x5C', '\xD2', '\x9A', '\xC4', '\x50', '\x18',
+    '\x02', '\x6F', '\x2F', '\xF0', '\x07', '\x1D', '\x4D', '\x63', '\xF1', '\xC0', '\xEE', '\x6E', '\x65', '\x89', '\xF4', '\xC0',
+    '\x9A', '\xA4', '\xAA', '\x45', '\x97', '\x08', '\xF4', '\xDD', '\x5C', '\xFB', '\xBE', '\x8A', '\xEE', '\x2B', '\x17', '\x4C',
+    '\xFE', '\x16', '\x07', '\x3A', '\xA4', '\x8C', '\x90', '\x91', '\x01', '\xD1', '\xB0', '\x63', '\x63', '\x10', '\x0B', '\xCE',
+    '\x9D', '\xDA', '\x70', '\x12', '\xFB', '\x6B', '\xCA', '\xA4', '\x1E', '\x45', '\xAD', '\x98', '\xC8', '\x0C', '\x7E', '\x41',
+    '\xEC', '\x0A', '\xBF', '\x88', '\x5D', '\x20', '\x80', '\x3D', '\x1A', '\x7F', '\x42', '\x7E', '\xF5', '\xC5', '\x10', '\x7A',
+    '\x23', '\xA1', '\xFD', '\x51', '\x9D', '\xF2', '\xAD', '\x3E', '\x86', '\x3C', '\x00', '\xF0', '\x01', '\x05', '\x93', '\x5D',
+    '\xCD', '\xD7', '\x19', '\xE2', '\x38', '\x10', '\x08', '\x87', '\x54', '\x65', '\x59', '\x95', '\x85', '\x40', '\x4F', '\x59',
+    '\x84', '\x17', '\xC8', '\x2C', '\x43', '\x9E', '\x5A', '\x6F', '\xD5', '\x99', '\xD4', '\x9B', '\x62', '\x61', '\x0F', '\x34',
+    '\x26', '\x6B', '\x90', '\x6E', '\x53', '\x3D', '\xCB', '\x6D', '\x20', '\x21', '\x70', '\xBD', '\x38', '\x4C', '\x02', '\x65',
+    '\xD4', '\x41', '\x21', '\xC6', '\xD7', '\x4B', '\xE6', '\x0B', '\x63', '\x5F', '\x6D', '\x18', '\x87', '\x09', '\xF3', '\x5E',
+    '\x00', '\xD6', '\x1F', '\x76', '\x92', '\xF1', '\x50', '\x96', '\xBA', '\xEC', '\x55', '\x5A', '\x55', '\xE1', '\x61', '\x7D',
+    '\x7C', '\x75', '\x7D', '\xF9', '\x8F', '\x61', '\x47', '\x3E', '\x47', '\xD1', '\xAB', '\x8F', '\x3F', '\xC5', '\x69', '\x28',
+    '\x83', '\xFF', '\x43', '\xD3', '\xAD', '\x8F', '\x2F', '\xCF', '\xCF', '\x99', '\xA0', '\x03', '\x6B', '\x2A', '\x36', '\xC5',
+    '\x46', '\x56', '\x4D', '\xBA', '\xBC', '\x3D', '\xAD', '\x3A', '\xC5', '\xE8', '\x50', '\x6D', '\xBD', '\x52', '\x41', '\x80',
+    '\x2D', '\x33', '\x15', '\x77', '\x3D', '\x67', '\x7F', '\x0C', '\xEB', '\x2E', '\x3F', '\x3D', '\x6F', '\x59', '\xFC', '\xD4',
+    '\xB2', '\x84', '\x11', '\xAB', '\x7C', '\x63', '\xD6', '\x17', '\x35', '\xC9', '\x13', '\x5F', '\x1A', '\xEB', '\xA7', '\xDA',
+    '\x63', '\x41', '\xA2', '\x12', '\xFA', '\x75', '\x5B', '\x05', '\xEB', '\x9D', '\x55', '\xC9', '\x53', '\x1F', '\x7F', '\x4E',
+    '\x82', '\x58', '\xFA', '\xA4', '\x01', '\xB2', '\xC7', '\x37', '\xEB', '\xCC', '\xA8', '\x70', '\xAF', '\xC7', '\xF7', '\x0A',
+    '\x42', '\x98', '\x18', '\x89', '\x92', '\x3D', '\xBE', '\xB6', '\x8B', '\x7D', '\x47', '\xD9', '\x65', '\x64', '\xBF', '\xE5',
+    '\x1B', '\x01', '\x66', '\x6A', '\x0A', '\x4B', '\xCA', '\xF3', '\xDC', '\x9E', '\xDF', '\x8A', '\xCF', '\x0C', '\xFA', '\x93',
+    '\xC2', '\xFC', '\xAA', '\x30', '\x1F', '\x27', '\x9B', '\xED', '\xC8', '\x7A', '\x4B', '\x90', '\x3F', '\x27', '\x2A', '\x88',
+    '\x4B', '\x4E', '\x11', '\x47', '\x5E', '\xA0', '\xBD', '\xC5', '\xA8', '\x3E', '\x55', '\xC6', '\x9B', '\xBB', '\x4E', '\x27',
+    '\x88', '\x67', '\x71', '\x6E', '\x9C', '\x46', '\xDB', '\xCC', '\x55', '\xE4', '\x4E', '\xF3', '\xC8', '\xE3', '\x70', '\x76',
+    '\x1B', '\xE2', '\x41', '\xAC', '\x74', '\xE4', '\xC7', '\xAB', '\x76', '\x9C', '\x00', '\xE3', '\xCC', '\x8D', '\x49', '\xFA',
+    '\x9D', '\x82', '\xFE', '\xEF', '\x8E', '\x78', '\x51', '\xA2', '\x51', '\xAA', '\x39', '\x05', '\xDA', '\xF3', '\x38', '\x33',
+    '\x4D', '\xE1', '\xFC', '\x37', '\x53', '\xC1', '\xD4', '\x69', '\x0C', '\xC4', '\xF7', '\xC6', '\xA0', '\x3E', '\xFE', '\xC8',
+    '\xF4', '\xF6', '\x1E', '\x90', '\x58', '\x9C', '\x48', '\x73', '\x9D', '\xD4', '\xCB', '\x64', '\xB3', '\xF7', '\x4E', '\x65',
+    '\xA4', '\x3E', '\xB6', '\x17', '\x6D', '\x21', '\x93', '\x5C', '\x07', '\x7E', '\x09', '\xCA', '\xBC', '\x54', '\x27', '\x66',
+    '\x5C', '\x5B', '\xCA', '\x54', '\x50', '\x3A', '\x65', '\x62', '\x24', '\xEE', '\x9C', '\x78', '\x3A', '\x75', '\xA0', '\x2F',
+    '\xE2', '\x34', '\xA0', '\x55', '\x92', '\xC6', '\x33', '\xE7', '\x7E', '\xB0', '\x21', '\xFB', '\x88', '\x5E', '\x69', '\x49',
+    '\x3B', '\x8B', '\xE8', '\x5B', '\x41', '\xDE', '\xB1', '\xF4', '\x84', '\xE7', '\x2D', '\x31', '\xF1', '\xA6', '\x60', '\x34',
+    '\x60', '\x68', '\xF5', '\xEC', '\x1A', '\x77', '\x6F', '\x14', '\xF6', '\x0F', '\xDF', '\xED', '\x5E', '\x2D', '\xD1', '\xD6',
+    '\x48', '\x62', '\x94', '\x07', '\xC1', '\xA0', '\xB6', '\xF1', '\xD6', '\x5F', '\x5C', '\xED', '\x93', '\xC3', '\x52', '\x65',
+    '\xF2', '\x34', '\x12', '\x7E', '\xEC', '\xE5', '\x21', '\x28', '\xDB', '\x33', '\x65', '\xCE', '\x02', '\x45', '\xCB', '\x5F',
+    '\xD6', '\xEF', '\x7D', '\x22', '\x82', '\x57', '\xB6', '\x6C', '\xD9', '\x3C', '\x5E', '\x01', '\xD8', '\x14', '\x4B', '\x9D',
+    '\x69', '\xB4', '\x78', '\x12', '\xC1', '\xA2', '\xDA', '\xC5', '\x6D', '\x8D', '\xC4', '\x41', '\x81', '\xDA', '\xE1', '\xB3',
+    '\x17', '\xEC', '\xAA', '\xA0', '\x29', '\x6C', '\xD1', '\x6F', '\x72', '\xA4', '\x80', '\xBD', '\xA6', '\x82', '\x36', '\x07',
+    '\x03', '\x95', '\x46', '\xB0', '\x3B', '\x45', '\x48', '\xD0', '\x75', '\xB9', '\x45', '\x83', '\xF8', '\xB9', '\x84', '\x72',
+    '\x83', '\x72', '\x44', '\x7F', '\xB3', '\xA7', '\x88', '\xC1', '\xC5', '\xD5', '\xF4', '\xB4', '\x24', '\x6E', '\x08', '\x08',
+    '\x4C', '\x55', '\x18', '\x2F', '\xD5', '\xA9', '\x31', '\xA9', '\x06', '\xA1', '\x42', '\x28', '\x40', '\x19', '\x5D', '\xB0',
+    '\x0A', '\x32', '\x45', '\x04', '\xB4', '\x87', '\x32', '\xFA', '\x0C', '\x6A', '\x15', '\x3B', '\xC3', '\x89', '\xBB', '\xAC',
+    '\xB8', '\xE5', '\x85', '\xBB', '\x14', '\x1D', '\x74', '\x8E', '\xE3', '\x57', '\x27', '\x7F', '\x7B', '\x89', '\x80', '\x8B',
+    '\xCF', '\xF5', '\x37', '\xE5', '\xBB', '\xBD', '\x06', '\x8C', '\x73', '\x2E', '\x7E', '\x71', '\x76', '\xCE', '\xB8', '\xD8',
+    '\xCF', '\x7B', '\x78', '\xFC', '\x98', '\xF1', '\xC3', '\x23', '\xC6', '\xDF', '\x72', '\x8C', '\x20', '\x66', '\xED', '\xA6',
+    '\x59', '\xA6', '\x2B', '\x02', '\x78', '\x2F', '\x86', '\x74', '\xB7', '\xDD', '\x2E', '\x7C', '\xD0', '\xC5', '\xB9', '\x19',
+    '\x34', '\x06', '\xE8', '\x84', '\x20', '\x04', '\x47', '\xFF', '\x17', '\x7F', '\x2D', '\x68', '\x5F', '\x10', '\xA4', '\xC1',
+    '\x3A', '\x7E', '\x64', '\x15', '\x9D', '\x8E', '\xB8', '\x0B', '\x75', '\x04', '\xA7', '\x2F', '\x67', '\x4D', '\x11', '\xCA',
+    '\x6F', '\xF7', '\x22', '\x9E', '\x0A', '\xE4', '\x8D', '\x80', '\xC7', '\x8D', '\xC8', '\x24', '\xD5', '\xFF', '\x6C', '\x6B',
+    '\x49', '\x2A', '\xA3', '\x99', '\x72', '\xA7', '\x14', '\x6E', '\xA6', '\x62', '\xC9', '\x36', '\xC7', '\xD2', '\x2A', '\x94',
+    '\xC9', '\xDC', '\xF4', '\xAE', '\x7B', '\xCF', '\x2A', '\x45', '\x8B', '\x2F', '\x6D', '\x03', '\x3E', '\x2C', '\xC0', '\x2E',
+    '\x94', '\xEF', '\x62', '\x7A', '\x16', '\xD3', '\x20', '\x1B', '\x77', '\x3C', '\x81', '\xE1', '\x6D', '\xE1', '\xDA', '\x98',
+    '\x72', '\xB8', '\xA4', '\x53', '\x96', '\x63', '\xFE', '\x79', '\x63', '\xC7', '\x50', '\xDC', '\x98', '\xA1', '\xD3', '\xD3',
+    '\xD9', '\x2F', '\xA4', '\x99', '\xB7', '\xA7', '\x41', '\x1C', '\xA7', '\xAE', '\x81', '\x9F', '\x5F', '\x76', '\x59', '\x64',
+    '\xC8', '\x8A', '\x8C', '\xF8', '\x11', '\x00', '\xDA', '\x67', '\x1C', '\x2C', '\xBB', '\xEE', '\x4E', '\x55', '\x84', '\x09',
+    '\xC8', '\xCD', '\x28', '\xF8', '\x36', '\x71', '\xCF', '\xC3', '\x25', '\xE4', '\x67', '\x6D', '\x6A', '\xC9', '\x83', '\x1A',
+    '\x0C', '\xA0', '\xC5', '\x13', '\xFD', '\x15', '\x3C', '\x35', '\xE2', '\x3D', '\xF8', '\x04', '\xBD', '\xFB', '\x14', '\xA8',
+    '\x41', '\x8D', '\x93', '\xC5', '\x41', '\x13', '\x46', '\xD6', '\x1E', '\x64', '\x6D', '\xDB', '\x7D', '\x2F', '\x17', '\x8D',
+    '\x12', '\x53', '\x26', '\x34', '\x7F', '\xD1', '\x8E', '\x45', '\x06', '\x14', '\x9C', '\x24', '\x5C', '\xCA', '\x5C', '\x0D',
+    '\x69', '\xDD', '\x01', '\x3E', '\x43', '\x71', '\x84', '\xCF', '\x8B', '\x17', '\x8D', '\x32', '\x8B', '\xA0', '\x3B', '\xA4',
+    '\x63', '\xEA', '\x46', '\xD3', '\xD6', '\x96', '\x3B', '\x7D', '\x2F', '\x46', '\xA4', '\x9B', '\x76', '\xCD', '\x6D', '\x21',
+    '\x01', '\x7C', '\xA3', '\x0C', '\x8D', '\x90', '\x74', '\xE1', '\x73', '\xCA', '\x79', '\xB2', '\x51', '\x68', '\xD1', '\xAB',
+    '\x9C', '\x8C', '\x74', '\x9F', '\xE0', '\x41', '\xB0', '\xD5', '\x1A', '\xF7', '\x1C', '\xA8', '\xCC', '\xDA', '\x1B', '\x22',
+    '\xAA', '\x46', '\xD8', '\x60', '\xAA', '\xDF', '\xA5', '\xEB', '\x12', '\xDD', '\xC1', '\x1E', '\xC2', '\x29', '\x65', '\x21',
+    '\x39', '\x8F', '\xFB', '\xF2', '\x1E', '\xEF', '\x01', '\x7E', '\x63', '\x4B', '\x18', '\x4A', '\xC1', '\x54', '\xEA', '\x40',
+    '\xF9', '\x0E', '\x6E', '\x9B', '\x11', '\x67', '\x69', '\x0A', '\xE7', '\xF4', '\x1F', '\x53', '\xA5', '\x79', '\x44', '\x23',
+    '\xCF', '\x86', '\xEC', '\x0A', '\xE5', '\x91', '\x86', '\x26', '\x9B', '\x06', '\x4F', '\xE9', '\x7D', '\xCC', '\x73', '\x44',
+    '\x5C', '\x2C', '\x38', '\x3E', '\x0A', '\x2F', '\x18', '\xF2', '\x42', '\xD6', '\x46', '\xF7', '\xB2', '\x7D', '\x6F', '\xE3',
+    '\x1E', '\xE3', '\x97', '\x08', '\x6E', '\x62', '\x1B', '\x78', '\x10', '\x33', '\x1C', '\x2F', '\x84', '\xB9', '\x3D', '\x17',
+    '\x75', '\x8A', '\x3D', '\xC7', '\x22', '\x30', '\x27', '\xC3', '\x1B', '\x5A', '\xBC', '\x47', '\xEF', '\x70', '\x6C', '\x7D',
+    '\xA6', '\xB1', '\x93', '\x0B', '\xFE', '\x7D', '\xA5', '\x38', '\x23', '\xB2', '\x5C', '\x0A', '\xB3', '\xA6', '\x58', '\xA8',
+    '\x75', '\x53', '\x6C', '\xF3', '\x91', '\xCA', '\x1C', '\x40', '\xF6', '\x6A', '\x2C', '\x6F', '\x3B', '\xC9', '\xB3', '\x39',
+    '\x53', '\x93', '\xFC', '\xBE', '\xAD', '\x9B', '\x96', '\x03', '\x67', '\x2C', '\x52', '\x2E', '\xBB', '\x03', '\x17', '\x92',
+    '\x0E', '\xBE', '\xB0', '\x2B', '\xAE', '\xEA', '\xA4', '\xC6', '\x39', '\x47', '\x25', '\x98', '\xF3', '\xFB', '\x8B', '\xC2',
+    '\x63', '\x4A', '\x3B', '\x2C', '\xC2', '\x09', '\x8E', '\xC3', '\xF8', '\xAB', '\x9B', '\xEB', '\xD3', '\x8B', '\x0D', '\x3E',
+    '\xC9', '\x52', '\x19', '\xEE', '\xE0', '\xCF', '\x53', '\xA5', '\x04', '\x13', '\x31', '\x3F', '\x76', '\x57', '\x4F', '\x68',
+    '\xDE', '\x29', '\x99', '\x6C', '\x44', '\x60', '\x62', '\x4E', '\x6E', '\xEC', '\x7A', '\xB1', '\x2B', '\x85', '\x30', '\x25',
+    '\xC5', '\x7E', '\xAC', '\x2D', '\x50', '\x25', '\xCD', '\x75', '\xB1', '\xB1', '\x55', '\x0B', '\xE4', '\x25', '\x3D', '\x3B',
+    '\x19', '\xD3', '\x53', '\xA2', '\x30', '\xEA', '\xE6', '\x29', '\x33', '\xD0', '\x16', '\xDF', '\x6D', '\x29', '\xAB', '\xD6',
+    '\xEA', '\xE5', '\xA3', '\x0A', '\xFD', '\x6B', '\xDE', '\xED', '\x4E', '\xBA', '\x6F', '\x1C', '\x9E', '\x08', '\x0A', '\x99',
+    '\x57', '\x9F', '\x05', '\x4E', '\xF7', '\x5B', '\xAE', '\x22', '\x6F', '\x4D', '\x02', '\xBD', '\x24', '\x7F', '\x5E', '\x1E',
+    '\xF7', '\x87', '\x77', '\xBF', '\x57', '\x05', '\x7C', '\x79', '\x7F', '\xFE', '\x5E', '\x5C', '\x9C', '\xBE', '\xE1', '\x8C',
+    '\x97', '\x9E', '\xB3', '\x03', '\xBF', '\xC1', '\x13', '\xD4', '\x4E', '\x04', '\x54', '\xC8', '\xF1', '\x2D', '\x7A', '\xC2',
+    '\x1E', '\xA2', '\xAD', '\x0F', '\x88', '\x74', '\xD7', '\x07', '\x25', '\x57', '\xC9', '\x76', '\xF3', '\xF6', '\x83', '\xF8',
+    '\x97', '\x4A', '\x33', '\x18', '\x48', '\x0C', '\x99', '\xBF', '\xD8', '\xA8', '\xFD', '\x48', '\x0D', '\xA0', '\x18', '\x1A',
+    '\xF1', '\x95', '\x99', '\x25', '\x01', '\x44', '\x99', '\x6B', '\xBB', '\xB5', '\x11', '\x4D', '\x83', '\xCE', '\x93', '\x88',
+    '\xB6', '\xA1', '\xF7', '\x15', '\x6F', '\x4A', '\xD7', '\xF9', '\xB5', '\xA4', '\xE4', '\x01', '\x68', '\x4F', '\xF0', '\x33',
+    '\x9C', '\xDA', '\x2C', '\xDA', '\xD1', '\x85', '\x4A', '\x67', '\x08', '\x78', '\x09', '\xC7', '\x05', '\x01', '\x4F', '\x2B',
+    '\x79', '\x26', '\x90', '\xD5', '\x52', '\x50', '\x1C', '\xE3', '\xD5', '\xE4', '\xAB', '\xC0', '\xC8', '\x26', '\xF7', '\x28',
+    '\xCC', '\xF8', '\x78', '\xB2', '\xE4', '\x91', '\xC1', '\xCC', '\x16', '\x95', '\xB6', '\x66', '\x78', '\x29', '\x63', '\xCE',
+    '\x20', '\x7C', '\xA6', '\xD2', '\xA5', '\xC2', '\xC8', '\x83', '\x7A', '\x4E', '\x12', '\x23', '\xB5', '\x02', '\x51', '\x28',
+    '\x35', '\x3F', '\x17', '\xA9', '\x7D', '\x6C', '\x33', '\xCA', '\x4E', '\xB6', '\xB6', '\xE6', '\x6F', '\x2A', '\xEC', '\xA2',
+    '\xC8', '\x23', '\x9E', '\x99', '\xEE', '\x16', '\xF7', '\x64', '\x2C', '\x3E', '\x76', '\x9A', '\x78', '\x52', '\x09', '\x71',
+    '\xBB', '\x7C', '\x1C', '\x22', '\xDE', '\x16', '\x36', '\x2A', '\x3A', '\x25', '\xE4', '\x7A', '\xA3', '\xBC', '\x4F', '\xF3',
+    '\x58', '\xD1', '\xCD', '\x28', '\xD3', '\xCA', '\x96', '\x63', '\x6C', '\x4D', '\xA9', '\x34', '\x23', '\xCC', '\x5B', '\x6E',
+    '\x9E', '\x06', '\xD5', '\xB6', '\xCA', '\x63', '\x2E', '\xC1', '\x1E', '\x0F', '\xB8', '\xD5', '\xE6', '\x9B', '\xB6', '\xBF',
+    '\xE2', '\x8A', '\x58', '\x7A', '\x41', '\x97', '\x17', '\x15', '\xCB', '\xB6', '\xFD', '\x5B', '\xF8', '\x47', '\x63', '\x20',
+    '\x43', '\x5F', '\x5B', '\x63', '\xBA', '\x83', '\xCB', '\xF1', '\x64', '\x17', '\xDE', '\x9C', '\xC2', '\xA4', '\x89', '\x99',
+    '\x3A', '\x58', '\x5B', '\x17', '\xDA', '\x0B', '\xD0', '\x99', '\x48', '\xE2', '\x00', '\xB5', '\x56', '\xC8', '\x19', '\x8E',
+    '\xB0', '\x35', '\x8F', '\x5E', '\x24', '\x6E', '\x45', '\x2D', '\x99', '\xEB', '\x74', '\x64', '\xA2', '\x3B', '\x96', '\xD3',
+    '\xD9', '\x1D', '\x0F', '\x03', '\x8D', '\x47', '\x4B', '\x44', '\x0C', '\xEC', '\xC3', '\x83', '\x62', '\xDE', '\x3E', '\xA3',
+    '\x21', '\xF4', '\x26', '\xCE', '\x53', '\x0F', '\xE3', '\x99', '\x95', '\x34', '\xA8', '\x6D', '\x27', '\x53', '\xDC', '\x5B',
+    '\x85', '\x02', '\xF2', '\x2D', '\x8A', '\xA2', '\xCA', '\xAE', '\xDA', '\x88', '\x58', '\xA6', '\xF8', '\xC8', '\xF2', '\xE1',
+    '\x49', '\xA7', '\x50', '\x5F', '\x4D', '\x40', '\x1E', '\x46', '\x8B', '\x8B', '\xFE', '\xE7', '\xCD', '\xE5', '\xA7', '\x76',
+    '\x22', '\xD3', '\x4C', '\xB9', '\xAA', '\x0D', '\x88', '\x6C', '\xD8', '\xE9', '\xDE', '\x06', '\xE1', '\x17', '\x6D', '\xE6',
+    '\x7C', '\x7C', '\x16', '\x0F', '\x27', '\x20', '\xFE', '\x43', '\x06', '\xD8', '\x1E', '\x96', '\x59', '\x07', '\x51', '\x60',
+    '\x31', '\x14', '\xEF', '\xE4', '\x50', '\x46', '\xBE', '\x8D', '\x4A', '\x32', '\xD7', '\x4E', '\xD9', '\xE4', '\x35', '\x1B',
+    '\xB4', '\xF4', '\x03', '\x06', '\x97', '\xF3', '\x82', '\x92', '\x8E', '\xF5', '\x20', '\xC2', '\x6E', '\x1F', '\xFF', '\x31',
+    '\xC7', '\xF3', '\xDB', '\x59', '\xF0', '\xF4', '\x2F', '\xBE', '\xA3', '\x30', '\xF6', '\x76', '\xE1', '\xC5', '\x73', '\x80',
+    '\x51', '\x87', '\xBB', '\x28', '\x7E', '\x1F', '\x10', '\x22', '\x66', '\x59', '\x08', '\xB2', '\xBE', '\x98', '\x4A', '\x1A',
+    '\x62', '\x09', '\xD6', '\xDB', '\xC0', '\x4C', '\x9A', '\x03', '\x84', '\x69', '\xAA', '\xD2', '\x44', '\xF8', '\xC3', '\x5E',
+    '\xB1', '\x97', '\xA1', '\xDA', '\x5E', '\x9E', '\x22', '\x12', '\xCD', '\xAD', '\x44', '\x0E', '\xF2', '\xA8', '\xFF', '\x64',
+    '\x42', '\x16', '\x7F', '\xFC', '\x21', '\x0E', '\xAC', '\xD3', '\x2B', '\x37', '\xD5', '\x4E', '\x52', '\x86', '\xBD', '\x55',
+    '\x53', '\x99', '\x07', '\xC6', '\xA5', '\x31', '\xA5', '\x78', '\x8C', '\x51', '\x28', '\x14', '\x87', '\xC6', '\x65', '\xE0',
+    '\xCC', '\xCA', '\xCC', '\x63', '\x1F', '\x96', '\x5F', '\x5D', '\xDE', '\xDC', '\x02', '\x42', '\xBF', '\x8F', '\xA0', '\x00',
+    '\x91', '\xA1', '\x4E', '\x51', '\x13', '\x5A', '\xB7', '\xEB', '\x44', '\x51', '\xA7', '\x92', '\x49', '\x82', '\x97', '\x1D',
+    '\xBF', '\xC4', '\x3A', '\x14', '\xCD', '\x7C', '\x50', '\xFA', '\x25', '\xA5', '\x2F', '\xF8', '\xFE', '\x70', '\x2F', '\x48',
+    '\x26', '\x3D', '\x5D', '\xBB', '\xA5', '\x5B', '\xEF', '\x1E', '\x9F', '\x41', '\xFB', '\xE8', '\x6A', '\xF6', '\x5E', '\x2F',
+    '\x27', '\x5F', '\x95', '\x67', '\xDA', '\x68', '\x6F', '\xD9', '\x86', '\xBE', '\xD1', '\x46', '\xB2', '\x9F', '\x49', '\x58',
+    '\xBA', '\x0D', '\x13', '\xFB', '\xEE', '\xB1', '\x8F', '\x96', '\xA7', '\x71', '\xC5', '\x6F', '\x4D', '\xA7', '\x59', '\x78',
+    '\xAF', '\x08', '\x1A', '\x94', '\xC4', '\xF7', '\xF4', '\xE3', '\xD9', '\x52', '\x06', '\x8F', '\xDE', '\x9B', '\xE4', '\x58',
+    '\x8C', '\xA4', '\xA2', '\xCB', '\xE5', '\xA1', '\xD5', '\xAA', '\x24', '\xBD', '\x7D', '\x6B', '\x58', '\x82', '\x11', '\xCD',
+    '\xAC', '\x3F', '\xFD', '\xB4', '\x75', '\xED', '\x43', '\xF9', '\x68', '\x2B', '\x32', '\x8C', '\xE8', '\x71', '\x78', '\x8C',
+    '\xEF', '\x5D', '\xE8', '\xDB', '\x66', '\x59', '\x59', '\x7C', '\x29', '\xC1', '\x89', '\xB2', '\x5C', '\xB2', '\xBD', '\xA0',
+    '\x1C', '\x76', '\xCA', '\x87', '\xE6', '\xB0', '\x53', '\xFC', '\x06', '\xD5', '\xE1', '\x5F', '\x75', '\xFF', '\x07', '\x3B',
+    '\x92', '\xCD', '\x26', '\xEB', '\x15', '\x00', '\x00',
+};
+constexpr size_t ROOT_HTML_GZ_LEN = sizeof(ROOT_HTML_GZ);
+
+// update.html: 4400 bytes, gzip 2098 bytes
+constexpr char UPDATE_HTML[] PROGMEM = {
+    '\x3C', '\x21', '\x44', '\x4F', '\x43', '\x54', '\x59', '\x50', '\x45', '\x20', '\x68', '\x74', '\x6D', '\x6C', '\x3E', '\x0A',
+    '\x3C', '\x6C', '\x69', '\x6E', '\x6B', '\x20', '\x72', '\x65', '\x6C', '\x3D', '\x27', '\x69', '\x63', '\x6F', '\x6E', '\x27',
+    '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D', '\x27', '\x2F', '\x66', '\x61', '\x76', '\x69', '\x63', '\x6F', '\x6E', '\x2E',
+    '\x69', '\x63', '\x6F', '\x27', '\x20', '\x73', '\x69', '\x7A', '\x65', '\x73', '\x3D', '\x27', '\x61', '\x6E', '\x79', '\x27',
+    '\x3E', '\x0A', '\x3C', '\x62', '\x6F', '\x64', '\x79', '\x20', '\x73', '\x74', '\x79', '\x6C', '\x65', '\x3D', '\x27', '\x77',
+    '\x69', '\x64', '\x74', '\x68', '\x3A', '\x34', '\x38', '\x30', '\x70', '\x78', '\x27', '\x3E', '\x0A', '\x3C', '\x68', '\x32',
+    '\x3E', '\x45', '\x53', '\x50', '\x20', '\x46', '\x69', '\x72', '\x6D', '\x77', '\x61', '\x72', '\x65', '\x20', '\x55', '\x70',
+    '\x64', '\x61', '\x74', '\x65', '\x72', '\x3C', '\x2F', '\x68', '\x32', '\x3E', '\x0A', '\x3C', '\x66', '\x6F', '\x72', '\x6D',
+    '\x20', '\x6D', '\x65', '\x74', '\x68', '\x6F', '\x64', '\x3D', '\x27', '\x50', '\x4F', '\x53', '\x54', '\x27', '\x20', '\x65',
+    '\x6E', '\x63', '\x74', '\x79', '\x70', '\x65', '\x3D', '\x27', '\x6D', '\x75', '\x6C', '\x74', '\x69', '\x70', '\x61', '\x72',
+    '\x74', '\x2F', '\x66', '\x6F', '\x72', '\x6D', '\x2D', '\x64', '\x61', '\x74', '\x61', '\x27', '\x20', '\x69', '\x64', '\x3D',
+    '\x27', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x2D', '\x66', '\x6F', '\x72', '\x6D', '\x27', '\x3E', '\x0A', '\x3C',
+    '\x69', '\x6E', '\x70', '\x75', '\x74', '\x20', '\x74', '\x79', '\x70', '\x65', '\x3D', '\x27', '\x66', '\x69', '\x6C', '\x65',
+    '\x27', '\x20', '\x69', '\x64', '\x3D', '\x27', '\x66', '\x69', '\x6C', '\x65', '\x27', '\x20', '\x6E', '\x61', '\x6D', '\x65',
+    '\x3D', '\x27', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x27', '\x20', '\x61', '\x63', '\x63', '\x65', '\x70', '\x74',
+    '\x3D', '\x22', '\x2E', '\x62', '\x69', '\x6E', '\x2C', '\x2E', '\x75', '\x66', '\x32', '\x2C', '\x2E', '\x67', '\x7A', '\x2C',
+    '\x2E', '\x68', '\x73', '\x22', '\x3E', '\x0A', '\x3C', '\x69', '\x6E', '\x70', '\x75', '\x74', '\x20', '\x74', '\x79', '\x70',
+    '\x65', '\x3D', '\x27', '\x73', '\x75', '\x62', '\x6D', '\x69', '\x74', '\x27', '\x20', '\x76', '\x61', '\x6C', '\x75', '\x65',
+    '\x3D', '\x27', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x27', '\x3E', '\x0A', '\x3C', '\x2F', '\x66', '\x6F', '\x72',
+    '\x6D', '\x3E', '\x0A', '\x3C', '\x62', '\x72', '\x3E', '\x0A', '\x3C', '\x61', '\x20', '\x68', '\x72', '\x65', '\x66', '\x3D',
+    '\x22', '\x2F', '\x22', '\x3E', '\x62', '\x61', '\x63', '\x6B', '\x3C', '\x2F', '\x61', '\x3E', '\x0A', '\x3C', '\x64', '\x69',
+    '\x76', '\x20', '\x69', '\x64', '\x3D', '\x27', '\x70', '\x72', '\x67', '\x27', '\x20', '\x73', '\x74', '\x79', '\x6C', '\x65',
+    '\x3D', '\x27', '\x77', '\x69', '\x64', '\x74', '\x68', '\x3A', '\x30', '\x3B', '\x63', '\x6F', '\x6C', '\x6F', '\x72', '\x3A',
+    '\x77', '\x68', '\x69', '\x74', '\x65', '\x3B', '\x74', '\x65', '\x78', '\x74', '\x2D', '\x61', '\x6C', '\x69', '\x67', '\x6E',
+    '\x3A', '\x63', '\x65', '\x6E', '\x74', '\x65', '\x72', '\x27', '\x3E', '\x30', '\x25', '\x3C', '\x2F', '\x64', '\x69', '\x76',
+    '\x3E', '\x0A', '\x3C', '\x70', '\x20', '\x69', '\x64', '\x3D', '\x27', '\x72', '\x61', '\x74', '\x65', '\x27', '\x3E', '\x3C',
+    '\x2F', '\x70', '\x3E', '\x0A', '\x3C', '\x2F', '\x62', '\x6F', '\x64', '\x79', '\x3E', '\x0A', '\x3C', '\x73', '\x63', '\x72',
+    '\x69', '\x70', '\x74', '\x3E', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x70', '\x72', '\x67', '\x20', '\x3D', '\x20', '\x64',
+    '\x6F', '\x63', '\x75', '\x6D', '\x65', '\x6E', '\x74', '\x2E', '\x67', '\x65', '\x74', '\x45', '\x6C', '\x65', '\x6D', '\x65',
+    '\x6E', '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x70', '\x72', '\x67', '\x27', '\x29', '\x3B', '\x0A', '\x76',
+    '\x61', '\x72', '\x20', '\x72', '\x61', '\x74', '\x65', '\x20', '\x3D', '\x20', '\x64', '\x6F', '\x63', '\x75', '\x6D', '\x65',
+    '\x6E', '\x74', '\x2E', '\x67', '\x65', '\x74', '\x45', '\x6C', '\x65', '\x6D', '\x65', '\x6E', '\x74', '\x42', '\x79', '\x49',
+    '\x64', '\x28', '\x27', '\x72', '\x61', '\x74', '\x65', '\x27', '\x29', '\x3B', '\x0A', '\x2F', '\x2F', '\x20', '\x4F', '\x6E',
+    '\x6C', '\x79', '\x20', '\x6F', '\x6E', '\x65', '\x20', '\x70', '\x6F', '\x6C', '\x6C', '\x20', '\x61', '\x74', '\x20', '\x61',
+    '\x20', '\x74', '\x69', '\x6D', '\x65', '\x2C', '\x20', '\x74', '\x68', '\x65', '\x20', '\x73', '\x79', '\x6E', '\x63', '\x68',
+    '\x72', '\x6F', '\x6E', '\x6F', '\x75', '\x73', '\x20', '\x73', '\x65', '\x72', '\x76', '\x65', '\x72', '\x20', '\x61', '\x6E',
+    '\x73', '\x77', '\x65', '\x72', '\x73', '\x20', '\x69', '\x74', '\x20', '\x61', '\x66', '\x74', '\x65', '\x72', '\x20', '\x74',
+    '\x68', '\x65', '\x20', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x70', '\x6F',
+    '\x6C', '\x6C', '\x69', '\x6E', '\x67', '\x20', '\x3D', '\x20', '\x66', '\x61', '\x6C', '\x73', '\x65', '\x3B', '\x0A', '\x66',
+    '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x73', '\x74', '\x61', '\x74', '\x75', '\x73', '\x28', '\x66',
+    '\x6F', '\x72', '\x63', '\x65', '\x29', '\x20', '\x7B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x70', '\x6F', '\x6C', '\x6C',
+    '\x69', '\x6E', '\x67', '\x20', '\x26', '\x26', '\x20', '\x21', '\x66', '\x6F', '\x72', '\x63', '\x65', '\x29', '\x20', '\x72',
+    '\x65', '\x74', '\x75', '\x72', '\x6E', '\x3B', '\x0A', '\x70', '\x6F', '\x6C', '\x6C', '\x69', '\x6E', '\x67', '\x20', '\x3D',
+    '\x20', '\x74', '\x72', '\x75', '\x65', '\x3B', '\x0A', '\x66', '\x65', '\x74', '\x63', '\x68', '\x28', '\x27', '\x2F', '\x75',
+    '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x2F', '\x73', '\x74', '\x61', '\x74', '\x75', '\x73', '\x27', '\x29', '\x2E', '\x74',
+    '\x68', '\x65', '\x6E', '\x28', '\x72', '\x20', '\x3D', '\x3E', '\x20', '\x72', '\x2E', '\x6A', '\x73', '\x6F', '\x6E', '\x28',
+    '\x29', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x73', '\x20', '\x3D', '\x3E', '\x20', '\x7B', '\x0A', '\x69',
+    '\x66', '\x20', '\x28', '\x73', '\x2E', '\x73', '\x74', '\x61', '\x74', '\x65', '\x20', '\x3D', '\x3D', '\x20', '\x27', '\x66',
+    '\x61', '\x69', '\x6C', '\x65', '\x64', '\x27', '\x29', '\x20', '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E',
+    '\x65', '\x72', '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x65', '\x72', '\x72', '\x6F', '\x72',
+    '\x3B', '\x0A', '\x65', '\x6C', '\x73', '\x65', '\x20', '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E', '\x65',
+    '\x72', '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D', '\x20', '\x73', '\x2E', '\x73', '\x74', '\x61', '\x74', '\x65', '\x20',
+    '\x2B', '\x20', '\x27', '\x2C', '\x20', '\x27', '\x20', '\x2B', '\x20', '\x4D', '\x61', '\x74', '\x68', '\x2E', '\x72', '\x6F',
+    '\x75', '\x6E', '\x64', '\x28', '\x73', '\x2E', '\x62', '\x79', '\x74', '\x65', '\x73', '\x50', '\x65', '\x72', '\x53', '\x65',
+    '\x63', '\x6F', '\x6E', '\x64', '\x20', '\x2F', '\x20', '\x31', '\x30', '\x32', '\x34', '\x29', '\x20', '\x2B', '\x20', '\x27',
+    '\x20', '\x4B', '\x42', '\x2F', '\x73', '\x27', '\x3B', '\x0A', '\x7D', '\x29', '\x2E', '\x63', '\x61', '\x74', '\x63', '\x68',
+    '\x28', '\x28', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x7B', '\x7D', '\x29', '\x2E', '\x66', '\x69', '\x6E', '\x61', '\x6C',
+    '\x6C', '\x79', '\x28', '\x28', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x70', '\x6F', '\x6C', '\x6C', '\x69', '\x6E', '\x67',
+    '\x20', '\x3D', '\x20', '\x66', '\x61', '\x6C', '\x73', '\x65', '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x2F', '\x2F', '\x20',
+    '\x63', '\x72', '\x79', '\x70', '\x74', '\x6F', '\x2E', '\x73', '\x75', '\x62', '\x74', '\x6C', '\x65', '\x20', '\x69', '\x73',
+    '\x20', '\x6D', '\x69', '\x73', '\x73', '\x69', '\x6E', '\x67', '\x20', '\x6F', '\x6E', '\x20', '\x70', '\x6C', '\x61', '\x69',
+    '\x6E', '\x20', '\x68', '\x74', '\x74', '\x70', '\x20', '\x70', '\x61', '\x67', '\x65', '\x73', '\x2C', '\x20', '\x73', '\x6F',
+    '\x20', '\x74', '\x68', '\x65', '\x20', '\x68', '\x61', '\x73', '\x68', '\x20', '\x69', '\x73', '\x20', '\x63', '\x6F', '\x6D',
+    '\x70', '\x75', '\x74', '\x65', '\x64', '\x20', '\x68', '\x65', '\x72', '\x65', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74',
+    '\x69', '\x6F', '\x6E', '\x20', '\x73', '\x68', '\x61', '\x32', '\x35', '\x36', '\x28', '\x64', '\x61', '\x74', '\x61', '\x29',
+    '\x20', '\x7B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x6B', '\x20', '\x3D', '\x20', '\x5B', '\x5D', '\x2C', '\x20', '\x68',
+    '\x20', '\x3D', '\x20', '\x5B', '\x5D', '\x2C', '\x20', '\x77', '\x20', '\x3D', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x41',
+    '\x72', '\x72', '\x61', '\x79', '\x28', '\x36', '\x34', '\x29', '\x2C', '\x20', '\x69', '\x2C', '\x20', '\x6A', '\x3B', '\x0A',
+    '\x66', '\x6F', '\x72', '\x20', '\x28', '\x76', '\x61', '\x72', '\x20', '\x6E', '\x20', '\x3D', '\x20', '\x32', '\x2C', '\x20',
+    '\x70', '\x20', '\x3D', '\x20', '\x30', '\x3B', '\x20', '\x70', '\x20', '\x3C', '\x20', '\x36', '\x34', '\x3B', '\x20', '\x6E',
+    '\x2B', '\x2B', '\x29', '\x20', '\x7B', '\x0A', '\x66', '\x6F', '\x72', '\x20', '\x28', '\x6A', '\x20', '\x3D', '\x20', '\x32',
+    '\x3B', '\x20', '\x6A', '\x20', '\x2A', '\x20', '\x6A', '\x20', '\x3C', '\x3D', '\x20', '\x6E', '\x20', '\x26', '\x26', '\x20',
+    '\x6E', '\x20', '\x25', '\x20', '\x6A', '\x3B', '\x20', '\x6A', '\x2B', '\x2B', '\x29', '\x3B', '\x0A', '\x69', '\x66', '\x20',
+    '\x28', '\x6A', '\x20', '\x2A', '\x20', '\x6A', '\x20', '\x3E', '\x20', '\x6E', '\x29', '\x20', '\x7B', '\x0A', '\x69', '\x66',
+    '\x20', '\x28', '\x70', '\x20', '\x3C', '\x20', '\x38', '\x29', '\x20', '\x68', '\x5B', '\x70', '\x5D', '\x20', '\x3D', '\x20',
+    '\x4D', '\x61', '\x74', '\x68', '\x2E', '\x70', '\x6F', '\x77', '\x28', '\x6E', '\x2C', '\x20', '\x31', '\x20', '\x2F', '\x20',
+    '\x32', '\x29', '\x20', '\x2A', '\x20', '\x34', '\x32', '\x39', '\x34', '\x39', '\x36', '\x37', '\x32', '\x39', '\x36', '\x20',
+    '\x7C', '\x20', '\x30', '\x3B', '\x0A', '\x6B', '\x5B', '\x70', '\x2B', '\x2B', '\x5D', '\x20', '\x3D', '\x20', '\x4D', '\x61',
+    '\x74', '\x68', '\x2E', '\x70', '\x6F', '\x77', '\x28', '\x6E', '\x2C', '\x20', '\x31', '\x20', '\x2F', '\x20', '\x33', '\x29',
+    '\x20', '\x2A', '\x20', '\x34', '\x32', '\x39', '\x34', '\x39', '\x36', '\x37', '\x32', '\x39', '\x36', '\x20', '\x7C', '\x20',
+    '\x30', '\x3B', '\x0A', '\x7D', '\x0A', '\x7D', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x62', '\x69', '\x74', '\x73', '\x20',
+    '\x3D', '\x20', '\x64', '\x61', '\x74', '\x61', '\x2E', '\x6C', '\x65', '\x6E', '\x67', '\x74', '\x68', '\x20', '\x2A', '\x20',
+    '\x38', '\x2C', '\x20', '\x6C', '\x65', '\x6E', '\x67', '\x74', '\x68', '\x20', '\x3D', '\x20', '\x28', '\x64', '\x61', '\x74',
+    '\x61', '\x2E', '\x6C', '\x65', '\x6E', '\x67', '\x74', '\x68', '\x20', '\x2B', '\x20', '\x37', '\x32', '\x29', '\x20', '\x26',
+    '\x20', '\x7E', '\x36', '\x33', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x6D', '\x20', '\x3D', '\x20', '\x6E', '\x65',
+    '\x77', '\x20', '\x55', '\x69', '\x6E', '\x74', '\x38', '\x41', '\x72', '\x72', '\x61', '\x79', '\x28', '\x6C', '\x65', '\x6E',
+    '\x67', '\x74', '\x68', '\x29', '\x3B', '\x0A', '\x6D', '\x2E', '\x73', '\x65', '\x74', '\x28', '\x64', '\x61', '\x74', '\x61',
+    '\x29', '\x3B', '\x0A', '\x6D', '\x5B', '\x64', '\x61', '\x74', '\x61', '\x2E', '\x6C', '\x65', '\x6E', '\x67', '\x74', '\x68',
+    '\x5D', '\x20', '\x3D', '\x20', '\x30', '\x78', '\x38', '\x30', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x76', '\x69',
+    '\x65', '\x77', '\x20', '\x3D', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x44', '\x61', '\x74', '\x61', '\x56', '\x69', '\x65',
+    '\x77', '\x28', '\x6D', '\x2E', '\x62', '\x75', '\x66', '\x66', '\x65', '\x72', '\x29', '\x3B', '\x0A', '\x76', '\x69', '\x65',
+    '\x77', '\x2E', '\x73', '\x65', '\x74', '\x55', '\x69', '\x6E', '\x74', '\x33', '\x32', '\x28', '\x6C', '\x65', '\x6E', '\x67',
+    '\x74', '\x68', '\x20', '\x2D', '\x20', '\x38', '\x2C', '\x20', '\x4D', '\x61', '\x74', '\x68', '\x2E', '\x66', '\x6C', '\x6F',
+    '\x6F', '\x72', '\x28', '\x62', '\x69', '\x74', '\x73', '\x20', '\x2F', '\x20', '\x34', '\x32', '\x39', '\x34', '\x39', '\x36',
+    '\x37', '\x32', '\x39', '\x36', '\x29', '\x29', '\x3B', '\x0A', '\x76', '\x69', '\x65', '\x77', '\x2E', '\x73', '\x65', '\x74',
+    '\x55', '\x69', '\x6E', '\x74', '\x33', '\x32', '\x28', '\x6C', '\x65', '\x6E', '\x67', '\x74', '\x68', '\x20', '\x2D', '\x20',
+    '\x34', '\x2C', '\x20', '\x62', '\x69', '\x74', '\x73', '\x20', '\x3E', '\x3E', '\x3E', '\x20', '\x30', '\x29', '\x3B', '\x0A',
+    '\x76', '\x61', '\x72', '\x20', '\x72', '\x20', '\x3D', '\x20', '\x28', '\x78', '\x2C', '\x20', '\x6E', '\x29', '\x20', '\x3D',
+    '\x3E', '\x20', '\x28', '\x78', '\x20', '\x3E', '\x3E', '\x3E', '\x20', '\x6E', '\x29', '\x20', '\x7C', '\x20', '\x28', '\x78',
+    '\x20', '\x3C', '\x3C', '\x20', '\x28', '\x33', '\x32', '\x20', '\x2D', '\x20', '\x6E', '\x29', '\x29', '\x3B', '\x0A', '\x66',
+    '\x6F', '\x72', '\x20', '\x28', '\x69', '\x20', '\x3D', '\x20', '\x30', '\x3B', '\x20', '\x69', '\x20', '\x3C', '\x20', '\x6C',
+    '\x65', '\x6E', '\x67', '\x74', '\x68', '\x3B', '\x20', '\x69', '\x20', '\x2B', '\x3D', '\x20', '\x36', '\x34', '\x29', '\x20',
+    '\x7B', '\x0A', '\x66', '\x6F', '\x72', '\x20', '\x28', '\x6A', '\x20', '\x3D', '\x20', '\x30', '\x3B', '\x20', '\x6A', '\x20',
+    '\x3C', '\x20', '\x36', '\x34', '\x3B', '\x20', '\x6A', '\x2B', '\x2B', '\x29', '\x20', '\x7B', '\x0A', '\x77', '\x5B', '\x6A',
+    '\x5D', '\x20', '\x3D', '\x20', '\x6A', '\x20', '\x3C', '\x20', '\x31', '\x36', '\x20', '\x3F', '\x20', '\x76', '\x69', '\x65',
+    '\x77', '\x2E', '\x67', '\x65', '\x74', '\x55', '\x69', '\x6E', '\x74', '\x33', '\x32', '\x28', '\x69', '\x20', '\x2B', '\x20',
+    '\x6A', '\x20', '\x2A', '\x20', '\x34', '\x29', '\x20', '\x3A', '\x0A', '\x28', '\x72', '\x28', '\x77', '\x5B', '\x6A', '\x20',
+    '\x2D', '\x20', '\x32', '\x5D', '\x2C', '\x20', '\x31', '\x37', '\x29', '\x20', '\x5E', '\x20', '\x72', '\x28', '\x77', '\x5B',
+    '\x6A', '\x20', '\x2D', '\x20', '\x32', '\x5D', '\x2C', '\x20', '\x31', '\x39', '\x29', '\x20', '\x5E', '\x20', '\x28', '\x77',
+    '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x32', '\x5D', '\x20', '\x3E', '\x3E', '\x3E', '\x20', '\x31', '\x30', '\x29', '\x29',
+    '\x20', '\x2B', '\x20', '\x77', '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x37', '\x5D', '\x20', '\x2B', '\x0A', '\x28', '\x72',
+    '\x28', '\x77', '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x31', '\x35', '\x5D', '\x2C', '\x20', '\x37', '\x29', '\x20', '\x5E',
+    '\x20', '\x72', '\x28', '\x77', '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x31', '\x35', '\x5D', '\x2C', '\x20', '\x31', '\x38',
+    '\x29', '\x20', '\x5E', '\x20', '\x28', '\x77', '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x31', '\x35', '\x5D', '\x20', '\x3E',
+    '\x3E', '\x3E', '\x20', '\x33', '\x29', '\x29', '\x20', '\x2B', '\x20', '\x77', '\x5B', '\x6A', '\x20', '\x2D', '\x20', '\x31',
+    '\x36', '\x5D', '\x20', '\x7C', '\x20', '\x30', '\x3B', '\x0A', '\x7D', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x5B', '\x61',
+    '\x2C', '\x20', '\x62', '\x2C', '\x20', '\x63', '\x2C', '\x20', '\x64', '\x2C', '\x20', '\x65', '\x2C', '\x20', '\x66', '\x2C',
+    '\x20', '\x67', '\x2C', '\x20', '\x68', '\x68', '\x5D', '\x20', '\x3D', '\x20', '\x68', '\x3B', '\x0A', '\x66', '\x6F', '\x72',
+    '\x20', '\x28', '\x6A', '\x20', '\x3D', '\x20', '\x30', '\x3B', '\x20', '\x6A', '\x20', '\x3C', '\x20', '\x36', '\x34', '\x3B',
+    '\x20', '\x6A', '\x2B', '\x2B', '\x29', '\x20', '\x7B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x74', '\x31', '\x20', '\x3D',
+    '\x20', '\x68', '\x68', '\x20', '\x2B', '\x20', '\x28', '\x72', '\x28', '\x65', '\x2C', '\x20', '\x36', '\x29', '\x20', '\x5E',
+    '\x20', '\x72', '\x28', '\x65', '\x2C', '\x20', '\x31', '\x31', '\x29', '\x20', '\x5E', '\x20', '\x72', '\x28', '\x65', '\x2C',
+    '\x20', '\x32', '\x35', '\x29', '\x29', '\x20', '\x2B', '\x20', '\x28', '\x28', '\x65', '\x20', '\x26', '\x20', '\x66', '\x29',
+    '\x20', '\x5E', '\x20', '\x28', '\x7E', '\x65', '\x20', '\x26', '\x20', '\x67', '\x29', '\x29', '\x20', '\x2B', '\x20', '\x6B',
+    '\x5B', '\x6A', '\x5D', '\x20', '\x2B', '\x20', '\x77', '\x5B', '\x6A', '\x5D', '\x20', '\x7C', '\x20', '\x30', '\x3B', '\x0A',
+    '\x76', '\x61', '\x72', '\x20', '\x74', '\x32', '\x20', '\x3D', '\x20', '\x28', '\x72', '\x28', '\x61', '\x2C', '\x20', '\x32',
+    '\x29', '\x20', '\x5E', '\x20', '\x72', '\x28', '\x61', '\x2C', '\x20', '\x31', '\x33', '\x29', '\x20', '\x5E', '\x20', '\x72',
+    '\x28', '\x61', '\x2C', '\x20', '\x32', '\x32', '\x29', '\x29', '\x20', '\x2B', '\x20', '\x28', '\x28', '\x61', '\x20', '\x26',
+    '\x20', '\x62', '\x29', '\x20', '\x5E', '\x20', '\x28', '\x61', '\x20', '\x26', '\x20', '\x63', '\x29', '\x20', '\x5E', '\x20',
+    '\x28', '\x62', '\x20', '\x26', '\x20', '\x63', '\x29', '\x29', '\x20', '\x7C', '\x20', '\x30', '\x3B', '\x0A', '\x68', '\x68',
+    '\x20', '\x3D', '\x20', '\x67', '\x3B', '\x20', '\x67', '\x20', '\x3D', '\x20', '\x66', '\x3B', '\x20', '\x66', '\x20', '\x3D',
+    '\x20', '\x65', '\x3B', '\x20', '\x65', '\x20', '\x3D', '\x20', '\x64', '\x20', '\x2B', '\x20', '\x74', '\x31', '\x20', '\x7C',
+    '\x20', '\x30', '\x3B', '\x20', '\x64', '\x20', '\x3D', '\x20', '\x63', '\x3B', '\x20', '\x63', '\x20', '\x3D', '\x20', '\x62',
+    '\x3B', '\x20', '\x62', '\x20', '\x3D', '\x20', '\x61', '\x3B', '\x20', '\x61', '\x20', '\x3D', '\x20', '\x74', '\x31', '\x20',
+    '\x2B', '\x20', '\x74', '\x32', '\x20', '\x7C', '\x20', '\x30', '\x3B', '\x0A', '\x7D', '\x0A', '\x68', '\x20', '\x3D', '\x20',
+    '\x5B', '\x61', '\x2C', '\x20', '\x62', '\x2C', '\x20', '\x63', '\x2C', '\x20', '\x64', '\x2C', '\x20', '\x65', '\x2C', '\x20',
+    '\x66', '\x2C', '\x20', '\x67', '\x2C', '\x20', '\x68', '\x68', '\x5D', '\x2E', '\x6D', '\x61', '\x70', '\x28', '\x28', '\x78',
+    '\x2C', '\x20', '\x6E', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x68', '\x5B', '\x6E', '\x5D', '\x20', '\x2B', '\x20', '\x78',
+    '\x20', '\x7C', '\x20', '\x30', '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20',
+    '\x68', '\x2E', '\x6D', '\x61', '\x70', '\x28', '\x78', '\x20', '\x3D', '\x3E', '\x20', '\x28', '\x78', '\x20', '\x3E', '\x3E',
+    '\x3E', '\x20', '\x30', '\x29', '\x2E', '\x74', '\x6F', '\x53', '\x74', '\x72', '\x69', '\x6E', '\x67', '\x28', '\x31', '\x36',
+    '\x29', '\x2E', '\x70', '\x61', '\x64', '\x53', '\x74', '\x61', '\x72', '\x74', '\x28', '\x38', '\x2C', '\x20', '\x27', '\x30',
+    '\x27', '\x29', '\x29', '\x2E', '\x6A', '\x6F', '\x69', '\x6E', '\x28', '\x27', '\x27', '\x29', '\x3B', '\x0A', '\x7D', '\x0A',
+    '\x66', '\x75', '\x6E', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x70', '\x72', '\x6F', '\x67', '\x72', '\x65', '\x73',
+    '\x73', '\x28', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x2C', '\x20', '\x73', '\x69', '\x7A', '\x65', '\x29', '\x20',
+    '\x7B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x77', '\x20', '\x3D', '\x20', '\x4D', '\x61', '\x74', '\x68', '\x2E', '\x72',
+    '\x6F', '\x75', '\x6E', '\x64', '\x28', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x20', '\x2F', '\x20', '\x73', '\x69',
+    '\x7A', '\x65', '\x20', '\x2A', '\x20', '\x31', '\x30', '\x30', '\x29', '\x20', '\x2B', '\x20', '\x27', '\x25', '\x27', '\x3B',
+    '\x0A', '\x70', '\x72', '\x67', '\x2E', '\x69', '\x6E', '\x6E', '\x65', '\x72', '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D',
+    '\x20', '\x77', '\x3B', '\x0A', '\x70', '\x72', '\x67', '\x2E', '\x73', '\x74', '\x79', '\x6C', '\x65', '\x2E', '\x77', '\x69',
+    '\x64', '\x74', '\x68', '\x20', '\x3D', '\x20', '\x77', '\x3B', '\x0A', '\x7D', '\x0A', '\x66', '\x75', '\x6E', '\x63', '\x74',
+    '\x69', '\x6F', '\x6E', '\x20', '\x70', '\x6F', '\x73', '\x74', '\x28', '\x75', '\x72', '\x6C', '\x2C', '\x20', '\x62', '\x6F',
+    '\x64', '\x79', '\x29', '\x20', '\x7B', '\x0A', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x66', '\x65', '\x74',
+    '\x63', '\x68', '\x28', '\x75', '\x72', '\x6C', '\x2C', '\x20', '\x7B', '\x6D', '\x65', '\x74', '\x68', '\x6F', '\x64', '\x3A',
+    '\x20', '\x27', '\x50', '\x4F', '\x53', '\x54', '\x27', '\x2C', '\x20', '\x62', '\x6F', '\x64', '\x79', '\x3A', '\x20', '\x62',
+    '\x6F', '\x64', '\x79', '\x7D', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x72', '\x20', '\x3D', '\x3E', '\x20',
+    '\x7B', '\x0A', '\x2F', '\x2F', '\x20', '\x54', '\x68', '\x65', '\x20', '\x72', '\x61', '\x74', '\x65', '\x20', '\x6C', '\x69',
+    '\x6D', '\x69', '\x74', '\x65', '\x72', '\x20', '\x61', '\x6E', '\x73', '\x77', '\x65', '\x72', '\x73', '\x20', '\x69', '\x6E',
+    '\x20', '\x70', '\x6C', '\x61', '\x69', '\x6E', '\x20', '\x74', '\x65', '\x78', '\x74', '\x20', '\x61', '\x6E', '\x64', '\x20',
+    '\x74', '\x65', '\x6C', '\x6C', '\x73', '\x20', '\x77', '\x68', '\x65', '\x6E', '\x20', '\x74', '\x6F', '\x20', '\x63', '\x6F',
+    '\x6D', '\x65', '\x20', '\x62', '\x61', '\x63', '\x6B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x72', '\x2E', '\x73', '\x74',
+    '\x61', '\x74', '\x75', '\x73', '\x20', '\x3D', '\x3D', '\x20', '\x34', '\x32', '\x39', '\x29', '\x20', '\x7B', '\x0A', '\x76',
+    '\x61', '\x72', '\x20', '\x77', '\x61', '\x69', '\x74', '\x20', '\x3D', '\x20', '\x28', '\x70', '\x61', '\x72', '\x73', '\x65',
+    '\x49', '\x6E', '\x74', '\x28', '\x72', '\x2E', '\x68', '\x65', '\x61', '\x64', '\x65', '\x72', '\x73', '\x2E', '\x67', '\x65',
+    '\x74', '\x28', '\x27', '\x52', '\x65', '\x74', '\x72', '\x79', '\x2D', '\x41', '\x66', '\x74', '\x65', '\x72', '\x27', '\x29',
+    '\x29', '\x20', '\x7C', '\x7C', '\x20', '\x31', '\x29', '\x20', '\x2A', '\x20', '\x31', '\x30', '\x30', '\x30', '\x3B', '\x0A',
+    '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E', '\x65', '\x72', '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D',
+    '\x20', '\x27', '\x64', '\x65', '\x76', '\x69', '\x63', '\x65', '\x20', '\x62', '\x75', '\x73', '\x79', '\x2C', '\x20', '\x77',
+    '\x61', '\x69', '\x74', '\x69', '\x6E', '\x67', '\x27', '\x3B', '\x0A', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20',
+    '\x6E', '\x65', '\x77', '\x20', '\x50', '\x72', '\x6F', '\x6D', '\x69', '\x73', '\x65', '\x28', '\x77', '\x20', '\x3D', '\x3E',
+    '\x20', '\x73', '\x65', '\x74', '\x54', '\x69', '\x6D', '\x65', '\x6F', '\x75', '\x74', '\x28', '\x77', '\x2C', '\x20', '\x77',
+    '\x61', '\x69', '\x74', '\x29', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x28', '\x29', '\x20', '\x3D', '\x3E',
+    '\x20', '\x70', '\x6F', '\x73', '\x74', '\x28', '\x75', '\x72', '\x6C', '\x2C', '\x20', '\x62', '\x6F', '\x64', '\x79', '\x29',
+    '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x72', '\x2E', '\x6A', '\x73',
+    '\x6F', '\x6E', '\x28', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28', '\x6A', '\x20', '\x3D', '\x3E', '\x20', '\x7B',
+    '\x0A', '\x69', '\x66', '\x20', '\x28', '\x21', '\x72', '\x2E', '\x6F', '\x6B', '\x20', '\x26', '\x26', '\x20', '\x28', '\x72',
+    '\x2E', '\x73', '\x74', '\x61', '\x74', '\x75', '\x73', '\x20', '\x21', '\x3D', '\x20', '\x34', '\x30', '\x39', '\x20', '\x7C',
+    '\x7C', '\x20', '\x6A', '\x2E', '\x65', '\x72', '\x72', '\x6F', '\x72', '\x29', '\x29', '\x20', '\x74', '\x68', '\x72', '\x6F',
+    '\x77', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x45', '\x72', '\x72', '\x6F', '\x72', '\x28', '\x6A', '\x2E', '\x65', '\x72',
+    '\x72', '\x6F', '\x72', '\x29', '\x3B', '\x0A', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x20', '\x6A', '\x3B', '\x0A',
+    '\x7D', '\x29', '\x3B', '\x0A', '\x7D', '\x29', '\x3B', '\x0A', '\x7D', '\x0A', '\x2F', '\x2F', '\x20', '\x54', '\x68', '\x65',
+    '\x20', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x20', '\x69', '\x73', '\x20', '\x73', '\x65', '\x6E', '\x74', '\x20',
+    '\x69', '\x6E', '\x20', '\x63', '\x68', '\x75', '\x6E', '\x6B', '\x73', '\x2C', '\x20', '\x61', '\x20', '\x6C', '\x6F', '\x73',
+    '\x74', '\x20', '\x63', '\x6F', '\x6E', '\x6E', '\x65', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x72', '\x65', '\x73',
+    '\x75', '\x6D', '\x65', '\x73', '\x20', '\x61', '\x74', '\x20', '\x74', '\x68', '\x65', '\x20', '\x6F', '\x66', '\x66', '\x73',
+    '\x65', '\x74', '\x20', '\x74', '\x68', '\x65', '\x20', '\x64', '\x65', '\x76', '\x69', '\x63', '\x65', '\x20', '\x72', '\x65',
+    '\x70', '\x6F', '\x72', '\x74', '\x73', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x43', '\x48', '\x55', '\x4E', '\x4B', '\x20',
+    '\x3D', '\x20', '\x33', '\x32', '\x37', '\x36', '\x38', '\x2C', '\x20', '\x52', '\x45', '\x54', '\x52', '\x49', '\x45', '\x53',
+    '\x20', '\x3D', '\x20', '\x32', '\x30', '\x3B', '\x0A', '\x61', '\x73', '\x79', '\x6E', '\x63', '\x20', '\x66', '\x75', '\x6E',
+    '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x28', '\x66', '\x69', '\x6C',
+    '\x65', '\x29', '\x20', '\x7B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x68', '\x61', '\x73', '\x68', '\x20', '\x3D', '\x20',
+    '\x73', '\x68', '\x61', '\x32', '\x35', '\x36', '\x28', '\x6E', '\x65', '\x77', '\x20', '\x55', '\x69', '\x6E', '\x74', '\x38',
+    '\x41', '\x72', '\x72', '\x61', '\x79', '\x28', '\x61', '\x77', '\x61', '\x69', '\x74', '\x20', '\x66', '\x69', '\x6C', '\x65',
+    '\x2E', '\x61', '\x72', '\x72', '\x61', '\x79', '\x42', '\x75', '\x66', '\x66', '\x65', '\x72', '\x28', '\x29', '\x29', '\x29',
+    '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x62', '\x65', '\x67', '\x69', '\x6E', '\x20', '\x3D', '\x20', '\x27', '\x2F',
+    '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x2F', '\x62', '\x65', '\x67', '\x69', '\x6E', '\x3F', '\x73', '\x69', '\x7A',
+    '\x65', '\x3D', '\x27', '\x20', '\x2B', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x73', '\x69', '\x7A', '\x65', '\x20',
+    '\x2B', '\x20', '\x27', '\x26', '\x73', '\x68', '\x61', '\x32', '\x35', '\x36', '\x3D', '\x27', '\x20', '\x2B', '\x20', '\x68',
+    '\x61', '\x73', '\x68', '\x20', '\x2B', '\x20', '\x27', '\x26', '\x6E', '\x61', '\x6D', '\x65', '\x3D', '\x27', '\x20', '\x2B',
+    '\x20', '\x65', '\x6E', '\x63', '\x6F', '\x64', '\x65', '\x55', '\x52', '\x49', '\x43', '\x6F', '\x6D', '\x70', '\x6F', '\x6E',
+    '\x65', '\x6E', '\x74', '\x28', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x6E', '\x61', '\x6D', '\x65', '\x29', '\x3B', '\x0A',
+    '\x76', '\x61', '\x72', '\x20', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x20', '\x3D', '\x20', '\x30', '\x2C', '\x20',
+    '\x72', '\x65', '\x74', '\x72', '\x69', '\x65', '\x73', '\x20', '\x3D', '\x20', '\x30', '\x2C', '\x20', '\x72', '\x65', '\x73',
+    '\x75', '\x6D', '\x65', '\x20', '\x3D', '\x20', '\x74', '\x72', '\x75', '\x65', '\x3B', '\x0A', '\x77', '\x68', '\x69', '\x6C',
+    '\x65', '\x20', '\x28', '\x72', '\x65', '\x73', '\x75', '\x6D', '\x65', '\x20', '\x7C', '\x7C', '\x20', '\x6F', '\x66', '\x66',
+    '\x73', '\x65', '\x74', '\x20', '\x3C', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x73', '\x69', '\x7A', '\x65', '\x29',
+    '\x20', '\x7B', '\x0A', '\x74', '\x72', '\x79', '\x20', '\x7B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x72', '\x65', '\x73',
+    '\x75', '\x6D', '\x65', '\x29', '\x20', '\x7B', '\x0A', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x20', '\x3D', '\x20',
+    '\x28', '\x61', '\x77', '\x61', '\x69', '\x74', '\x20', '\x70', '\x6F', '\x73', '\x74', '\x28', '\x62', '\x65', '\x67', '\x69',
+    '\x6E', '\x29', '\x29', '\x2E', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x3B', '\x0A', '\x72', '\x65', '\x73', '\x75',
+    '\x6D', '\x65', '\x20', '\x3D', '\x20', '\x66', '\x61', '\x6C', '\x73', '\x65', '\x3B', '\x0A', '\x7D', '\x20', '\x65', '\x6C',
+    '\x73', '\x65', '\x20', '\x7B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x64', '\x61', '\x74', '\x61', '\x20', '\x3D', '\x20',
+    '\x6E', '\x65', '\x77', '\x20', '\x46', '\x6F', '\x72', '\x6D', '\x44', '\x61', '\x74', '\x61', '\x28', '\x29', '\x3B', '\x0A',
+    '\x64', '\x61', '\x74', '\x61', '\x2E', '\x61', '\x70', '\x70', '\x65', '\x6E', '\x64', '\x28', '\x27', '\x75', '\x70', '\x6C',
+    '\x6F', '\x61', '\x64', '\x27', '\x2C', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x73', '\x6C', '\x69', '\x63', '\x65',
+    '\x28', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x2C', '\x20', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x20',
+    '\x2B', '\x20', '\x43', '\x48', '\x55', '\x4E', '\x4B', '\x29', '\x2C', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x6E',
+    '\x61', '\x6D', '\x65', '\x29', '\x3B', '\x0A', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x20', '\x3D', '\x20', '\x28',
+    '\x61', '\x77', '\x61', '\x69', '\x74', '\x20', '\x70', '\x6F', '\x73', '\x74', '\x28', '\x27', '\x2F', '\x75', '\x70', '\x6C',
+    '\x6F', '\x61', '\x64', '\x2F', '\x63', '\x68', '\x75', '\x6E', '\x6B', '\x3F', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74',
+    '\x3D', '\x27', '\x20', '\x2B', '\x20', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x2C', '\x20', '\x64', '\x61', '\x74',
+    '\x61', '\x29', '\x29', '\x2E', '\x6F', '\x66', '\x66', '\x73', '\x65', '\x74', '\x3B', '\x0A', '\x7D', '\x0A', '\x72', '\x65',
+    '\x74', '\x72', '\x69', '\x65', '\x73', '\x20', '\x3D', '\x20', '\x30', '\x3B', '\x0A', '\x7D', '\x20', '\x63', '\x61', '\x74',
+    '\x63', '\x68', '\x20', '\x28', '\x65', '\x29', '\x20', '\x7B', '\x0A', '\x2F', '\x2F', '\x20', '\x66', '\x65', '\x74', '\x63',
+    '\x68', '\x28', '\x29', '\x20', '\x66', '\x61', '\x69', '\x6C', '\x73', '\x20', '\x77', '\x69', '\x74', '\x68', '\x20', '\x61',
+    '\x20', '\x54', '\x79', '\x70', '\x65', '\x45', '\x72', '\x72', '\x6F', '\x72', '\x20', '\x77', '\x68', '\x65', '\x6E', '\x20',
+    '\x74', '\x68', '\x65', '\x20', '\x63', '\x6F', '\x6E', '\x6E', '\x65', '\x63', '\x74', '\x69', '\x6F', '\x6E', '\x20', '\x69',
+    '\x73', '\x20', '\x6C', '\x6F', '\x73', '\x74', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x21', '\x28', '\x65', '\x20', '\x69',
+    '\x6E', '\x73', '\x74', '\x61', '\x6E', '\x63', '\x65', '\x6F', '\x66', '\x20', '\x54', '\x79', '\x70', '\x65', '\x45', '\x72',
+    '\x72', '\x6F', '\x72', '\x29', '\x20', '\x7C', '\x7C', '\x20', '\x2B', '\x2B', '\x72', '\x65', '\x74', '\x72', '\x69', '\x65',
+    '\x73', '\x20', '\x3E', '\x20', '\x52', '\x45', '\x54', '\x52', '\x49', '\x45', '\x53', '\x29', '\x20', '\x74', '\x68', '\x72',
+    '\x6F', '\x77', '\x20', '\x65', '\x3B', '\x0A', '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E', '\x65', '\x72',
+    '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D', '\x20', '\x27', '\x63', '\x6F', '\x6E', '\x6E', '\x65', '\x63', '\x74', '\x69',
+    '\x6F', '\x6E', '\x20', '\x6C', '\x6F', '\x73', '\x74', '\x2C', '\x20', '\x72', '\x65', '\x73', '\x75', '\x6D', '\x69', '\x6E',
+    '\x67', '\x27', '\x3B', '\x0A', '\x61', '\x77', '\x61', '\x69', '\x74', '\x20', '\x6E', '\x65', '\x77', '\x20', '\x50', '\x72',
+    '\x6F', '\x6D', '\x69', '\x73', '\x65', '\x28', '\x72', '\x20', '\x3D', '\x3E', '\x20', '\x73', '\x65', '\x74', '\x54', '\x69',
+    '\x6D', '\x65', '\x6F', '\x75', '\x74', '\x28', '\x72', '\x2C', '\x20', '\x32', '\x30', '\x30', '\x30', '\x29', '\x29', '\x3B',
+    '\x0A', '\x72', '\x65', '\x73', '\x75', '\x6D', '\x65', '\x20', '\x3D', '\x20', '\x74', '\x72', '\x75', '\x65', '\x3B', '\x0A',
+    '\x7D', '\x0A', '\x70', '\x72', '\x6F', '\x67', '\x72', '\x65', '\x73', '\x73', '\x28', '\x6F', '\x66', '\x66', '\x73', '\x65',
+    '\x74', '\x2C', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E', '\x73', '\x69', '\x7A', '\x65', '\x29', '\x3B', '\x0A', '\x7D',
+    '\x0A', '\x70', '\x72', '\x67', '\x2E', '\x73', '\x74', '\x79', '\x6C', '\x65', '\x2E', '\x62', '\x61', '\x63', '\x6B', '\x67',
+    '\x72', '\x6F', '\x75', '\x6E', '\x64', '\x43', '\x6F', '\x6C', '\x6F', '\x72', '\x20', '\x3D', '\x20', '\x27', '\x62', '\x6C',
+    '\x61', '\x63', '\x6B', '\x27', '\x3B', '\x0A', '\x61', '\x77', '\x61', '\x69', '\x74', '\x20', '\x70', '\x6F', '\x73', '\x74',
+    '\x28', '\x27', '\x2F', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x2F', '\x65', '\x6E', '\x64', '\x27', '\x29', '\x3B',
+    '\x0A', '\x7D', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x66', '\x6F', '\x72', '\x6D', '\x20', '\x3D', '\x20', '\x64', '\x6F',
+    '\x63', '\x75', '\x6D', '\x65', '\x6E', '\x74', '\x2E', '\x67', '\x65', '\x74', '\x45', '\x6C', '\x65', '\x6D', '\x65', '\x6E',
+    '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x75', '\x70', '\x6C', '\x6F', '\x61', '\x64', '\x2D', '\x66', '\x6F',
+    '\x72', '\x6D', '\x27', '\x29', '\x3B', '\x0A', '\x66', '\x6F', '\x72', '\x6D', '\x2E', '\x61', '\x64', '\x64', '\x45', '\x76',
+    '\x65', '\x6E', '\x74', '\x4C', '\x69', '\x73', '\x74', '\x65', '\x6E', '\x65', '\x72', '\x28', '\x27', '\x73', '\x75', '\x62',
+    '\x6D', '\x69', '\x74', '\x27', '\x2C', '\x20', '\x65', '\x6C', '\x20', '\x3D', '\x3E', '\x20', '\x7B', '\x0A', '\x65', '\x6C',
+    '\x2E', '\x70', '\x72', '\x65', '\x76', '\x65', '\x6E', '\x74', '\x44', '\x65', '\x66', '\x61', '\x75', '\x6C', '\x74', '\x28',
+    '\x29', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x20', '\x3D', '\x20', '\x64', '\x6F',
+    '\x63', '\x75', '\x6D', '\x65', '\x6E', '\x74', '\x2E', '\x67', '\x65', '\x74', '\x45', '\x6C', '\x65', '\x6D', '\x65', '\x6E',
+    '\x74', '\x42', '\x79', '\x49', '\x64', '\x28', '\x27', '\x66', '\x69', '\x6C', '\x65', '\x27', '\x29', '\x2E', '\x66', '\x69',
+    '\x6C', '\x65', '\x73', '\x5B', '\x30', '\x5D', '\x3B', '\x0A', '\x69', '\x66', '\x20', '\x28', '\x21', '\x66', '\x69', '\x6C',
+    '\x65', '\x29', '\x20', '\x72', '\x65', '\x74', '\x75', '\x72', '\x6E', '\x3B', '\x0A', '\x70', '\x72', '\x67', '\x2E', '\x73',
+    '\x74', '\x79', '\x6C', '\x65', '\x2E', '\x62', '\x61', '\x63', '\x6B', '\x67', '\x72', '\x6F', '\x75', '\x6E', '\x64', '\x43',
+    '\x6F', '\x6C', '\x6F', '\x72', '\x20', '\x3D', '\x20', '\x27', '\x62', '\x6C', '\x75', '\x65', '\x27', '\x3B', '\x0A', '\x70',
+    '\x72', '\x6F', '\x67', '\x72', '\x65', '\x73', '\x73', '\x28', '\x30', '\x2C', '\x20', '\x66', '\x69', '\x6C', '\x65', '\x2E',
+    '\x73', '\x69', '\x7A', '\x65', '\x29', '\x3B', '\x0A', '\x76', '\x61', '\x72', '\x20', '\x74', '\x69', '\x6D', '\x65', '\x72',
+    '\x20', '\x3D', '\x20', '\x73', '\x65', '\x74', '\x49', '\x6E', '\x74', '\x65', '\x72', '\x76', '\x61', '\x6C', '\x28', '\x73',
+    '\x74', '\x61', '\x74', '\x75', '\x73', '\x2C', '\x20', '\x31', '\x30', '\x30', '\x30', '\x29', '\x3B', '\x0A', '\x75', '\x70',
+    '\x6C', '\x6F', '\x61', '\x64', '\x28', '\x66', '\x69', '\x6C', '\x65', '\x29', '\x2E', '\x74', '\x68', '\x65', '\x6E', '\x28',
+    '\x28', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x7B', '\x0A', '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E',
+    '\x65', '\x72', '\x48', '\x54', '\x4D', '\x4C', '\x20', '\x3D', '\x20', '\x27', '\x55', '\x70', '\x64', '\x61', '\x74', '\x65',
+    '\x20', '\x53', '\x75', '\x63', '\x63', '\x65', '\x73', '\x73', '\x2C', '\x20', '\x72', '\x65', '\x62', '\x6F', '\x6F', '\x74',
+    '\x69', '\x6E', '\x67', '\x27', '\x3B', '\x0A', '\x73', '\x65', '\x74', '\x54', '\x69', '\x6D', '\x65', '\x6F', '\x75', '\x74',
+    '\x28', '\x28', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x6C', '\x6F', '\x63', '\x61', '\x74', '\x69', '\x6F', '\x6E', '\x2E',
+    '\x68', '\x72', '\x65', '\x66', '\x20', '\x3D', '\x20', '\x27', '\x2F', '\x27', '\x2C', '\x20', '\x31', '\x30', '\x30', '\x30',
+    '\x30', '\x29', '\x3B', '\x0A', '\x7D', '\x29', '\x2E', '\x63', '\x61', '\x74', '\x63', '\x68', '\x28', '\x65', '\x20', '\x3D',
+    '\x3E', '\x20', '\x72', '\x61', '\x74', '\x65', '\x2E', '\x69', '\x6E', '\x6E', '\x65', '\x72', '\x48', '\x54', '\x4D', '\x4C',
+    '\x20', '\x3D', '\x20', '\x65', '\x2E', '\x6D', '\x65', '\x73', '\x73', '\x61', '\x67', '\x65', '\x29', '\x2E', '\x66', '\x69',
+    '\x6E', '\x61', '\x6C', '\x6C', '\x79', '\x28', '\x28', '\x29', '\x20', '\x3D', '\x3E', '\x20', '\x63', '\x6C', '\x65', '\x61',
+    '\x72', '\x49', '\x6E', '\x74', '\x65', '\x72', '\x76', '\x61', '\x6C', '\x28', '\x74', '\x69', '\x6D', '\x65', '\x72', '\x29',
+    '\x29', '\x3B', '\x0A', '\x7D', '\x29', '\x3B', '\x0A', '\x3C', '\x2F', '\x73', '\x63', '\x72', '\x69', '\x70', '\x74', '\x3E',
+};
+constexpr size_t UPDATE_HTML_LEN = sizeof(UPDATE_HTML);
+constexpr char UPDATE_HTML_GZ[] PROGMEM = {
+    '\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x7D', '\x58', '\x6B', '\x6F', '\xDB', '\xB8',
+    '\x12', '\xFD', '\xEE', '\x5F', '\x31', '\x29', '\xD0', '\x4A', '\x5A', '\x2B', '\xF2', '\x23', '\xA9', '\xF3', '\xF0', '\xA3',
+    '\xD8', '\xB6', '\x59', '\x6C', '\xB0', '\x8F', '\x06', '\x4D', '\x7A', '\x81', '\x8B', '\x20', '\x17', '\xA0', '\x65', '\xCA',
+    '\x92', '\x23', '\x4B', '\x02', '\x49', '\xC7', '\xF1', '\xB6', '\xD9', '\xDF', '\xBE', '\x67', '\x48', '\xC9', '\x71', '\xB2',
+    '\xB9', '\x41', '\x11', '\x8B', '\x1A', '\x0D', '\xE7', '\x71', '\x66', '\x38', '\x33', '\xEC', '\x68', '\xEF', '\xF3', '\x97',
+    '\x4F', '\x57', '\xFF', '\xBD', '\x38', '\xA3', '\xD4', '\x2C', '\xF3', '\x49', '\x6B', '\x94', '\x67', '\xC5', '\x2D', '\x29',
+    '\x99', '\x8F', '\xBD', '\x2C', '\x2E', '\x0B', '\x8F', '\x52', '\x25', '\x93', '\xB1', '\xD7', '\x49', '\xC4', '\x1D', '\xBF',
+    '\x47', '\xF8', '\xF1', '\x48', '\x67', '\x7F', '\x49', '\x3D', '\xF6', '\x44', '\xB1', '\xF1', '\xB0', '\x63', '\x5A', '\xCE',
+    '\x36', '\xA4', '\xCD', '\x26', '\x97', '\x63', '\x6F', '\x9D', '\xCD', '\x4C', '\x7A', '\x7A', '\x78', '\xDC', '\xAD', '\xEE',
+    '\xF9', '\x53', '\xDA', '\x9F', '\x9C', '\x5D', '\x5E', '\xD0', '\x2F', '\x99', '\x5A', '\xAE', '\x85', '\x92', '\xF4', '\xAD',
+    '\x9A', '\x09', '\x23', '\xD5', '\xA8', '\x83', '\x0F', '\xAD', '\x51', '\x52', '\xAA', '\x25', '\x2D', '\xA5', '\x49', '\xCB',
+    '\xD9', '\xD8', '\xBB', '\xF8', '\x72', '\x79', '\xE5', '\x91', '\x2C', '\x62', '\xB3', '\xA9', '\x20', '\x68', '\xB9', '\xCA',
+    '\x4D', '\x56', '\x09', '\x65', '\x3A', '\xCC', '\xB5', '\x8F', '\x6D', '\xC2', '\xA3', '\x0C', '\x7C', '\xAB', '\x2A', '\x2F',
+    '\xC5', '\x6C', '\x9F', '\xA9', '\xAC', '\x21', '\x2B', '\xAA', '\x95', '\x21', '\xB7', '\x27', '\xC9', '\x72', '\xE9', '\x98',
+    '\xDC', '\xAA', '\x10', '\x4B', '\xD9', '\x6C', '\xF0', '\x48', '\xC4', '\xB1', '\xAC', '\xCC', '\xF8', '\x4D', '\x34', '\xCD',
+    '\x8A', '\x30', '\x5A', '\x25', '\xFD', '\x30', '\x9A', '\xFF', '\x15', '\x46', '\xA9', '\x7E', '\xF3', '\x4C', '\x8C', '\x5E',
+    '\x4D', '\x97', '\x99', '\xF1', '\xE8', '\x4E', '\xE4', '\xAB', '\xC7', '\xFD', '\x60', '\xB2', '\xA6', '\xB0', '\xC3', '\x0A',
+    '\x3F', '\xC2', '\x21', '\xF3', '\xA6', '\xF3', '\x66', '\x32', '\x15', '\xF1', '\xED', '\xA8', '\x23', '\x40', '\x9C', '\x65',
+    '\x77', '\x56', '\x7F', '\xA5', '\xE6', '\xDE', '\x53', '\x48', '\xBA', '\xC3', '\xB8', '\xCC', '\x4B', '\x75', '\xBA', '\x4E',
+    '\x33', '\x23', '\x87', '\x46', '\xDE', '\x9B', '\x7D', '\x91', '\x67', '\xF3', '\xE2', '\x34', '\x96', '\x05', '\x10', '\xF1',
+    '\x26', '\xDD', '\xB7', '\xA3', '\x0E', '\xB6', '\x43', '\x48', '\x65', '\x45', '\x28', '\x00', '\xE5', '\x4D', '\x46', '\x9D',
+    '\x8A', '\x15', '\x33', '\xC4', '\x78', '\xEA', '\x58', '\x65', '\x95', '\x99', '\xB4', '\xEE', '\x84', '\x22', '\xA8', '\xA0',
+    '\x31', '\xCD', '\xCA', '\x78', '\xB5', '\x84', '\x84', '\x68', '\x2E', '\xCD', '\x59', '\x2E', '\x79', '\xF9', '\x71', '\x73',
+    '\x3E', '\xF3', '\xAD', '\x05', '\xC1', '\xD0', '\x72', '\xB2', '\xA4', '\xD7', '\x58', '\xAD', '\x26', '\xF0', '\x76', '\x3A',
+    '\xF4', '\xA5', '\xC8', '\x37', '\x54', '\x16', '\x92', '\xAA', '\x32', '\xCF', '\x49', '\x18', '\x12', '\x64', '\xB2', '\xA5',
+    '\x0C', '\xC9', '\xA4', '\x92', '\xF4', '\xA6', '\x88', '\x53', '\x55', '\x16', '\xE5', '\x4A', '\x93', '\x96', '\xEA', '\x4E',
+    '\x2A', '\x12', '\x85', '\x5E', '\x4B', '\xA5', '\x29', '\x03', '\x67', '\x02', '\x37', '\x2C', '\x9F', '\x03', '\xCC', '\x19',
+    '\x09', '\x31', '\x59', '\xC1', '\x86', '\x26', '\x22', '\xD7', '\x72', '\xD8', '\x4A', '\x56', '\x08', '\x70', '\x56', '\x16',
+    '\x00', '\x47', '\x98', '\x95', '\xF6', '\x81', '\x68', '\x2C', '\x03', '\xFA', '\xDE', '\xCA', '\x12', '\xF2', '\x1B', '\xEE',
+    '\x77', '\xEF', '\x68', '\xAF', '\xFE', '\xA0', '\xA4', '\x59', '\xA9', '\x62', '\xD8', '\x7A', '\x14', '\x64', '\xD4', '\x8A',
+    '\xE5', '\x48', '\x13', '\xA7', '\xBE', '\xD7', '\x71', '\xBA', '\x3A', '\x4E', '\x9A', '\x17', '\x44', '\xD0', '\x5F', '\xF8',
+    '\x8A', '\xC6', '\x13', '\x52', '\xD1', '\x42', '\x97', '\x85', '\x1F', '\xD4', '\x34', '\xCD', '\x34', '\xA7', '\x46', '\x47',
+    '\xCC', '\x0E', '\x48', '\xC6', '\xE4', '\x25', '\x02', '\x99', '\x32', '\xF3', '\x02', '\x0B', '\x52', '\x94', '\x15', '\x85',
+    '\x54', '\xBF', '\x5E', '\xFD', '\xF1', '\x3B', '\xF4', '\xE8', '\x48', '\x2A', '\x55', '\xAA', '\x61', '\x4B', '\xC2', '\xF0',
+    '\x97', '\x3E', '\x3B', '\x21', '\x6D', '\xF2', '\x42', '\xF2', '\xF0', '\xF8', '\x43', '\x98', '\x34', '\x52', '\xE5', '\xAA',
+    '\x98', '\x41', '\xC1', '\x74', '\x63', '\xA4', '\xBE', '\x90', '\xEA', '\x52', '\xE2', '\xCC', '\xCC', '\xA8', '\x43', '\xBD',
+    '\x6E', '\xFF', '\x30', '\x60', '\x66', '\xFA', '\xED', '\x63', '\x47', '\x7B', '\xC3', '\xD6', '\x43', '\x10', '\xC5', '\x82',
+    '\x7D', '\xF0', '\x03', '\x6B', '\x19', '\xDE', '\x93', '\xAC', '\x10', '\x79', '\xBE', '\xA9', '\x29', '\xCF', '\xA0', '\x43',
+    '\x7C', '\x1E', '\x38', '\x42', '\xB1', '\xDA', '\x54', '\xA6', '\x8C', '\x90', '\xA3', '\x26', '\x97', '\x94', '\x69', '\x5A',
+    '\x66', '\x5A', '\x33', '\x1F', '\x30', '\xAD', '\x72', '\x91', '\x15', '\x38', '\xC7', '\xA6', '\xA2', '\x4A', '\xCC', '\xA5',
+    '\x0E', '\x49', '\x97', '\x36', '\x22', '\xA9', '\xD0', '\x29', '\xF3', '\xC6', '\xE5', '\x12', '\x69', '\x2E', '\x67', '\x94',
+    '\x4A', '\x25', '\x77', '\x62', '\x91', '\x8A', '\xFE', '\xFB', '\x81', '\xCF', '\x67', '\x8C', '\x43', '\xC1', '\x81', '\xBB',
+    '\x85', '\xDE', '\xEB', '\x9B', '\x90', '\xD2', '\xFA', '\xB9', '\xC6', '\xB3', '\x90', '\x6B', '\xFA', '\x59', '\x29', '\xB1',
+    '\xF1', '\x07', '\x87', '\x41', '\x48', '\x59', '\x48', '\x0B', '\x04', '\xA2', '\x54', '\xE4', '\xF3', '\x8E', '\x02', '\x1C',
+    '\xFD', '\x90', '\x2A', '\x3C', '\xBA', '\x43', '\x3C', '\x46', '\x34', '\x38', '\x1C', '\x52', '\xD1', '\x6E', '\xB3', '\x48',
+    '\xCB', '\xB5', '\x60', '\x8E', '\x21', '\x2D', '\xE8', '\x27', '\xFC', '\x8D', '\x20', '\x8F', '\x03', '\x5D', '\xD0', '\x5B',
+    '\x88', '\xA1', '\x05', '\xF8', '\x86', '\x36', '\x3A', '\xEE', '\xF3', '\x84', '\x8A', '\x6D', '\x56', '\x40', '\xD4', '\x71',
+    '\x40', '\xE9', '\x75', '\x75', '\x03', '\x01', '\x16', '\xE6', '\xAA', '\x5C', '\xFB', '\x45', '\x48', '\x3D', '\x00', '\xDB',
+    '\x0F', '\xC0', '\x7F', '\xD8', '\x3F', '\x39', '\x3C', '\x19', '\x1C', '\xF5', '\x4F', '\x06', '\xF4', '\x03', '\xDA', '\x5B',
+    '\xB7', '\xD7', '\x55', '\xBB', '\xFD', '\x12', '\xF7', '\xC1', '\x4B', '\xDC', '\x0F', '\xF8', '\xC7', '\x1E', '\x4C', '\x33',
+    '\xA3', '\xF9', '\x9C', '\x00', '\x86', '\x28', '\x97', '\xC5', '\xDC', '\xA4', '\x60', '\x3E', '\x0E', '\xA9', '\x5E', '\x8F',
+    '\xC9', '\xDF', '\xFD', '\xD4', '\xA6', '\x23', '\xE8', '\x7E', '\x47', '\x7F', '\x0F', '\x0E', '\xDC', '\x31', '\x5B', '\xD6',
+    '\x10', '\x7D', '\xCB', '\x0A', '\x73', '\xEC', '\x70', '\x72', '\xAC', '\x70', '\x6C', '\x19', '\x69', '\x69', '\x1C', '\xC0',
+    '\x78', '\xB9', '\xDE', '\x91', '\xC3', '\x56', '\x76', '\xEF', '\x8F', '\xBB', '\x4E', '\xC6', '\x5D', '\x26', '\x1B', '\xA4',
+    '\x3F', '\x83', '\xE7', '\x3F', '\x78', '\xF5', '\x97', '\xD1', '\x74', '\x95', '\x24', '\x52', '\xF1', '\x69', '\xC6', '\x3B',
+    '\x4B', '\x62', '\x15', '\x07', '\xFD', '\x5A', '\x3C', '\xED', '\xB3', '\x91', '\xD6', '\xD3', '\x24', '\x2F', '\x4B', '\xE5',
+    '\x5B', '\x3F', '\x3A', '\x3B', '\x6E', '\x06', '\xAF', '\x6C', '\x3D', '\x0C', '\x9D', '\xDF', '\x93', '\xC9', '\x84', '\xBA',
+    '\x4D', '\xC1', '\x60', '\x5F', '\xEF', '\x43', '\x0E', '\x01', '\x12', '\xD1', '\xBF', '\xB7', '\x1F', '\xF1', '\xF2', '\x83',
+    '\xD7', '\xA3', '\x11', '\xF9', '\x07', '\x7D', '\xEC', '\x2C', '\x58', '\xAC', '\x0D', '\x6C', '\xE6', '\x62', '\x9E', '\x21',
+    '\x50', '\x4E', '\x2E', '\xAF', '\xDB', '\x63', '\x24', '\xC0', '\x93', '\xD8', '\x77', '\x39', '\xF6', '\x2E', '\x2D', '\x16',
+    '\x2E', '\x2D', '\xD6', '\xD7', '\x0B', '\xF6', '\x9F', '\xA9', '\xBD', '\x01', '\x7D', '\xB0', '\xEE', '\x73', '\x79', '\xAA',
+    '\x8D', '\x84', '\x10', '\x9B', '\x2D', '\x10', '\x73', '\xDA', '\xF2', '\x95', '\x0F', '\x76', '\xE8', '\xED', '\x23', '\x1D',
+    '\x7B', '\x47', '\x01', '\xFD', '\x8F', '\x9E', '\x50', '\x4E', '\x98', '\xB2', '\x25', '\x58', '\x93', '\x7B', '\xDD', '\x80',
+    '\xCF', '\x9C', '\xA3', '\x1D', '\xDD', '\x50', '\xFB', '\x51', '\x48', '\xEF', '\x3D', '\xF6', '\x3C', '\x11', '\x62', '\x29',
+    '\xBD', '\xE3', '\x1D', '\x29', '\xA0', '\x58', '\x31', '\x07', '\x3B', '\x52', '\x7A', '\x83', '\x9B', '\x26', '\x69', '\x18',
+    '\xA9', '\x6B', '\x01', '\xF8', '\x42', '\x8A', '\x43', '\x9A', '\x85', '\x84', '\x32', '\x99', '\x84', '\x34', '\xC7', '\xA1',
+    '\xB1', '\x51', '\x4D', '\x87', '\xAF', '\xB9', '\xCE', '\xBB', '\x4D', '\x8F', '\xD9', '\x38', '\x95', '\x60', '\x17', '\x76',
+    '\x0F', '\x9C', '\x3D', '\x58', '\xF5', '\x7A', '\xDB', '\x65', '\xFF', '\xBD', '\x55', '\xEF', '\xFB', '\x12', '\xC9', '\x96',
+    '\x58', '\xF3', '\xFE', '\xE6', '\xE5', '\xDC', '\x92', '\x6F', '\x19', '\x41', '\x6B', '\x5C', '\x6D', '\x97', '\x95', '\xDB',
+    '\xE7', '\x00', '\x2A', '\x1F', '\xC6', '\xF5', '\x9D', '\x1C', '\xAC', '\x7A', '\x07', '\xDB', '\x65', '\xBF', '\x5F', '\x8B',
+    '\x14', '\x90', '\x33', '\xB5', '\x22', '\x79', '\x15', '\xDB', '\xD5', '\xD4', '\xAE', '\x02', '\x27', '\x2D', '\xE5', '\xB4',
+    '\x9F', '\x0F', '\xC9', '\x96', '\xA1', '\x21', '\x25', '\x78', '\xC8', '\x21', '\xD9', '\x6E', '\x02', '\x01', '\xB0', '\x9F',
+    '\xB9', '\xB0', '\x1E', '\x53', '\x3C', '\xA4', '\x18', '\x8F', '\xE9', '\x90', '\xA6', '\x78', '\x88', '\x21', '\x3A', '\xC7',
+    '\x98', '\x19', '\xDA', '\x6C', '\x4D', '\x8D', '\x98', '\x2D', '\x26', '\xFF', '\x0F', '\xB1', '\x68', '\x29', '\x2A', '\xFF',
+    '\x31', '\xEB', '\xD2', '\xEB', '\x82', '\x1D', '\xBB', '\xE7', '\xBD', '\xB6', '\xF6', '\xB9', '\x4E', '\x40', '\xA9', '\xE5',
+    '\xBB', '\xDF', '\x49', '\xCC', '\x2E', '\x2A', '\x7C', '\x79', '\x69', '\x14', '\x8A', '\xA0', '\xDF', '\x1B', '\x04', '\x51',
+    '\x25', '\x66', '\x97', '\x06', '\x83', '\x83', '\x8F', '\x53', '\xE1', '\x75', '\x3D', '\x34', '\x80', '\x45', '\x99', '\x15',
+    '\xBE', '\xE7', '\x59', '\x31', '\xDB', '\xA2', '\x57', '\xA9', '\x72', '\xAE', '\xA4', '\xD6', '\x7E', '\x99', '\x24', '\x38',
+    '\x17', '\xA1', '\x1D', '\x6A', '\x9A', '\xC8', '\xAC', '\x9B', '\xDA', '\xE1', '\x0A', '\xBA', '\x63', '\xC1', '\x99', '\x62',
+    '\x1E', '\x24', '\x64', '\xAF', '\xDB', '\xB5', '\xC5', '\xFC', '\x2D', '\x0A', '\x39', '\x1A', '\xED', '\x93', '\xC6', '\xB0',
+    '\x76', '\x24', '\xDB', '\xFC', '\x23', '\xDB', '\xFB', '\x1D', '\x71', '\x57', '\x75', '\xA9', '\x8D', '\xBF', '\x52', '\x39',
+    '\x90', '\x40', '\x5F', '\x67', '\x9D', '\xB5', '\x73', '\xAE', '\xAB', '\xD9', '\x2F', '\xDF', '\xDD', '\x5C', '\x74', '\x4A',
+    '\x6E', '\x30', '\x72', '\xAC', '\xA7', '\xF6', '\xF7', '\x61', '\xB7', '\xCD', '\x7D', '\xE7', '\xA6', '\x70', '\x95', '\xBA',
+    '\x0E', '\x45', '\x79', '\x86', '\xC9', '\x65', '\xB7', '\x2F', '\x37', '\x4D', '\x81', '\x07', '\x0E', '\x50', '\x67', '\x58',
+    '\xE4', '\xB9', '\xA6', '\x35', '\xF6', '\x93', '\x29', '\xB9', '\x21', '\x48', '\xE2', '\xF1', '\xC5', '\x56', '\x5A', '\x15',
+    '\xB9', '\x3E', '\xCA', '\x9D', '\x11', '\xD5', '\x63', '\x0B', '\x86', '\x40', '\x7B', '\x47', '\x42', '\x61', '\x1A', '\xD3',
+    '\xF2', '\xBC', '\x30', '\xE0', '\x4B', '\xA5', '\x98', '\x41', '\x3E', '\x9F', '\x55', '\xDF', '\xFB', '\x2A', '\x8D', '\xDA',
+    '\xEC', '\xFF', '\xCC', '\xFD', '\xDF', '\xE3', '\xC4', '\xF9', '\x41', '\xBD', '\xC0', '\x81', '\x84', '\xA8', '\xFF', '\xAB',
+    '\x71', '\x7A', '\x33', '\x89', '\x49', '\x12', '\x5A', '\x57', '\x7A', '\x13', '\x5A', '\xD9', '\x08', '\x1C', '\x70', '\xAC',
+    '\x21', '\xE0', '\xD2', '\x77', '\xA1', '\x4A', '\x74', '\x35', '\xE9', '\xAF', '\xD9', '\x41', '\x00', '\x7F', '\x85', '\x11',
+    '\xA4', '\x5C', '\x19', '\x7F', '\xED', '\xF8', '\x9B', '\x96', '\xDE', '\xF4', '\xC9', '\x27', '\x60', '\xEE', '\xE6', '\x4A',
+    '\x33', '\x02', '\x38', '\xF6', '\xC5', '\xE3', '\x04', '\xB0', '\xA7', '\xA2', '\xF2', '\x96', '\xBB', '\xCF', '\xA3', '\xCB',
+    '\x7B', '\x70', '\xB9', '\x7B', '\xC2', '\xC6', '\x2F', '\x5C', '\xE3', '\x87', '\x27', '\x06', '\xD3', '\xCE', '\xDA', '\x5A',
+    '\x74', '\xC6', '\x14', '\xBF', '\xF9', '\xB2', '\x35', '\x76', '\xC1', '\x7D', '\xBC', '\xFE', '\x6B', '\xE2', '\xE0', '\x26',
+    '\x12', '\xEE', '\xB6', '\x1A', '\x13', '\x16', '\x47', '\x20', '\x4E', '\x57', '\xC5', '\x2D', '\x9A', '\xB1', '\xA0', '\x1C',
+    '\xB6', '\x02', '\x73', '\xA0', '\xE1', '\x12', '\x01', '\xF9', '\x87', '\x91', '\x4C', '\xF3', '\xA0', '\xC5', '\x6D', '\xBA',
+    '\x4E', '\x33', '\x5E', '\xD6', '\x20', '\x29', '\x59', '\x95', '\xCA', '\x68', '\x1B', '\x86', '\x4F', '\xBF', '\x7E', '\xFB',
+    '\xF3', '\x37', '\x00', '\x78', '\xD0', '\x3F', '\x1A', '\x20', '\xB5', '\xBF', '\x9E', '\x5D', '\x7D', '\x3D', '\x3F', '\xBB',
+    '\xE4', '\x9E', '\x0A', '\x98', '\x05', '\x0F', '\x67', '\xB4', '\xCD', '\x30', '\x67', '\x84', '\xCF', '\x63', '\x70', '\x13',
+    '\x45', '\x3B', '\x03', '\x8C', '\x9B', '\x5E', '\xFF', '\xAC', '\x51', '\x09', '\x1B', '\x63', '\x66', '\x8F', '\x04', '\x13',
+    '\x3E', '\xDA', '\x8E', '\x83', '\xE1', '\xA9', '\xEE', '\x08', '\x53', '\x39', '\xCF', '\xB8', '\xC1', '\x6F', '\x07', '\x2E',
+    '\x4B', '\xF8', '\xC0', '\xC7', '\x61', '\xCC', '\xC3', '\x8F', '\xDD', '\x69', '\x0F', '\x07', '\x4E', '\xC5', '\x3B', '\xA7',
+    '\xC3', '\x7E', '\xB0', '\x5A', '\x99', '\xE6', '\x66', '\x71', '\x2C', '\x31', '\xE1', '\x97', '\x33', '\xF9', '\xED', '\xEB',
+    '\xF9', '\x27', '\x0C', '\x23', '\x18', '\x35', '\x91', '\x4F', '\x76', '\x37', '\x33', '\xD4', '\xDA', '\x6A', '\x1C', '\x50',
+    '\x36', '\x43', '\x1E', '\x00', '\x55', '\x26', '\x75', '\xF3', '\xC2', '\x78', '\x6D', '\x87', '\x40', '\xCC', '\xD2', '\x98',
+    '\x81', '\xFC', '\x9A', '\x8A', '\xD0', '\xD5', '\x1B', '\x47', '\x8F', '\xF6', '\xB0', '\xF7', '\xC8', '\xCE', '\x3A', '\xEE',
+    '\x8E', '\x93', '\x69', '\x5B', '\x15', '\xB5', '\xEB', '\x36', '\x8B', '\xAC', '\x53', '\xC8', '\x2E', '\xF7', '\x91', '\xA3',
+    '\x5C', '\xAB', '\xAB', '\x87', '\xD7', '\x07', '\xB2', '\xB3', '\xA0', '\xC3', '\x93', '\x7B', '\x78', '\xDD', '\xAA', '\x7F',
+    '\xC1', '\xB5', '\x80', '\xDB', '\xB5', '\x0F', '\xFB', '\x6D', '\x6B', '\x17', '\x55', '\x25', '\x51', '\x36', '\x9A', '\xAB',
+    '\x43', '\x58', '\xDB', '\x93', '\x23', '\xA4', '\xDB', '\x72', '\x53', '\x5B', '\xD0', '\x76', '\x71', '\x0D', '\x6A', '\x9E',
+    '\x1A', '\x85', '\x17', '\xCD', '\xDB', '\x82', '\x6F', '\x13', '\xEA', '\x83', '\xE3', '\xB1', '\x98', '\x36', '\x32', '\xED',
+    '\x80', '\xF1', '\x68', '\xBF', '\x3D', '\x08', '\x0D', '\x7A', '\x6C', '\xBE', '\x9D', '\x38', '\xC9', '\xB7', '\x08', '\x20',
+    '\x5D', '\x5D', '\xB9', '\x09', '\x88', '\x87', '\x60', '\xD4', '\x84', '\x0C', '\xA5', '\x4A', '\xD0', '\x15', '\xEE', '\x40',
+    '\x36', '\xDD', '\xEB', '\x22', '\x81', '\x64', '\xDC', '\xC9', '\x58', '\xA4', '\x35', '\x27', '\xB1', '\x3B', '\x45', '\x68',
+    '\x49', '\x59', '\x81', '\xF3', '\x53', '\xC4', '\xB2', '\x4C', '\x1E', '\x37', '\xDA', '\x12', '\xD0', '\x6E', '\x37', '\xBA',
+    '\x27', '\x4D', '\xAA', '\x36', '\x07', '\x4A', '\xBE', '\x54', '\x15', '\x76', '\x74', '\xB0', '\x82', '\x3A', '\xD6', '\xAE',
+    '\x34', '\x38', '\x0C', '\x76', '\x2B', '\x83', '\x7A', '\x56', '\x19', '\x14', '\x9A', '\x1A', '\xCA', '\x4D', '\x10', '\xEC',
+    '\x04', '\xCD', '\xE5', '\xC8', '\x43', '\xEB', '\x5F', '\x85', '\xFE', '\x31', '\x39', '\xDC', '\xE7', '\xA6', '\x58', '\x73',
+    '\x1D', '\x9C', '\xDB', '\x82', '\xFF', '\x89', '\xAF', '\x6A', '\x6C', '\xD5', '\x34', '\x07', '\x6D', '\x6B', '\xC1', '\xD3',
+    '\x28', '\x20', '\xC2', '\xAE', '\xA5', '\x70', '\x36', '\xD8', '\xAB', '\xEC', '\x2B', '\x77', '\xAC', '\xDD', '\x5B', '\xAB',
+    '\x1B', '\x9B', '\x96', '\x91', '\x98', '\xCD', '\xCE', '\xEE', '\xC0', '\xF1', '\x7B', '\xA6', '\x8D', '\x04', '\x14', '\x7E',
+    '\x73', '\xF3', '\x44', '\x63', '\xCC', '\x5D', '\xB1', '\x92', '\x79', '\x54', '\x29', '\xC9', '\x4C', '\x9F', '\x65', '\x22',
+    '\x70', '\x25', '\xF6', '\xEB', '\x23', '\xC2', '\x3E', '\xBC', '\xA6', '\xCF', '\x5E', '\x80', '\xF9', '\x4A', '\x91', '\x4B',
+    '\x7D', '\xDD', '\xBD', '\x71', '\xA3', '\xF5', '\x9E', '\xAB', '\x07', '\xDB', '\x3B', '\xD5', '\xEB', '\x9E', '\xAF', '\xA4',
+    '\xED', '\x6E', '\x35', '\x78', '\xDD', '\xA7', '\xB8', '\xD9', '\x31', '\x03', '\xE0', '\x33', '\x2F', '\x40', '\x3D', '\xE7',
+    '\x3B', '\x2C', '\xEE', '\xCB', '\xBE', '\xAB', '\xA6', '\xA1', '\x2D', '\xFE', '\x60', '\xDB', '\xAD', '\x43', '\xBB', '\x45',
+    '\xFB', '\xFB', '\x0B', '\x19', '\xE0', '\xFE', '\x6F', '\x80', '\x2E', '\x57', '\xB8', '\xA7', '\x6B', '\xCD', '\x09', '\x30',
+    '\x2D', '\xCB', '\xBA', '\x39', '\xEC', '\x84', '\xDA', '\x09', '\xC8', '\x4B', '\xE4', '\x32', '\x92', '\x25', '\xE2', '\x4B',
+    '\xB8', '\x2D', '\x4C', '\x9E', '\x53', '\x6A', '\x87', '\x85', '\xE6', '\x6E', '\x25', '\xED', '\x45', '\xF0', '\xB9', '\x26',
+    '\x19', '\xA1', '\xE6', '\x6A', '\x5C', '\x90', '\x9E', '\x5F', '\xB9', '\xE2', '\x5C', '\x0A', '\xB5', '\x75', '\xC5', '\xBA',
+    '\x17', '\xD4', '\xE5', '\x7D', '\xD4', '\xA9', '\xEF', '\xDE', '\xFF', '\x00', '\xAB', '\xA9', '\x96', '\xA7', '\x30', '\x11',
+    '\x00', '\x00',
+};
+constexpr size_t UPDATE_HTML_GZ_LEN = sizeof(UPDATE_HTML_GZ);
+
+// favicon.png: 955 bytes, gzip 856 bytes
+constexpr char FAVICON[] PROGMEM = {
+    '\x89', '\x50', '\x4E', '\x47', '\x0D', '\x0A', '\x1A', '\x0A', '\x00', '\x00', '\x00', '\x0D', '\x49', '\x48', '\x44', '\x52',
+    '\x00', '\x00', '\x00', '\x20', '\x00', '\x00', '\x00', '\x20', '\x08', '\x03', '\x00', '\x00', '\x00', '\x44', '\xA4', '\x8A',
+    '\xC6', '\x00', '\x00', '\x01', '\x74', '\x50', '\x4C', '\x54', '\x45', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00',
+    '\x00', '\x00', '\x8E', '\x21', '\x26', '\x01', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x05', '\x00', '\x00', '\x8E', '\x21',
+    '\x26', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00',
+    '\x51', '\x12', '\x15', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x8E',
+    '\x21', '\x26', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00',
+    '\x00', '\x8E', '\x21', '\x26', '\x8E', '\x21', '\x26', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26',
+    '\x00', '\x00', '\x00', '\x45', '\x0C', '\x0E', '\x7C', '\x1D', '\x20', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x8E',
+    '\x21', '\x26', '\x00', '\x00', '\x00', '\x0F', '\x47', '\x3F', '\x00', '\x1E', '\x0E', '\x8E', '\x21', '\x26', '\x0E', '\x9F',
+    '\x4C', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x8E', '\x21', '\x26', '\x8E', '\x21', '\x26',
+    '\x1C', '\x71', '\x83', '\x0E', '\x01', '\x01', '\x7C', '\x1D', '\x20', '\x45', '\x0C', '\x0E', '\x8E', '\x21', '\x26', '\x00',
+    '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x0C', '\xB1', '\x4B', '\x8E', '\x21', '\x26', '\x00', '\x00',
+    '\x00', '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x07', '\x00', '\x00', '\x23', '\x58', '\x6F', '\x8E', '\x21', '\x26',
+    '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x4B', '\x59', '\x43', '\x5B', '\x47', '\x4D', '\x8E', '\x21', '\x26', '\x00',
+    '\x00', '\x00', '\x0C', '\x90', '\x75', '\x0B', '\x84', '\x8A', '\x00', '\x81', '\x87', '\x03', '\x8A', '\x4B', '\x7C', '\x1D',
+    '\x20', '\x03', '\x75', '\x69', '\x20', '\x7B', '\x70', '\x19', '\x8A', '\x65', '\x21', '\x8B', '\x50', '\x00', '\x7F', '\x5A',
+    '\x45', '\x0C', '\x0E', '\x1E', '\x58', '\x92', '\x10', '\x55', '\x8E', '\x00', '\x55', '\x80', '\x2A', '\x5C', '\x86', '\x7C',
+    '\x1D', '\x20', '\x45', '\x0C', '\x0E', '\x26', '\x66', '\x80', '\x00', '\x5B', '\x73', '\x04', '\x4A', '\x7D', '\x2E', '\x53',
+    '\x87', '\x29', '\x6D', '\x73', '\x00', '\x5D', '\x61', '\x8E', '\x21', '\x26', '\x7C', '\x1D', '\x20', '\x45', '\x0C', '\x0E',
+    '\x00', '\x00', '\x00', '\x00', '\x5B', '\x51', '\x3C', '\x64', '\x5E', '\x00', '\x3F', '\x6C', '\x00', '\x68', '\x84', '\x3D',
+    '\x4B', '\x78', '\x00', '\x74', '\x79', '\x32', '\x5E', '\x76', '\x05', '\x52', '\x68', '\x0C', '\xB0', '\x4A', '\x0C', '\xB1',
+    '\x4B', '\x3A', '\x6D', '\x53', '\x06', '\x5B', '\x40', '\x00', '\x32', '\x4A', '\x00', '\x59', '\x3F', '\x61', '\x3B', '\x51',
+    '\x8E', '\x21', '\x26', '\x00', '\x00', '\x00', '\x00', '\x74', '\xAE', '\x7C', '\x1D', '\x20', '\x45', '\x0C', '\x0E', '\x00',
+    '\x9B', '\x7C', '\x00', '\x80', '\xA2', '\x05', '\x8E', '\x80', '\x00', '\xA0', '\x71', '\x00', '\xAB', '\x5D', '\x0E', '\x01',
+    '\x01', '\x00', '\x7C', '\x9E', '\x00', '\x92', '\x75', '\x05', '\xAE', '\x53', '\x08', '\xAB', '\x52', '\x9B', '\x18', '\x3E',
+    '\x4B', '\x00', '\x00', '\x00', '\x6D', '\x74', '\x52', '\x4E', '\x53', '\x00', '\x92', '\x92', '\x53', '\x52', '\x0C', '\x0C',
+    '\xCC', '\xCC', '\x8F', '\x8F', '\xEA', '\x56', '\x03', '\xF3', '\xF2', '\xEB', '\xBB', '\xB5', '\xB5', '\xAE', '\xAE', '\xA9',
+    '\xA9', '\x73', '\x59', '\x36', '\x36', '\x15', '\x15', '\xED', '\xEA', '\xDD', '\xDC', '\x4F', '\x49', '\x2E', '\x09', '\x07',
+    '\xFB', '\xF6', '\xF6', '\xE7', '\xBC', '\xBA', '\x93', '\x92', '\x8F', '\x8F', '\x81', '\x81', '\x74', '\x73', '\x72', '\x70',
+    '\x70', '\x6B', '\x6B', '\x5B', '\x59', '\x47', '\x3C', '\x3C', '\x2E', '\x26', '\x22', '\x22', '\xFE', '\xFC', '\xFC', '\xF1',
+    '\xF1', '\xF0', '\xEF', '\xEE', '\xED', '\xEB', '\xE8', '\xE7', '\xE7', '\xDE', '\xDB', '\xDA', '\xDA', '\xD5', '\xD3', '\xD0',
+    '\xCF', '\xCD', '\xC7', '\xC1', '\xC1', '\xC1', '\xC1', '\xA9', '\xA5', '\x9A', '\x99', '\x98', '\x97', '\x91', '\x8E', '\x80',
+    '\x67', '\x60', '\x5B', '\x38', '\x38', '\x30', '\xBE', '\xA3', '\x9B', '\x74', '\x00', '\x00', '\x01', '\x89', '\x49', '\x44',
+    '\x41', '\x54', '\x38', '\xCB', '\x85', '\xD3', '\xD7', '\x56', '\x02', '\x31', '\x10', '\x06', '\xE0', '\x11', '\x16', '\x29',
+    '\x0A', '\xD8', '\xA5', '\x0B', '\x4A', '\xB1', '\x61', '\xC7', '\x02', '\x22', '\xD8', '\x7B', '\xEF', '\xBD', '\x77', '\x13',
+    '\x17', '\x17', '\xB0', '\xBD', '\xBC', '\x29', '\xEB', '\x91', '\xC4', '\x0B', '\xBE', '\x9B', '\xB9', '\xD8', '\xFF', '\xEC',
+    '\xC9', '\x24', '\x33', '\xC0', '\x99', '\xDA', '\x9D', '\x2E', '\xA0', '\x8E', '\xB7', '\xED', '\xB4', '\x0C', '\x39', '\x3A',
+    '\x2A', '\xA1', '\x94', '\xC9', '\x8C', '\x90', '\x11', '\x08', '\x35', '\x47', '\x3F', '\x54', '\x63', '\x6C', '\x21', '\x55',
+    '\x60', '\x44', '\xDD', '\xB4', '\xB4', '\xB0', '\x40', '\x2D', '\x56', '\x40', '\x36', '\x89', '\xBA', '\x4A', '\x03', '\x53',
+    '\x20', '\xF3', '\xA1', '\x26', '\x1E', '\x00', '\xA2', '\x19', '\xFB', '\x41', '\x36', '\x8C', '\xCC', '\x46', '\x62', '\x3E',
+    '\x97', '\x54', '\x14', '\xC5', '\x82', '\x47', '\xE0', '\x57', '\xD4', '\xCE', '\x4A', '\x03', '\xE2', '\xD4', '\xDC', '\x3B',
+    '\x66', '\x1A', '\x81', '\xB2', '\x47', '\xC0', '\x69', '\xE6', '\xDF', '\xAB', '\xAC', '\xD6', '\x0A', '\xA2', '\xB7', '\xAF',
+    '\xC7', '\x60', '\x30', '\xD8', '\x6C', '\x9D', '\x3C', '\x61', '\x71', '\x00', '\x69', '\xCF', '\xE3', '\x71', '\xA1', '\xA0',
+    '\x0F', '\x04', '\xFE', '\x10', '\x1E', '\xF4', '\x7A', '\x49', '\xBB', '\x30', '\x8A', '\x98', '\x7E', '\x90', '\x0C', '\x60',
+    '\x66', '\x0C', '\xC0', '\xDD', '\x54', '\x57', '\x67', '\x46', '\x56', '\x39', '\x60', '\xC3', '\x96', '\xFA', '\xFA', '\xE6',
+    '\x6A', '\xE0', '\xD2', '\xA8', '\x82', '\x96', '\xEC', '\xD5', '\xFE', '\xDA', '\xFA', '\xDE', '\x45', '\x18', '\x08', '\x03',
+    '\x9E', '\x28', '\x89', '\xB7', '\xD2', '\xC0', '\xCB', '\xE6', '\xAB', '\x6E', '\xE3', '\x89', '\x04', '\x84', '\xCB', '\x1C',
+    '\x27', '\x81', '\xB8', '\xA6', '\x69', '\x3B', '\x37', '\xA9', '\xD4', '\xED', '\xEE', '\x87', '\xA6', '\x5D', '\x92', '\x40',
+    '\x9B', '\xF4', '\x87', '\xF8', '\xCC', '\x01', '\xE8', '\x0E', '\x67', '\xAF', '\xFF', '\x02', '\x47', '\x55', '\x84', '\x53',
+    '\x3F', '\xE4', '\xF9', '\x62', '\x3E', '\xBF', '\x70', '\xA6', '\x1F', '\xD2', '\x51', '\x43', '\x9C', '\x42', '\x10', '\x51',
+    '\x2C', '\x90', '\x9D', '\x7E', '\x63', '\x3E', '\xC3', '\x2C', '\xC0', '\x84', '\x00', '\x4C', '\x84', '\x9B', '\x75', '\x91',
+    '\x29', '\x2C', '\x3D', '\x00', '\x3C', '\xAE', '\x14', '\x9E', '\x59', '\x17', '\xC9', '\x4A', '\xA2', '\xE4', '\x90', '\x5C',
+    '\x26', '\x0C', '\xDC', '\xFF', '\x43', '\x32', '\xCB', '\xC5', '\xE2', '\x1C', '\xAD', '\x72', '\x9B', '\x69', '\x3D', '\x10',
+    '\xFD', '\x8E', '\xC5', '\xBE', '\x22', '\x20', '\x5C', '\x94', '\x78', '\xD5', '\x89', '\xC4', '\xFD', '\x9D', '\x78', '\xD5',
+    '\x65', '\x1F', '\xAB', '\xEC', '\x73', '\x97', '\x1D', '\x98', '\xB2', '\x23', '\x27', '\x0D', '\xAD', '\x5B', '\x0D', '\x28',
+    '\xE2', '\xD0', '\xCA', '\x63', '\xAF', '\xAE', '\x8A', '\x63', '\x2F', '\x2F', '\x8E', '\x49', '\x0D', '\x80', '\xB0', '\x38',
+    '\xE2', '\xEA', '\xF1', '\x80', '\xB0', '\x7A', '\xC2', '\xF2', '\xB2', '\x40', '\x0E', '\xC4', '\xE5', '\x95', '\xD6', '\xDF',
+    '\xBE', '\x75', '\x02', '\xE2', '\xFA', '\xFF', '\x00', '\xFA', '\xFE', '\x6F', '\xD1', '\x22', '\x63', '\x63', '\x1C', '\x00',
+    '\x00', '\x00', '\x00', '\x49', '\x45', '\x4E', '\x44', '\xAE', '\x42', '\x60', '\x82',
+};
+constexpr size_t FAVICON_LEN = sizeof(FAVICON);
+constexpr char FAVICON_GZ[] PROGMEM = {
+    '\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\xEB', '\x0C', '\xF0', '\x73', '\xE7', '\xE5',
+    '\x92', '\xE2', '\x62', '\x60', '\x60', '\xE0', '\xF5', '\xF4', '\x70', '\x09', '\x02', '\xD2', '\x0A', '\x20', '\xCC', '\xC1',
+    '\x0C', '\x24', '\x5D', '\x96', '\x74', '\x1D', '\x63', '\x60', '\x60', '\x2C', '\x09', '\xF0', '\x09', '\x71', '\x05', '\x72',
+    '\xFB', '\x14', '\xD5', '\x20', '\x24', '\x23', '\x98', '\x64', '\x45', '\x12', '\x81', '\x93', '\x81', '\x42', '\xA2', '\x70',
+    '\x36', '\x03', '\x36', '\x05', '\x40', '\x12', '\x82', '\xE0', '\x22', '\xAE', '\x3C', '\x7C', '\x35', '\xB2', '\x0A', '\xC8',
+    '\x22', '\xFC', '\xEE', '\xF6', '\x0C', '\x72', '\x7C', '\x40', '\x36', '\xDF', '\x7C', '\x1F', '\x64', '\xA3', '\x80', '\x48',
+    '\xA6', '\xB0', '\x99', '\x8F', '\x91', '\x11', '\xA8', '\x1E', '\xA8', '\x0B', '\x2E', '\x05', '\x04', '\x3C', '\x1B', '\xBD',
+    '\x91', '\x4D', '\x60', '\x67', '\x60', '\x50', '\x8E', '\xC8', '\x87', '\x5B', '\xE4', '\x1D', '\xE9', '\x1C', '\xED', '\xEE',
+    '\x0B', '\x61', '\xF3', '\x4C', '\x28', '\xE5', '\x6E', '\xE9', '\x62', '\x68', '\x6C', '\x67', '\xEE', '\xF2', '\x06', '\x9A',
+    '\xC3', '\x5C', '\x9A', '\xA9', '\x50', '\x5D', '\x20', '\xD9', '\x95', '\xAA', '\xD8', '\x1D', '\xC0', '\x50', '\x1F', '\x05',
+    '\x34', '\x56', '\x2E', '\x62', '\x92', '\x40', '\x68', '\x1F', '\x43', '\x68', '\x83', '\x56', '\x4C', '\x1B', '\xC4', '\x22',
+    '\xB5', '\xB4', '\x06', '\x86', '\xE8', '\x62', '\x16', '\xAF', '\x5A', '\xBD', '\xE0', '\x76', '\xCD', '\xDC', '\x62', '\x86',
+    '\xD8', '\x44', '\xA0', '\x51', '\x10', '\x29', '\x90', '\xDD', '\xD1', '\x81', '\x36', '\x29', '\x71', '\x0C', '\xF6', '\x39',
+    '\x0C', '\x19', '\x2D', '\xB6', '\xDE', '\x15', '\x0C', '\x25', '\x95', '\x46', '\x71', '\x65', '\xAC', '\x41', '\x19', '\x3C',
+    '\x1B', '\xBC', '\x80', '\xAE', '\xB2', '\xCA', '\x0D', '\x66', '\x8B', '\x76', '\x60', '\x30', '\xF2', '\x62', '\x88', '\xB4',
+    '\x4F', '\xB4', '\x0E', '\x84', '\xBA', '\xB9', '\x64', '\x1D', '\x54', '\xFB', '\xEC', '\x1A', '\x86', '\x86', '\x45', '\xAC',
+    '\x7D', '\x0D', '\x0C', '\x0B', '\x0A', '\x19', '\x56', '\xC7', '\x02', '\xBD', '\xC6', '\x50', '\x33', '\x8F', '\x61', '\x52',
+    '\x29', '\xEB', '\xBA', '\x60', '\x8E', '\xD5', '\x41', '\xB3', '\x25', '\xEC', '\xBC', '\x81', '\x8A', '\x73', '\x4B', '\x82',
+    '\xFC', '\x82', '\x19', '\x26', '\x4D', '\x0A', '\x0E', '\xE2', '\xE1', '\x39', '\x73', '\xA6', '\xBF', '\xFF', '\x55', '\x18',
+    '\xF3', '\xE7', '\x4F', '\xAF', '\x77', '\x6F', '\xDD', '\xBA', '\x6E', '\xDD', '\xCA', '\x95', '\xC5', '\x91', '\x66', '\x66',
+    '\xA2', '\xA2', '\x6F', '\x5F', '\xDD', '\xBD', '\xE3', '\xEF', '\xA9', '\xC7', '\xC9', '\xFE', '\xFB', '\xDB', '\xB7', '\xE7',
+    '\x7B', '\x76', '\x4D', '\x9E', '\xD4', '\xDF', '\xDF', '\xD8', '\x58', '\x52', '\x5C', '\x54', '\x50', '\x90', '\x9D', '\x1D',
+    '\x1D', '\xE9', '\x6E', '\x63', '\xA3', '\xA7', '\xA6', '\xA4', '\xF4', '\xEF', '\xCF', '\x9F', '\x8F', '\x1F', '\x3F', '\xBC',
+    '\x7F', '\xF7', '\xF6', '\xF5', '\x8B', '\xE7', '\xCF', '\xEF', '\xDD', '\xBE', '\x75', '\xEB', '\xEA', '\xE5', '\x0B', '\xE7',
+    '\xCF', '\x1E', '\x3F', '\x08', '\x04', '\x2B', '\x97', '\xCE', '\x9A', '\x39', '\x63', '\xFA', '\xC4', '\xBE', '\x86', '\xF4',
+    '\x84', '\x68', '\x0B', '\x0B', '\x83', '\x7D', '\x8B', '\x67', '\x97', '\x00', '\x23', '\xBE', '\xD3', '\xD3', '\xC5', '\x31',
+    '\xC4', '\xE2', '\x74', '\xEB', '\xE5', '\xEB', '\x61', '\x4C', '\x86', '\x02', '\x6C', '\x0F', '\x04', '\xC5', '\x34', '\xB9',
+    '\x6E', '\x2C', '\xE5', '\xF6', '\xDA', '\x98', '\x78', '\x9C', '\x49', '\xE9', '\x46', '\xF5', '\xFB', '\xBD', '\xE5', '\xC2',
+    '\xE2', '\xE2', '\x1B', '\xF6', '\xEE', '\xD1', '\x7C', '\x3D', '\xF1', '\x08', '\xF7', '\xBE', '\xD9', '\x3B', '\x6F', '\xFC',
+    '\x7F', '\x73', '\x52', '\xC5', '\xF8', '\xC0', '\xCC', '\x5B', '\x73', '\xF5', '\x16', '\xF4', '\x6D', '\x7F', '\xBB', '\x85',
+    '\xC7', '\xD2', '\x4A', '\x6B', '\xE1', '\x94', '\x93', '\x3D', '\x13', '\x04', '\x39', '\x4C', '\xDD', '\xED', '\x43', '\x92',
+    '\x73', '\x14', '\x43', '\x13', '\x5C', '\xEE', '\x6E', '\xD9', '\xB2', '\xC1', '\x41', '\x37', '\xCC', '\xC1', '\xAC', '\x73',
+    '\x97', '\x17', '\x73', '\xB0', '\xC2', '\xE7', '\x85', '\x6A', '\x72', '\x0C', '\x8B', '\x24', '\x7F', '\x3B', '\x9A', '\xF5',
+    '\x9C', '\x71', '\x4B', '\xB2', '\x9B', '\x1E', '\x22', '\x72', '\xB4', '\xC9', '\xFD', '\x41', '\xF8', '\x95', '\x73', '\x5E',
+    '\xCC', '\x8F', '\xAE', '\xDC', '\xB1', '\x4E', '\x93', '\x6A', '\xDC', '\xE4', '\x7E', '\x20', '\xF3', '\xD9', '\xFD', '\xD5',
+    '\x6B', '\xAE', '\x71', '\x2D', '\xDA', '\xBE', '\xFE', '\x78', '\x82', '\xC1', '\x8D', '\x9C', '\xB9', '\x36', '\x89', '\x85',
+    '\x0C', '\x99', '\xE7', '\x1F', '\x17', '\x2E', '\x5C', '\xC0', '\xCF', '\xF2', '\x4F', '\x40', '\xEE', '\x4B', '\x95', '\xE7',
+    '\x6E', '\x83', '\xAE', '\x19', '\x75', '\x13', '\x78', '\x12', '\xD2', '\x78', '\x0E', '\xDC', '\x0D', '\x09', '\x4F', '\x77',
+    '\x0B', '\xB3', '\x4C', '\x38', '\x3C', '\xED', '\xD7', '\xAF', '\x67', '\x59', '\x0F', '\x2E', '\xAD', '\x68', '\x9A', '\xF6',
+    '\xE6', '\xEA', '\xBF', '\x5B', '\xBF', '\xEE', '\xB9', '\x4A', '\x70', '\x30', '\xCF', '\xD3', '\xE8', '\xDC', '\x7E', '\xE9',
+    '\xC0', '\xE9', '\x67', '\xAB', '\xF3', '\x1E', '\x77', '\xB2', '\xB4', '\x9C', '\x96', '\x51', '\x6F', '\xDC', '\xB1', '\x2C',
+    '\xD3', '\xDA', '\x7C', '\xE5', '\x95', '\xB7', '\xEF', '\xDA', '\x97', '\xC5', '\x4E', '\x72', '\x98', '\xFD', '\xA5', '\xFD',
+    '\xC7', '\x19', '\xC6', '\x17', '\x7C', '\xE9', '\xEB', '\xFF', '\x33', '\xB9', '\x87', '\xB6', '\x04', '\xDB', '\x3F', '\xF9',
+    '\x99', '\x64', '\xB7', '\xBF', '\x60', '\x99', '\xFC', '\xA5', '\x40', '\xE7', '\x39', '\x4E', '\x02', '\x81', '\x3A', '\x13',
+    '\xE6', '\xD6', '\x25', '\xDB', '\x1D', '\xD6', '\x39', '\xD0', '\xC2', '\xE0', '\xD3', '\x32', '\xBB', '\x74', '\xA2', '\xA6',
+    '\x8E', '\x2D', '\x83', '\xCD', '\x3A', '\x91', '\x79', '\x91', '\xE2', '\x27', '\xBD', '\x16', '\x3D', '\x99', '\x10', '\xA3',
+    '\xC6', '\x73', '\xE7', '\xBF', '\xB3', '\xD1', '\xE9', '\xA3', '\x8F', '\x64', '\xD6', '\x16', '\xCD', '\xCE', '\xB4', '\x15',
+    '\xF8', '\xDB', '\x77', '\x74', '\x9F', '\x92', '\x42', '\xCC', '\x94', '\x8A', '\xAB', '\x9D', '\x47', '\xFE', '\xCE', '\xAD',
+    '\xB8', '\x9A', '\x2A', '\xBF', '\xFA', '\x4D', '\xF1', '\x74', '\xD9', '\x19', '\x9B', '\x94', '\xD5', '\x79', '\xD7', '\x46',
+    '\xF3', '\x6A', '\x3C', '\xBA', '\x70', '\x2A', '\x79', '\xFD', '\xBA', '\xAE', '\x64', '\x7D', '\xFD', '\x3E', '\x4F', '\xDE',
+    '\x86', '\x0D', '\x16', '\x8F', '\x5E', '\x7D', '\x6C', '\xD8', '\x50', '\x75', '\xE8', '\xD3', '\x26', '\x07', '\xBE', '\x23',
+    '\x4F', '\xA7', '\x5E', '\xBB', '\xBF', '\xAF', '\x94', '\xE9', '\xD1', '\xAF', '\xFF', '\x0C', '\xBF', '\xFE', '\xE5', '\x5F',
+    '\x54', '\x4A', '\x4E', '\x96', '\x01', '\xA5', '\x1D', '\x4F', '\x57', '\x3F', '\x97', '\x75', '\x4E', '\x09', '\x4D', '\x00',
+    '\xA8', '\xCA', '\xCC', '\xE5', '\xBB', '\x03', '\x00', '\x00',
+};
+constexpr size_t FAVICON_GZ_LEN = sizeof(FAVICON_GZ);
@@ -1,422 +1,1857 @@
 #include "esp-knx-webserver.h"
-#if defined(ESP32) || defined(LIBRETINY)
-    #include <Update.h>
+#include "esp-knx-webassets.h"
+
+// Embedded files served with a content hash as ETag. Pages are revalidated on every
+// load (a matching ETag costs only a 304), the favicon is cached by the browser.
+// Sorted by path for the binary search in findStaticAsset(). The number after the
+// login flag is the cost charged by the rate limiter, see esp-knx-ratelimit.h.
+constexpr KnxWebserver::StaticAsset KnxWebserver::staticAssets[] = {
+    {"/", "text/html", "no-cache", true, 4, ROOT_HTML, ROOT_HTML_LEN, ROOT_HTML_GZ, ROOT_HTML_GZ_LEN, knxWebHash(ROOT_HTML, ROOT_HTML_LEN)},
+    {"/favicon.ico", "image/png", "max-age=604800", false, 1, FAVICON, FAVICON_LEN, FAVICON_GZ, FAVICON_GZ_LEN, knxWebHash(FAVICON, FAVICON_LEN)},
+    {"/webupdate", "text/html", "no-cache", false, 4, UPDATE_HTML, UPDATE_HTML_LEN, UPDATE_HTML_GZ, UPDATE_HTML_GZ_LEN, knxWebHash(UPDATE_HTML, UPDATE_HTML_LEN)},
+};
+
+// Sorted by path for the binary search in findRoute(). Chunks of resumable uploads are
+// cheap, the one-shot /upload keeps the connection busy for the whole image.
+constexpr KnxWebserver::Route KnxWebserver::routes[] = {
+    {"/api/command", KNXWEB_HTTP_POST, true, 1, &KnxWebserver::handleApiCommand, nullptr},
+    {"/api/history", KNXWEB_HTTP_GET, true, 2, &KnxWebserver::handleApiHistory, nullptr},
+    {"/api/info", KNXWEB_HTTP_GET, true, 1, &KnxWebserver::handleApiInfo, nullptr},
+    {"/api/profile", KNXWEB_HTTP_GET, true, 2, &KnxWebserver::handleApiProfile, nullptr},
+    {"/api/status", KNXWEB_HTTP_GET, true, 1, &KnxWebserver::handleApiStatus, nullptr},
+    // Checks the session itself, the stream can't hand out a new session cookie
+    {"/events", KNXWEB_HTTP_GET, false, 2, &KnxWebserver::handleEvents, nullptr},
+    {"/knxoff", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleKnxOff, nullptr},
+    {"/logout", KNXWEB_HTTP_ANY, false, 1, &KnxWebserver::handleLogout, nullptr},
+    {"/metrics", KNXWEB_HTTP_GET, true, 2, &KnxWebserver::handleMetrics, nullptr},
+    {"/normalmode", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleNormalMode, nullptr},
+    {"/otaoff", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleOtaOff, nullptr},
+    {"/otaon", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleOtaOn, nullptr},
+    {"/progmode", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleProgMode, nullptr},
+    {"/restart", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleRestart, nullptr},
+    {"/tftdebug", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleTftDebug, nullptr},
+    {"/tftupdate", KNXWEB_HTTP_ANY, true, 1, &KnxWebserver::handleTftUpdate, nullptr},
+    {"/tftupload", KNXWEB_HTTP_POST, true, 8, &KnxWebserver::handleTftUploadDone, &KnxWebserver::handleTftUploadData},
+    {"/tftupload/status", KNXWEB_HTTP_GET, true, 1, &KnxWebserver::handleTftUploadStatus, nullptr},
+    {"/upload", KNXWEB_HTTP_POST, true, 8, &KnxWebserver::handleWebUpdateDone, &KnxWebserver::handleWebUpdateProgress},
+    {"/upload/begin", KNXWEB_HTTP_POST, true, 1, &KnxWebserver::handleUploadBegin, nullptr},
+    {"/upload/chunk", KNXWEB_HTTP_POST, true, 1, &KnxWebserver::handleUploadChunk, &KnxWebserver::handleUploadChunkData},
+    {"/upload/end", KNXWEB_HTTP_POST, true, 1, &KnxWebserver::handleUploadEnd, nullptr},
+    {"/upload/status", KNXWEB_HTTP_GET, true, 1, &KnxWebserver::handleUploadStatus, nullptr},
+};
+
+constexpr bool pathLess(const char *a, const char *b)
+{
+    return *a == *b ? *a != 0 && pathLess(a + 1, b + 1) : (uint8_t)*a < (uint8_t)*b;
+}
+
+template <typename T, size_t N>
+constexpr bool isSortedByPath(const T (&table)[N], size_t i = 1)
+{
+    return i >= N || (pathLess(table[i - 1].path, table[i].path) && isSortedByPath(table, i + 1));
+}
+
+template <typename T, size_t N>
+static const T *findByPath(const T (&table)[N], const char *path)
+{
+    size_t low = 0;
+    size_t high = N;
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2;
+        int cmp = strcmp(path, table[mid].path);
+        if (cmp == 0)
+        {
+            return &table[mid];
+        }
+        if (cmp < 0)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+    return nullptr;
+}
+
+// Request counters in KnxMetrics: routes first, then static assets, then unknown paths
+#define ROUTE_COUNT (sizeof(routes) / sizeof(routes[0]))
+#define ASSET_COUNT (sizeof(staticAssets) / sizeof(staticAssets[0]))
+#define NOT_FOUND_SLOT (ROUTE_COUNT + ASSET_COUNT)
+
+void KnxWebserver::startWeb(const char *www_username, const char *www_password)
+{
+    username = www_username;
+    password = www_password;
+    authRequired = username != nullptr && username[0] != 0;
+
+    static_assert(isSortedByPath(staticAssets) && isSortedByPath(routes), "route tables must be sorted by path");
+    static_assert(NOT_FOUND_SLOT < KNXWEB_METRICS_SLOTS, "KNXWEB_METRICS_SLOTS too small for the route tables");
+    systemInfo.begin();
+    history.begin(systemInfo.getResetCode(), systemInfo.getMinFreeHeap());
+    // ArduinoOTA restarts right after a successful update, the record is written from the callback
+    ota.setResultCallback([this](bool success)
+                          { history.add(success ? KNX_HISTORY_UPDATE : KNX_HISTORY_UPDATE_FAILED, KNX_HISTORY_OTA, systemInfo.getMinFreeHeap(), 0); });
+    knxWebSettings_t config = {ota.getTimeout()};
+    settings.load(config);
+    ota.setTimeout(config.otaTimeout);
+    transport.begin(this, &arena, 80);
+}
+
+// Work done by loop(), each call continues with the slice after the last one it ran
+#define LOOP_SLICE_TASKS 0
+#define LOOP_SLICE_OTA 1
+#define LOOP_SLICE_EVENTS 2
+#define LOOP_SLICE_SYSINFO 3
+#define LOOP_SLICE_DISCOVERY 4
+#define LOOP_SLICE_HISTORY 5
+#define LOOP_SLICE_TFT 6
+#define LOOP_SLICE_UPLOAD 7
+#define LOOP_SLICE_HTTP 8
+#define LOOP_SLICES 9
+
+// Actions requested by a handler and run from loop() after the response went out.
+// This also keeps the callbacks out of the AsyncTCP task when KNXWEB_ASYNC is set.
+#define TASK_RESTART 0x01
+#define TASK_TFT_UPDATE 0x02
+#define TASK_TFT_DEBUG 0x04
+#define TASK_KNX_MODE 0x08
+#define TASK_OTA_ON 0x10
+#define TASK_OTA_OFF 0x20
+#define TASK_SAVE_SETTINGS 0x40
+#define TASK_HISTORY 0x80
+
+// Time given to the client to receive the response before a restart
+#define RESTART_DELAY 500
+
+void KnxWebserver::loop(uint32_t budgetMicros)
+{
+    unsigned long start = micros();
+    if (loopStats.calls > 0 && start - lastLoopStart > loopStats.maxGapMicros)
+    {
+        loopStats.maxGapMicros = start - lastLoopStart;
+    }
+    lastLoopStart = start;
+    if (!waitingInHandler)
+    {
+        loopBudget = budgetMicros;
+    }
+    for (uint8_t i = 0; i < LOOP_SLICES; i++)
+    {
+        switch (nextLoopSlice)
+        {
+        case LOOP_SLICE_TASKS:
+            runDeferredTasks();
+            break;
+        case LOOP_SLICE_OTA:
+            loopOta();
+            break;
+        case LOOP_SLICE_EVENTS:
+            publishEvents();
+            break;
+        case LOOP_SLICE_SYSINFO:
+            systemInfo.loop();
+            break;
+        case LOOP_SLICE_DISCOVERY:
+            loopDiscovery();
+            break;
+        case LOOP_SLICE_HISTORY:
+            history.loop(millis(), systemInfo.getMinFreeHeap());
+            break;
+        case LOOP_SLICE_TFT:
+            loopTftUpload();
+            break;
+        case LOOP_SLICE_UPLOAD:
+            firmwareUpload.loop(millis());
+            break;
+        case LOOP_SLICE_HTTP:
+            if (!waitingInHandler)
+            {
+                transport.loop();
+            }
+            break;
+        }
+        nextLoopSlice = (nextLoopSlice + 1) % LOOP_SLICES;
+        if (budgetMicros != 0 && micros() - start >= budgetMicros)
+        {
+            break;
+        }
+    }
+
+    uint32_t duration = micros() - start;
+    loopStats.calls++;
+    loopStats.lastMicros = duration;
+    if (duration > loopStats.maxMicros)
+    {
+        loopStats.maxMicros = duration;
+    }
+    if (budgetMicros != 0 && duration > budgetMicros)
+    {
+        loopStats.overBudget++;
+    }
+}
+
+void KnxWebserver::loopOta()
+{
+    ota.loop(millis());
+}
+
+void KnxWebserver::loopTftUpload()
+{
+    size_t drained = tftRelay.drain(millis());
+    if (tftRelay.getState() == UPLOAD_FAILED && !tftRelay.isFinished())
+    {
+        // The rest of a failed image is dropped, the client may send it without waiting
+        drained = KNXWEB_TFT_BUFFER;
+    }
+    if (drained > 0)
+    {
+        transport.releaseUpload(drained);
+    }
+}
+
+// One pass of loop() from inside a handler of the synchronous server, which would otherwise
+// hold up everything until the handler returns. The budget is the one of the sketch.
+void KnxWebserver::loopWhileWaiting()
+{
+    waitingInHandler = true;
+    loop(loopBudget);
+    waitingInHandler = false;
+    if (idleFctn != nullptr)
+    {
+        idleFctn();
+    }
+    yield();
+}
+
+static size_t putText(uint8_t *buffer, size_t length, size_t size, const String &text, size_t maxLength)
+{
+    size_t textLength = min(min((size_t)text.length(), maxLength), size - length - 1);
+    buffer[length] = textLength;
+    memcpy(buffer + length + 1, text.c_str(), textLength);
+    return length + 1 + textLength;
+}
+
+// Status datagram for discovery collectors, the layout is described in esp-knx-discovery.h
+void KnxWebserver::loopDiscovery()
+{
+#if KNXWEB_DISCOVERY
+    if (!discovery.loop())
+    {
+        return;
+    }
+    unsigned int area = 0, line = 0, device = 0;
+    sscanf(knxPhysAddr.c_str(), "%u.%u.%u", &area, &line, &device);
+    uint16_t physAddr = (area & 0x0F) << 12 | (line & 0x0F) << 8 | (device & 0xFF);
+    uint32_t heap = systemInfo.getFreeHeap();
+    uint32_t uptime = millis() / 1000;
+
+    uint8_t reply[KNXWEB_DISCOVERY_SIZE];
+    memcpy(reply, "KNXR", 4);
+    reply[4] = KNXWEB_DISCOVERY_VERSION;
+    reply[5] = (knxConfigOk ? KNXWEB_DISCOVERY_CONFIG_OK : 0) | (ota.isActive() ? KNXWEB_DISCOVERY_OTA_ACTIVE : 0) |
+               (authRequired ? KNXWEB_DISCOVERY_AUTH : 0);
+    reply[6] = getKnxModeFctn != nullptr ? getKnxModeFctn() : 0xFF;
+    reply[7] = (uint8_t)systemInfo.getRssi();
+    reply[8] = physAddr;
+    reply[9] = physAddr >> 8;
+    for (int i = 0; i < 4; i++)
+    {
+        reply[10 + i] = heap >> (8 * i);
+        reply[14 + i] = uptime >> (8 * i);
+    }
+    size_t length = putText(reply, 18, sizeof(reply), hostname, 63);
+    // The build tells an attacker which firmware runs, it is only sent by open devices
+    length = putText(reply, length, sizeof(reply), authRequired ? String() : buildDetails, 255);
+    discovery.sendReply(reply, length);
+#endif
+}
+
+void KnxWebserver::runDeferredTasks()
+{
+    if (pendingTasks == 0)
+    {
+        return;
+    }
+    // The restart stays pending until its delay has passed
+#if defined(ESP32)
+    portENTER_CRITICAL(&taskLock);
+#endif
+    uint8_t tasks = pendingTasks;
+    pendingTasks &= TASK_RESTART;
+#if defined(ESP32)
+    portEXIT_CRITICAL(&taskLock);
+#endif
+
+    if ((tasks & TASK_KNX_MODE) && setKnxModeFctn != nullptr)
+    {
+        setKnxModeFctn(pendingKnxMode);
+    }
+    if (tasks & TASK_OTA_ON)
+    {
+        startOta();
+    }
+    if (tasks & TASK_OTA_OFF)
+    {
+        endOta();
+    }
+    if (tasks & TASK_SAVE_SETTINGS)
+    {
+        ota.setTimeout(pendingOtaTimeout);
+        knxWebSettings_t config = {ota.getTimeout()};
+        settings.save(config);
+    }
+    if ((tasks & TASK_TFT_UPDATE) && startTftUpdateFctn != nullptr)
+    {
+        startTftUpdateFctn();
+    }
+    if ((tasks & TASK_TFT_DEBUG) && startTftDebugFctn != nullptr)
+    {
+        startTftDebugFctn();
+    }
+    if (tasks & TASK_HISTORY)
+    {
+        history.add(pendingUpdateSuccess ? KNX_HISTORY_UPDATE : KNX_HISTORY_UPDATE_FAILED, KNX_HISTORY_WEB,
+                    systemInfo.getMinFreeHeap(), pendingUpdateBytes);
+    }
+    if ((tasks & TASK_RESTART) && millis() - restartRequestTime > RESTART_DELAY)
+    {
+        history.add(KNX_HISTORY_RESTART, pendingRestartReason, systemInfo.getMinFreeHeap(), history.getPeakLatency());
+        ESP.restart();
+    }
+}
+
+void KnxWebserver::publishEvents()
+{
+    if (millis() - lastEventCheck < KNXWEB_EVENT_INTERVAL)
+    {
+        return;
+    }
+    lastEventCheck = millis();
+    if (transport.eventClientCount() == 0)
+    {
+        snapshotPublished = false;
+        return;
+    }
+    char data[160];
+    if (formatEventDelta(takeSnapshot(), data, sizeof(data)) > 0)
+    {
+        transport.sendEvent("status", data);
+    }
+}
+
+KnxWebserver::EventSnapshot KnxWebserver::takeSnapshot()
+{
+    EventSnapshot snapshot;
+    snapshot.mode = getKnxModeFctn != nullptr ? getKnxModeFctn() : -1;
+    snapshot.configOk = knxConfigOk;
+    snapshot.otaActive = ota.isActive();
+    snapshot.otaActivityTime = ota.getActivityTime();
+    snapshot.otaState = ota.getState();
+    snapshot.heap = systemInfo.getFreeHeap();
+    snapshot.rssi = systemInfo.getRssi();
+    return snapshot;
+}
+
+static void appendf(char *buffer, size_t size, size_t &length, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer + length, size - length, format, args);
+    va_end(args);
+    if (written > 0)
+    {
+        length = min(length + written, size - 1);
+    }
+}
+
+// Formats the fields of current that changed since the last published snapshot as
+// JSON object with the keys of /api/status. Returns 0 when nothing changed.
+size_t KnxWebserver::formatEventDelta(const EventSnapshot &current, char *buffer, size_t size)
+{
+    static const char *const modeNames[] = {"off", "normal", "prog"};
+    EventSnapshot &last = publishedSnapshot;
+    bool all = !snapshotPublished;
+    size_t length = 0;
+
+    appendf(buffer, size, length, "{");
+    if (current.mode >= 0 && (all || current.mode != last.mode))
+    {
+        appendf(buffer, size, length, "\"mode\":\"%s\",", modeNames[current.mode]);
+    }
+    if (all || current.configOk != last.configOk)
+    {
+        appendf(buffer, size, length, "\"configOk\":%s,", current.configOk ? "true" : "false");
+    }
+#if defined(ESP32) || defined(ESP8266)
+    // The browser counts down itself, the remaining time is sent when OTA is (re)started
+    if (all || current.otaActive != last.otaActive || current.otaActivityTime != last.otaActivityTime)
+    {
+        appendf(buffer, size, length, "\"otaActive\":%s,", current.otaActive ? "true" : "false");
+        if (current.otaActive)
+        {
+            appendf(buffer, size, length, "\"otaRemaining\":%ld,", (long)ota.getRemaining(millis()));
+        }
+    }
+    if (all || current.otaState != last.otaState)
+    {
+        appendf(buffer, size, length, "\"otaState\":\"%s\",\"otaError\":\"%s\",", ota.getStateName(), ota.getError());
+    }
+#endif
+    if (all || abs((int32_t)(current.heap - last.heap)) >= KNXWEB_EVENT_HEAP_STEP)
+    {
+        appendf(buffer, size, length, "\"heap\":%lu,", (unsigned long)current.heap);
+        last.heap = current.heap;
+    }
+    if (all || abs(current.rssi - last.rssi) >= KNXWEB_EVENT_RSSI_STEP)
+    {
+        appendf(buffer, size, length, "\"rssi\":%d,", current.rssi);
+        last.rssi = current.rssi;
+    }
+    if (length == 1)
+    {
+        return 0;
+    }
+    // Replaces the last separator
+    buffer[length - 1] = '}';
+
+    // heap and rssi keep their last published value so small changes add up
+    last.mode = current.mode;
+    last.configOk = current.configOk;
+    last.otaActive = current.otaActive;
+    last.otaActivityTime = current.otaActivityTime;
+    last.otaState = current.otaState;
+    snapshotPublished = true;
+    return length;
+}
+
+// cancel drops pending tasks that task replaces, like OTA off for OTA on
+void KnxWebserver::queueTask(uint8_t task, uint8_t cancel)
+{
+#if defined(ESP32)
+    portENTER_CRITICAL(&taskLock);
+#endif
+    pendingTasks = (pendingTasks & ~cancel) | task;
+#if defined(ESP32)
+    portEXIT_CRITICAL(&taskLock);
+#endif
+}
+
+// The response goes out before the restart, its reason is kept in the history
+void KnxWebserver::requestRestart(uint8_t reason)
+{
+    pendingRestartReason = reason;
+    restartRequestTime = millis();
+    queueTask(TASK_RESTART);
+}
+
+void KnxWebserver::setHostname(String newName)
+{
+    hostname = newName;
+	#if defined(ESP32) || defined(ESP8266)
+    ArduinoOTA.setHostname(hostname.c_str());
+	#endif
+}
+
+void KnxWebserver::setBuildDetails(String details)
+{
+    buildDetails = details;
+}
+
+void KnxWebserver::setKnxDetail(String physAddr, bool configOk)
+{
+    knxPhysAddr = physAddr;
+    knxConfigOk = configOk;
+}
+
+void KnxWebserver::registerSetKnxModeCallback(callbackSetKnxMode *fctn)
+{
+    setKnxModeFctn = fctn;
+}
+
+void KnxWebserver::registerGetKnxModeCallback(callbackGetKnxMode *fctn)
+{
+    getKnxModeFctn = fctn;
+}
+
+void KnxWebserver::registerTftUpdateCallback(callbackStartTftUpdate *fctn)
+{
+    startTftUpdateFctn = fctn;
+}
+
+void KnxWebserver::registerTftDebugCallback(callbackStartTftDebug *fctn)
+{
+    startTftDebugFctn = fctn;
+}
+
+void KnxWebserver::registerTftUploadCallbacks(callbackTftUploadBegin *begin, callbackTftUploadWrite *write, callbackTftUploadEnd *end)
+{
+    tftRelay.setSink(begin, write, end);
+}
+
+void KnxWebserver::registerIdleCallback(callbackIdle *fctn)
+{
+    idleFctn = fctn;
+}
+
+const KnxWebserver::Route *KnxWebserver::findRoute(uint8_t method, const String &uri)
+{
+    const Route *route = findByPath(routes, uri.c_str());
+    if (route == nullptr || (route->method & method) == 0)
+    {
+        return nullptr;
+    }
+    return route;
+}
+
+const KnxWebserver::StaticAsset *KnxWebserver::findStaticAsset(uint8_t method, const String &uri)
+{
+    if (method != KNXWEB_HTTP_GET)
+    {
+        return nullptr;
+    }
+    return findByPath(staticAssets, uri.c_str());
+}
+
+void KnxWebserver::dispatch(uint8_t method, const String &uri)
+{
+    requestMethod = method;
+    unsigned long start = micros();
+    uint32_t heapBefore = ESP.getFreeHeap();
+    uint32_t bytesBefore = transport.getBytesSent();
+    uint8_t slot;
+    const Route *route = findRoute(method, uri);
+    const StaticAsset *asset = route == nullptr ? findStaticAsset(method, uri) : nullptr;
+    // An upload was admitted or refused with its first part
+    uint32_t retryAfter = 0;
+    if (route != nullptr && route->uploadHandler != nullptr && uploadAdmitted)
+    {
+        retryAfter = uploadRetryAfter;
+        uploadAdmitted = false;
+    }
+    else if (route != nullptr || asset != nullptr)
+    {
+        retryAfter = admitRequest(route != nullptr ? routeCost(*route) : asset->cost);
+    }
+    if (retryAfter != 0)
+    {
+        sendTooManyRequests(retryAfter);
+        arena.reset();
+        return;
+    }
+    if (route != nullptr)
+    {
+        slot = route - routes;
+        if (route->authRequired && !isAuthenticated())
+        {
+            metrics.recordAuthFailure();
+            transport.requestAuthentication();
+        }
+        else
+        {
+            (this->*route->handler)();
+        }
+    }
+    else if (asset != nullptr)
+    {
+        slot = ROUTE_COUNT + (asset - staticAssets);
+        if (asset->authRequired && !isAuthenticated())
+        {
+            metrics.recordAuthFailure();
+            transport.requestAuthentication();
+        }
+        else
+        {
+            handleStaticAsset(*asset);
+        }
+    }
+    else
+    {
+        arena.reset();
+        return;
+    }
+    arena.reset();
+    uint32_t duration = micros() - start;
+    metrics.recordRequest(slot, duration, transport.getBytesSent() - bytesBefore, (int32_t)(heapBefore - ESP.getFreeHeap()));
+    history.noteLatency(duration);
+}
+
+void KnxWebserver::dispatchUpload(const String &uri)
+{
+    const Route *route = findRoute(KNXWEB_HTTP_POST, uri);
+    if (route == nullptr || route->uploadHandler == nullptr)
+    {
+        return;
+    }
+    // The upload callback runs for every received chunk, credentials are only checked once per upload
+    if (transport.upload().status == KNXWEB_UPLOAD_START)
+    {
+        uploadRetryAfter = admitRequest(routeCost(*route));
+        uploadAdmitted = true;
+        uploadAuthorized = uploadRetryAfter == 0 && (!route->authRequired || isAuthenticated());
+    }
+    if (uploadAuthorized)
+    {
+        (this->*route->uploadHandler)();
+    }
+    arena.reset();
+}
+
+// An admitted upload was charged with /upload/begin, its chunks and status polls are free
+// so a fast upload does not run out of tokens
+uint8_t KnxWebserver::routeCost(const Route &route)
+{
+    bool uploadRoute = route.handler == &KnxWebserver::handleUploadChunk || route.handler == &KnxWebserver::handleUploadStatus;
+    if (uploadRoute && firmwareUpload.getState() == UPLOAD_RUNNING && transport.remoteIP() == uploadClientIP)
+    {
+        return 0;
+    }
+    return route.cost;
+}
+
+// Returns 0 when the request may run, otherwise the seconds for Retry-After
+uint32_t KnxWebserver::admitRequest(uint8_t cost)
+{
+#if KNXWEB_RATE_LIMIT
+    if (cost == 0)
+    {
+        return 0;
+    }
+    if (transport.getRequestsInFlight() > KNXWEB_RATE_IN_FLIGHT)
+    {
+        overloaded++;
+        return 1;
+    }
+    return rateLimiter.admit(transport.remoteIP(), cost, millis());
+#else
+    return 0;
+#endif
+}
+
+void KnxWebserver::sendTooManyRequests(uint32_t retryAfter)
+{
+    char seconds[12];
+    snprintf(seconds, sizeof(seconds), "%lu", (unsigned long)retryAfter);
+    transport.sendHeader("Retry-After", seconds);
+    transport.send(429, "text/plain", "Too Many Requests");
+}
+
+static uint32_t randomWord()
+{
+#if defined(ESP32)
+    return esp_random();
+#elif defined(ESP8266)
+    return ESP.random();
+#elif defined(LIBRETINY)
+    uint32_t value;
+    lt_rand_bytes((uint8_t *)&value, sizeof(value));
+    return value;
+#endif
+}
+
+bool KnxWebserver::isAuthenticated()
+{
+    if (!authRequired)
+    {
+        return true;
+    }
+    uint32_t token[4];
+    if (readSessionCookie(token) && findSession(token) != nullptr)
+    {
+        return true;
+    }
+    if (!transport.authenticate(username, password))
+    {
+        return false;
+    }
+    createSession();
+    return true;
+}
+
+bool KnxWebserver::readSessionCookie(uint32_t token[4])
+{
+    const char *hex = strstr(transport.header("Cookie"), "KNXSESSION=");
+    if (hex == nullptr || strlen(hex) < 11 + 32)
+    {
+        return false;
+    }
+    hex += 11;
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t word = 0;
+        for (int j = 0; j < 8; j++)
+        {
+            char c = *hex++;
+            uint8_t nibble;
+            if (c >= '0' && c <= '9')
+                nibble = c - '0';
+            else if (c >= 'a' && c <= 'f')
+                nibble = c - 'a' + 10;
+            else
+                return false;
+            word = word << 4 | nibble;
+        }
+        token[i] = word;
+    }
+    return true;
+}
+
+KnxWebserver::Session *KnxWebserver::findSession(const uint32_t token[4])
+{
+    // Compare against every slot without an early exit so the lookup time does not leak the token
+    Session *match = nullptr;
+    for (Session &session : sessions)
+    {
+        uint32_t diff = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            diff |= session.token[i] ^ token[i];
+        }
+        bool alive = session.valid && millis() - session.created < KNXWEB_SESSION_TIMEOUT * 1000UL;
+        if (diff == 0 && alive)
+        {
+            match = &session;
+        }
+    }
+    return match;
+}
+
+void KnxWebserver::createSession()
+{
+    // A client that sent Basic credentials without a cookie gets the session of its address
+    // again, otherwise a free or expired slot, otherwise the oldest session is replaced
+    uint32_t remoteIP = transport.remoteIP();
+    Session *slot = nullptr;
+    for (Session &session : sessions)
+    {
+        if (session.valid && session.remoteIP == remoteIP && millis() - session.created < KNXWEB_SESSION_TIMEOUT * 1000UL)
+        {
+            slot = &session;
+            break;
+        }
+    }
+    if (slot == nullptr)
+    {
+        slot = &sessions[0];
+        for (Session &session : sessions)
+        {
+            if (!session.valid || millis() - session.created >= KNXWEB_SESSION_TIMEOUT * 1000UL)
+            {
+                slot = &session;
+                break;
+            }
+            if (millis() - session.created > millis() - slot->created)
+            {
+                slot = &session;
+            }
+        }
+        slot->valid = true;
+        slot->created = millis();
+        slot->remoteIP = remoteIP;
+        for (int i = 0; i < 4; i++)
+        {
+            slot->token[i] = randomWord();
+        }
+    }
+
+    // A reused session keeps its expiry
+    unsigned long maxAge = KNXWEB_SESSION_TIMEOUT - (millis() - slot->created) / 1000;
+    char cookie[96];
+    snprintf(cookie, sizeof(cookie), "KNXSESSION=%08lx%08lx%08lx%08lx; Max-Age=%lu; Path=/; HttpOnly; SameSite=Strict",
+             (unsigned long)slot->token[0], (unsigned long)slot->token[1], (unsigned long)slot->token[2], (unsigned long)slot->token[3],
+             maxAge);
+    transport.sendHeader("Set-Cookie", cookie);
+}
+
+void KnxWebserver::handleStaticAsset(const StaticAsset &asset)
+{
+    bool gzip = asset.gzipData != nullptr && strstr(transport.header("Accept-Encoding"), "gzip") != nullptr;
+    // The compressed variant is a different representation and needs its own strong ETag
+    char etag[14];
+    snprintf(etag, sizeof(etag), gzip ? "\"%08lx-gz\"" : "\"%08lx\"", (unsigned long)asset.etag);
+    transport.sendHeader("ETag", etag);
+    transport.sendHeader("Cache-Control", asset.cacheControl);
+    if (asset.gzipData != nullptr)
+    {
+        transport.sendHeader("Vary", "Accept-Encoding");
+    }
+    if (strcmp(transport.header("If-None-Match"), etag) == 0)
+    {
+        transport.send(304);
+        return;
+    }
+    if (gzip)
+    {
+        transport.sendHeader("Content-Encoding", "gzip");
+        transport.send_P(200, asset.contentType, asset.gzipData, asset.gzipLength);
+    }
+    else
+    {
+        transport.send_P(200, asset.contentType, asset.data, asset.length);
+    }
+}
+
+// Templates of /api/info and /api/status, the values are filled in by handleApiInfo() and
+// handleApiStatus() in this order
+#define S KNXPAGE_SLOT
+constexpr char INFO_JSON[] PROGMEM =
+    "{\"name\":" S ",\"physAddr\":" S ",\"tftUpdate\":" S ",\"tftDebug\":" S ",\"auth\":" S
+#if defined(ESP32)
+    ",\"chip\":\"ESP32\",\"flash\":" S ",\"psram\":" S ",\"heapSize\":" S
 #elif defined(ESP8266)
-    #include <Updater.h>
-    #define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
-    #define errorString() getErrorString().c_str()
+    ",\"chip\":\"ESP8266\",\"flash\":" S
+#elif defined(LIBRETINY)
+    ",\"chip\":\"Beken\",\"flash\":" S
+#endif
+    ",\"cpu\":" S ",\"mac\":\"" S "\",\"sdk\":" S
+#if defined(ESP8266) || defined(LIBRETINY)
+    ",\"resetReason\":" S
 #endif
+    ",\"build\":" S "}";
+constexpr char STATUS_JSON[] PROGMEM =
+    "{\"configOk\":" S S
+#if defined(ESP32) || defined(ESP8266)
+    ",\"otaActive\":" S S ",\"otaTimeout\":" S ",\"otaState\":\"" S "\",\"otaProgress\":" S ",\"otaError\":" S
+#endif
+#if defined(ESP32)
+    ",\"freePsram\":" S ",\"heap\":" S ",\"temp\":" S
+#else
+    ",\"heap\":" S
+#endif
+    ",\"rssi\":" S ",\"heapRange\":[" S "],\"rssiRange\":[" S "]"
+#if defined(ESP32)
+    ",\"tempRange\":[" S "]"
+#endif
+    ",\"loopMax\":" S "}";
+#undef S
+constexpr size_t INFO_SLOTS = knxPageCountSlots(INFO_JSON, sizeof(INFO_JSON) - 1);
+constexpr KnxPageLayout<INFO_SLOTS> infoLayout PROGMEM = knxPageLayout<INFO_SLOTS>(INFO_JSON, sizeof(INFO_JSON) - 1);
+constexpr size_t STATUS_SLOTS = knxPageCountSlots(STATUS_JSON, sizeof(STATUS_JSON) - 1);
+constexpr KnxPageLayout<STATUS_SLOTS> statusLayout PROGMEM = knxPageLayout<STATUS_SLOTS>(STATUS_JSON, sizeof(STATUS_JSON) - 1);
+
+// Formats a number of a page behind the ones before it in buffer
+static const char *formatValue(char *buffer, size_t size, size_t &used, const char *format, ...)
+{
+    char *text = buffer + used;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(text, size - used, format, args);
+    va_end(args);
+    used = written > 0 ? min(used + written + 1, size - 1) : used;
+    return text;
+}
+
+// What does not change while the device runs, the page fetches it once
+void KnxWebserver::handleApiInfo()
+{
+    char numbers[64];
+    size_t used = 0;
+    knxPageValue_t values[INFO_SLOTS];
+    size_t n = 0;
+    auto text = [](const char *value) { return knxPageValue_t{value, KNXPAGE_TEXT}; };
+    auto flag = [](bool value) { return knxPageValue_t{value ? "true" : "false", KNXPAGE_TEXT}; };
+    auto jsonString = [](const char *value) { return knxPageValue_t{value, KNXPAGE_JSON_STRING}; };
+
+    values[n++] = jsonString(hostname.c_str());
+    values[n++] = jsonString(knxPhysAddr.c_str());
+    values[n++] = flag(startTftUpdateFctn != nullptr);
+    values[n++] = flag(startTftDebugFctn != nullptr);
+    values[n++] = flag(authRequired);
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getFlashSize()));
+#if defined(ESP32)
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getPsramSize()));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getHeapSize()));
+#endif
+    const uint8_t *mac = systemInfo.getMac();
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getCpuFreqMHz()));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]));
+    values[n++] = jsonString(systemInfo.getSdkVersion().c_str());
+#if defined(ESP8266) || defined(LIBRETINY)
+    values[n++] = jsonString(systemInfo.getResetReason().c_str());
+#endif
+    values[n++] = jsonString(buildDetails.c_str());
+
+    transport.sendHeader("Cache-Control", "no-store");
+    sendPage(200, "application/json", INFO_JSON, infoLayout, values);
+}
+
+// The state that changes, polled by scripts and pages without event stream
+void KnxWebserver::handleApiStatus()
+{
+    static const char modeOff[] PROGMEM = ",\"mode\":\"off\"";
+    static const char modeNormal[] PROGMEM = ",\"mode\":\"normal\"";
+    static const char modeProg[] PROGMEM = ",\"mode\":\"prog\"";
+    char numbers[256];
+    size_t used = 0;
+    knxPageValue_t values[STATUS_SLOTS];
+    size_t n = 0;
+    auto text = [](const char *value) { return knxPageValue_t{value, KNXPAGE_TEXT}; };
+    auto flag = [](bool value) { return knxPageValue_t{value ? "true" : "false", KNXPAGE_TEXT}; };
+    auto jsonString = [](const char *value) { return knxPageValue_t{value, KNXPAGE_JSON_STRING}; };
+
+    values[n++] = flag(knxConfigOk);
+    values[n++] = {"", KNXPAGE_TEXT};
+    if (getKnxModeFctn != nullptr)
+    {
+        knxModeOptions_t mode = getKnxModeFctn();
+        values[n - 1] = {mode == KNX_MODE_OFF ? modeOff : mode == KNX_MODE_NORMAL ? modeNormal : modeProg, KNXPAGE_TEXT_P};
+    }
+#if defined(ESP32) || defined(ESP8266)
+    values[n++] = flag(ota.isActive());
+    values[n++] = text(ota.isActive() ? formatValue(numbers, sizeof(numbers), used, ",\"otaRemaining\":%ld", (long)ota.getRemaining(millis())) : "");
+    // Progress of an update over ArduinoOTA, only seen while it runs with KNXWEB_ASYNC
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)ota.getTimeout()));
+    values[n++] = text(ota.getStateName());
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%u", ota.getProgress()));
+    values[n++] = jsonString(ota.getError());
+#endif
+
+    // Cached by systemInfo, heap, rssi and temp are the latest sample
+#if defined(ESP32)
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getFreePsram()));
+#endif
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)systemInfo.getFreeHeap()));
+#if defined(ESP32)
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%.1f", systemInfo.getTemperature() / 10.0));
+#endif
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%d", systemInfo.getRssi()));
+    // Minimum, average and maximum of the kept samples
+    knxSysInfoRange_t heap = systemInfo.getHeapRange();
+    knxSysInfoRange_t rssi = systemInfo.getRssiRange();
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%ld,%ld,%ld", (long)heap.min, (long)heap.avg, (long)heap.max));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%ld,%ld,%ld", (long)rssi.min, (long)rssi.avg, (long)rssi.max));
+#if defined(ESP32)
+    knxSysInfoRange_t temp = systemInfo.getTemperatureRange();
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%.1f,%.1f,%.1f", temp.min / 10.0, temp.avg / 10.0, temp.max / 10.0));
+#endif
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", (unsigned long)loopStats.maxMicros));
+
+    transport.sendHeader("Cache-Control", "no-store");
+    sendPage(200, "application/json", STATUS_JSON, statusLayout, values);
+}
+
+// Runs a batch of commands like {"knxMode":"prog","ota":true}. Either all commands are
+// queued in their order or, when one of them is rejected, none.
+void KnxWebserver::handleApiCommand()
+{
+    size_t length;
+    const char *body = transport.body(length);
+    transport.sendHeader("Cache-Control", "no-store");
+    if (body == nullptr)
+    {
+        transport.send(413, "application/json", "{\"error\":\"body too large\"}");
+        return;
+    }
+    int rejected = runCommands(body, length, false, false);
+    if (rejected < 0)
+    {
+        transport.send(400, "application/json", "{\"error\":\"invalid JSON\"}");
+        return;
+    }
+    beginChunked(rejected == 0 ? 200 : 400, "application/json");
+    runCommands(body, length, rejected == 0, true);
+    endChunked();
+}
+
+// Returns the number of rejected commands or -1 when body is no valid JSON object.
+// report writes the result of every command with its key.
+int KnxWebserver::runCommands(const char *body, size_t length, bool execute, bool report)
+{
+    KnxJsonReader json(body, length);
+    if (json.next() != KNXJSON_OBJECT_BEGIN)
+    {
+        return -1;
+    }
+    int rejected = 0;
+    bool first = true;
+    knxJsonToken_t token;
+    if (report)
+    {
+        writeChunk("{", 1);
+    }
+    while ((token = json.next()) == KNXJSON_KEY)
+    {
+        const char *key = json.text();
+        size_t keyLength = json.textLength();
+        const char *error = applyCommand(json, execute);
+        if (error != nullptr)
+        {
+            rejected++;
+        }
+        if (report)
+        {
+            // The key is still escaped as it was sent, so it can be written as it is
+            writeChunk(first ? "\"" : ",\"", first ? 1 : 2);
+            writeChunk(key, keyLength);
+            writeChunkf("\":\"%s\"", error != nullptr ? error : execute ? "ok" : "skipped");
+            first = false;
+        }
+    }
+    if (report)
+    {
+        writeChunk("}", 1);
+    }
+    return token == KNXJSON_OBJECT_END && json.next() == KNXJSON_END ? rejected : -1;
+}
 
-void KnxWebserver::startWeb(const char *www_username, const char *www_password)
+// Checks the command whose key was just read and queues it when execute is set.
+// Returns nullptr for a valid command, otherwise the reason it was rejected.
+const char *KnxWebserver::applyCommand(KnxJsonReader &json, bool execute)
 {
-#if defined(ESP32) || defined(LIBRETINY)
-    server = new WebServer(80);
-#elif defined(ESP8266)
-    server = new ESP8266WebServer(80);
+    bool knxMode = json.textEquals("knxMode");
+    bool ota = json.textEquals("ota");
+    bool tftUpdate = json.textEquals("tftUpdate");
+    bool tftDebug = json.textEquals("tftDebug");
+    bool restart = json.textEquals("restart");
+    bool otaTimeout = json.textEquals("otaTimeout");
+    knxJsonToken_t value = json.next();
+    if (value == KNXJSON_OBJECT_BEGIN || value == KNXJSON_ARRAY_BEGIN)
+    {
+        json.skip();
+        return knxMode || ota || tftUpdate || tftDebug || restart || otaTimeout ? "invalid" : "unknown";
+    }
+    bool on = value == KNXJSON_TRUE;
+    if (knxMode)
+    {
+        knxModeOptions_t mode;
+        if (value == KNXJSON_STRING && json.textEquals("off"))
+            mode = KNX_MODE_OFF;
+        else if (value == KNXJSON_STRING && json.textEquals("normal"))
+            mode = KNX_MODE_NORMAL;
+        else if (value == KNXJSON_STRING && json.textEquals("prog"))
+            mode = KNX_MODE_PROG;
+        else
+            return "invalid";
+        if (setKnxModeFctn == nullptr)
+        {
+            return "unsupported";
+        }
+        if (execute)
+        {
+            pendingKnxMode = mode;
+            queueTask(TASK_KNX_MODE);
+        }
+        return nullptr;
+    }
+    if (otaTimeout)
+    {
+        // Seconds, kept in the settings across restarts
+        int32_t seconds;
+        if (value != KNXJSON_NUMBER || !json.textToInt(seconds) || seconds < KNXWEB_OTA_TIMEOUT_MIN || seconds > KNXWEB_OTA_TIMEOUT_MAX)
+        {
+            return "invalid";
+        }
+#if defined(ESP32) || defined(ESP8266)
+        if (execute)
+        {
+            pendingOtaTimeout = seconds;
+            queueTask(TASK_SAVE_SETTINGS);
+        }
+        return nullptr;
+#else
+        return "unsupported";
 #endif
-    username = www_username;
-    password = www_password;
-    authRequired = username != nullptr && username[0] != 0;
+    }
+    if (!ota && !tftUpdate && !tftDebug && !restart)
+    {
+        return "unknown";
+    }
+    if (!on && value != KNXJSON_FALSE)
+    {
+        return "invalid";
+    }
+    if (ota)
+    {
+#if defined(ESP32) || defined(ESP8266)
+        if (execute)
+        {
+            queueTask(on ? TASK_OTA_ON : TASK_OTA_OFF, on ? TASK_OTA_OFF : TASK_OTA_ON);
+        }
+        return nullptr;
+#else
+        return "unsupported";
+#endif
+    }
+    if ((tftUpdate && startTftUpdateFctn == nullptr) || (tftDebug && startTftDebugFctn == nullptr))
+    {
+        return "unsupported";
+    }
+    // false is accepted and does nothing
+    if (execute && on)
+    {
+        if (restart)
+        {
+            requestRestart(KNX_HISTORY_COMMAND);
+        }
+        else
+        {
+            queueTask(tftUpdate ? TASK_TFT_UPDATE : TASK_TFT_DEBUG);
+        }
+    }
+    return nullptr;
+}
 
-    server->on("/", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleRoot(); });
-    server->on("/progmode", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleProgMode(); });
-    server->on("/normalmode", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleNormalMode(); });
-    server->on("/knxoff", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleKnxOff(); });
-    server->on("/otaon", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleOtaOn(); });
-    server->on("/otaoff", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleOtaOff(); });
-    server->on("/restart", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleRestart(); });
-    server->on("/tftupdate", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleTftUpdate(); });
-    server->on("/tftdebug", [this]()
-               { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleTftDebug(); });
-    server->on("/webupdate", [this]()
-               { server->send(200, "text/html", UPDATE_HTML); });
-    server->on("/upload", HTTP_POST, 
-                [this]() { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleWebUpdateDone(); }, 
-                [this]()  { if (authRequired && !server->authenticate(username, password)) { return server->requestAuthentication(); } handleWebUpdateProgress(); });
-    server->on("/favicon.ico", [this]()
-               { server->send_P(200, "image/png", FAVICON, sizeof(FAVICON)); });
-    server->onNotFound([this]()
-                       { handleNotFound(); });
-    server->begin();
-}
-
-void KnxWebserver::loop()
-{
-    if (otaActive)
-    {
-        #if defined(ESP32) || defined(ESP8266)
-        ArduinoOTA.handle();
-        #endif
-        // Disable OTA 5 minutes after startup to reduce WIFI load
-        if (millis() - otaStartTime > 5 * 60 * 1000UL)
-        {
-            endOta();
-        }
-    }
-    server->handleClient();
+// Oldest record first, ?format=csv for spreadsheets. value is the peak request latency in µs
+// for stats and restart records and the received bytes for web updates.
+void KnxWebserver::handleApiHistory()
+{
+    bool csv = strcmp(transport.arg("format"), "csv") == 0;
+    bool first = true;
+    transport.sendHeader("Cache-Control", "no-store");
+    if (csv)
+    {
+        beginChunked(200, "text/csv");
+        writeChunk_P(PSTR("boot,event,reason,uptime,minHeap,value\n"));
+    }
+    else
+    {
+        beginChunked(200, "application/json");
+        writeChunk_P(PSTR("{\"records\":["));
+    }
+    history.forEach([&](const knxHistoryRecord_t &record)
+                    {
+        const char *reason = record.type == KNX_HISTORY_BOOT ? KnxSystemInfo::getResetName(record.reason) : KnxHistory::getReasonName(record.reason);
+        if (csv)
+        {
+            writeChunkf("%u,%s,%s,%lu,%lu,%lu\n", record.boot, KnxHistory::getTypeName(record.type), reason,
+                        (unsigned long)record.uptime, (unsigned long)record.minHeap, (unsigned long)record.value);
+        }
+        else
+        {
+            writeChunkf("%s{\"boot\":%u,\"event\":\"%s\",\"reason\":\"%s\",\"uptime\":%lu,\"minHeap\":%lu,\"value\":%lu}",
+                        first ? "" : ",", record.boot, KnxHistory::getTypeName(record.type), reason,
+                        (unsigned long)record.uptime, (unsigned long)record.minHeap, (unsigned long)record.value);
+        }
+        first = false; });
+    if (!csv)
+    {
+        writeChunk_P(PSTR("]}"));
+    }
+    endChunked();
 }
 
-void KnxWebserver::setHostname(String newName)
+void KnxWebserver::handleEvents()
 {
-    hostname = newName;
-	#if defined(ESP32) || defined(ESP8266)
-    ArduinoOTA.setHostname(hostname.c_str());
-	#endif
+    uint32_t token[4];
+    if (authRequired && !(readSessionCookie(token) && findSession(token) != nullptr))
+    {
+        metrics.recordAuthFailure();
+        transport.send(401);
+        return;
+    }
+    transport.beginEventStream();
+    // New clients start with the full state
+    snapshotPublished = false;
+    lastEventCheck = millis() - KNXWEB_EVENT_INTERVAL;
 }
 
-void KnxWebserver::setBuildDetails(String details)
+void KnxWebserver::handleProgMode()
 {
-    buildDetails = details;
+    pendingKnxMode = KNX_MODE_PROG;
+    queueTask(TASK_KNX_MODE);
+    sendActionDone();
 }
 
-void KnxWebserver::setKnxDetail(String physAddr, bool configOk)
+void KnxWebserver::handleNormalMode()
 {
-    knxPhysAddr = physAddr;
-    knxConfigOk = configOk;
+    pendingKnxMode = KNX_MODE_NORMAL;
+    queueTask(TASK_KNX_MODE);
+    sendActionDone();
 }
 
-void KnxWebserver::registerSetKnxModeCallback(callbackSetKnxMode *fctn)
+void KnxWebserver::handleKnxOff()
 {
-    setKnxModeFctn = fctn;
+    pendingKnxMode = KNX_MODE_OFF;
+    queueTask(TASK_KNX_MODE);
+    sendActionDone();
 }
 
-void KnxWebserver::registerGetKnxModeCallback(callbackGetKnxMode *fctn)
+void KnxWebserver::handleOtaOn()
 {
-    getKnxModeFctn = fctn;
+    queueTask(TASK_OTA_ON, TASK_OTA_OFF);
+    sendActionDone();
 }
 
-void KnxWebserver::registerTftUpdateCallback(callbackStartTftUpdate *fctn)
+void KnxWebserver::handleOtaOff()
 {
-    startTftUpdateFctn = fctn;
+    queueTask(TASK_OTA_OFF, TASK_OTA_ON);
+    sendActionDone();
 }
 
-void KnxWebserver::registerTftDebugCallback(callbackStartTftDebug *fctn)
+void KnxWebserver::handleRestart()
 {
-    startTftDebugFctn = fctn;
+    sendActionDone();
+    requestRestart(KNX_HISTORY_COMMAND);
+}
+
+void KnxWebserver::handleTftUpdate()
+{
+    sendActionDone();
+    queueTask(TASK_TFT_UPDATE);
+}
+
+void KnxWebserver::handleTftDebug()
+{
+    sendActionDone();
+    queueTask(TASK_TFT_DEBUG);
 }
 
-void KnxWebserver::handleRoot()
+// The image goes through the relay buffer to the sink, which loop() feeds. With KNXWEB_ASYNC
+// the handler never waits, it holds back the TCP acknowledgement until loop() has drained
+// the data, so the client stops sending while the buffer is full. The synchronous server
+// reads the whole upload within one loop() call and cannot be paused. When the buffer is
+// full, the handler runs loop() itself, which drains it, until the sink takes data again or
+// the relay times out. Each pass is bounded by the budget of the sketch.
+void KnxWebserver::handleTftUploadData()
 {
-    String msg = "<!DOCTYPE html><html>\n";
-    msg += "<head><meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0, user-scalable=no\">\n";
-    msg += "<title>" + hostname + "</title>\n";
-    msg += "<style>html {font-family: Helvetica; display: inline-block; color: #444444; text-align: center;}\n";
-    msg += "h1 {margin: 50px auto 30px;}\n";
-    msg += ".button {display: inline-block;width: 80px;background-color: #3498db;border: none;color: white;padding: 13px 30px;text-decoration: none;font-size: 25px;margin: 0px 5px 35px 5px;cursor: pointer;border-radius: 4px;}\n";
-    msg += ".button-blue {background-color: #3498db; cursor: not-allowed ;}\n";
-    msg += ".button-dark {background-color: #34495e;}\n";
-    msg += ".button-dark:active {background-color: #2c3e50;}\n";
-    msg += ".warning {color: #a93226;}\n";
-    msg += "p {font-size: 14px;color: #888;margin-bottom: 10px;}\n";
-    msg += "</style>\n";
-    msg += "</head>\n";
-    msg += "<body>\n";
-    msg += "<h1>ESP based KNX device</h1>";
-    msg += "<h3>Name: " + hostname + "</h3>";
-    msg += "<h3>Physical address: " + knxPhysAddr + "</h3>\n";
-    if (!knxConfigOk)
+    const knxWebUpload_t &upload = transport.upload();
+    if (upload.status == KNXWEB_UPLOAD_START)
     {
-        msg += "<h3 class=\"warning\">KNX configuration incomplete!</h3>\n";
+        tftUploadStarted = tftRelay.hasSink() && tftRelay.begin(atol(transport.arg("size")));
+        return;
     }
-
-    if (getKnxModeFctn != nullptr)
+    if (!tftUploadStarted)
     {
-        msg += "<p>KNX Mode:</p>";
-        switch (getKnxModeFctn())
+        return;
+    }
+    if (upload.status == KNXWEB_UPLOAD_WRITE)
+    {
+        size_t pushed = tftRelay.push(upload.data, upload.length);
+#if KNXWEB_ASYNC
+        if (pushed < upload.length)
         {
-        case KNX_MODE_OFF:
-            msg += "<a class=\"button button-dark\" href=\"/progmode\">PROG</a><a class=\"button button-dark\" href=\"/normalmode\">Normal</a><a class=\"button button-blue\">OFF</a>\n";
-            break;
-        case KNX_MODE_NORMAL:
-            msg += "<a class=\"button button-dark\" href=\"/progmode\">PROG</a><a class=\"button button-blue\">Normal</a><a class=\"button button-dark\" href=\"/knxoff\">OFF</a>\n";
-            break;
-        case KNX_MODE_PROG:
-            msg += "<a class=\"button button-blue\">PROG</a><a class=\"button button-dark\" href=\"/normalmode\">Normal</a><a class=\"button button-dark\" href=\"/knxoff\">OFF</a>\n";
-            break;
+            // The buffer is larger than the TCP window, a client ignoring it is dropped
+            tftRelay.abort("Buffer overflow");
+        }
+#else
+        while (pushed < upload.length && tftRelay.getState() == UPLOAD_RUNNING)
+        {
+            loopWhileWaiting();
+            pushed += tftRelay.push(upload.data + pushed, upload.length - pushed);
         }
+#endif
+        if (tftRelay.getState() == UPLOAD_RUNNING)
+        {
+            transport.holdUpload();
+        }
+    }
+    else if (upload.status == KNXWEB_UPLOAD_END)
+    {
+        // loop() passes the rest on, the answer is 202 until the display has it
+        tftRelay.finish();
+    }
+    else if (upload.status == KNXWEB_UPLOAD_ABORTED)
+    {
+        tftRelay.abort("Upload aborted");
+        tftRelay.finish();
     }
+}
 
-#if defined(ESP32) || defined(ESP8266)
-    if (otaActive)
+// 202 while the display still receives the buffered rest, see /tftupload/status
+void KnxWebserver::handleTftUploadDone()
+{
+    transport.sendHeader("Cache-Control", "no-store");
+    if (!tftRelay.hasSink())
     {
-        int remainingTime = 5 * 60 - (millis() - otaStartTime) / 1000;
-        msg += "<script>var t=" + String(remainingTime) + ";var x=setInterval(function(){var m=Math.floor(t/60);var s=t%60;document.getElementById(\"timer\").innerHTML=m+\"m \"+s+\"s\";t--;if(t<0){clearInterval(x);location.reload();}},1000);</script>";
-        msg += "<p>OTA: <span id=\"timer\"></span></p><a class=\"button button-blue\">ON</a><a class=\"button button-dark\" href=\"/otaoff\">OFF</a>";
+        transport.send(501, "text/plain", "No TFT sink");
+        return;
     }
-    else
+    if (!tftUploadStarted)
     {
-        msg += "<p>OTA:</p><a class=\"button button-dark\" href=\"/otaon\">ON</a><a class=\"button button-blue\">OFF</a>";
+        transport.send(409, "text/plain", "TFT upload running");
+        return;
     }
-#else
-    msg += "<p>Webupdate:</p>";
-#endif
+    tftUploadStarted = false;
+    uploadState_t state = tftRelay.getState();
+    sendTftUploadStatus(state == UPLOAD_FAILED ? 502 : state == UPLOAD_RUNNING ? 202 : 200);
+}
+
+void KnxWebserver::handleTftUploadStatus()
+{
+    transport.sendHeader("Cache-Control", "no-store");
+    sendTftUploadStatus(200);
+}
 
-    msg += "<a class=\"button button-dark\" href=\"/webupdate\">Upload</a>\n<p>System:</p><a class=\"button button-dark\" href=\"/restart\">Restart</a>";
+// Same fields as /upload/status, written counts the bytes the display took
+void KnxWebserver::sendTftUploadStatus(int code)
+{
+    static const char *const stateNames[] = {"idle", "running", "done", "failed"};
+    beginChunked(code, "application/json");
+    writeChunkf("{\"state\":\"%s\",\"received\":%lu,\"total\":%lu,\"written\":%lu,\"buffered\":%lu,\"progress\":%u,\"bytesPerSecond\":%lu,\"eta\":%lu,\"error\":",
+                stateNames[tftRelay.getState()], (unsigned long)tftRelay.getReceived(), (unsigned long)tftRelay.getTotal(), (unsigned long)tftRelay.getWritten(),
+                (unsigned long)tftRelay.getBuffered(), tftRelay.getProgress(), (unsigned long)tftRelay.getBytesPerSecond(), (unsigned long)tftRelay.getEtaSeconds());
+    writeJsonString(tftRelay.getError());
+    writeChunk_P(PSTR("}"));
+    endChunked();
+}
 
-    if (startTftUpdateFctn != nullptr)
+// Links get a redirect back to the page. The page itself sends POST with fetch() and gets
+// the new state pushed, so it needs neither the redirect nor the page load that follows.
+void KnxWebserver::sendActionDone()
+{
+    if (requestMethod == KNXWEB_HTTP_POST)
     {
-        msg += "<a class=\"button button-dark\" href=\"/tftupdate\">TFT Update</a>";
+        transport.send(204);
+        return;
     }
+    transport.sendHeader("Location", "/");
+    transport.send(302, "text/plain", "");
+}
 
-    if (startTftDebugFctn != nullptr)
-    {
-        msg += "<a class=\"button button-dark\" href=\"/tftdebug\">TFT Debug</a>";
+void KnxWebserver::handleWebUpdateProgress() {
+  const knxWebUpload_t &upload = transport.upload();
+  if (upload.status == KNXWEB_UPLOAD_START) {
+    size_t fsize = UPDATE_SIZE_UNKNOWN;
+    if (transport.hasArg("size")) {
+      fsize = atol(transport.arg("size"));
     }
+    // heatshrink has no magic number, it is recognized by the file extension. A refused
+    // upload keeps its error in firmwareUpload for handleWebUpdateDone()
+    firmwareUpload.begin(fsize, upload.filename.endsWith(".hs"));
+  } else if (upload.status == KNXWEB_UPLOAD_WRITE) {
+    firmwareUpload.write(upload.data, upload.length);
+  } else if (upload.status == KNXWEB_UPLOAD_END) {
+    // The result goes to the metrics and the history
+    recordUploadResult(firmwareUpload.end());
+  } else if (upload.status == KNXWEB_UPLOAD_ABORTED) {
+    firmwareUpload.abort();
+    recordUploadResult(false);
+  }
+}
+
+void KnxWebserver::handleWebUpdateDone() {
+  if (firmwareUpload.getState() != UPLOAD_DONE) {
+    transport.send(502, "text/plain", firmwareUpload.getError());
+  } else {
+    // The device restarts, a kept connection would only be reset
+    transport.closeConnection();
+    transport.sendHeader("Refresh", "10");
+    transport.sendHeader("Location", "/");
+    transport.send(307);
+    requestRestart(KNX_HISTORY_WEB);
+  }
+}
 
-    if (authRequired)
+static bool parseSha256(const char *hex, uint8_t digest[KNXWEB_SHA256_SIZE])
+{
+    if (strlen(hex) != 2 * KNXWEB_SHA256_SIZE)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < 2 * KNXWEB_SHA256_SIZE; i++)
     {
-        msg += "<a class=\"button button-dark\" onclick=\"window.open('http://logout@'+window.location.host,'_self');\">Logout</a>";
+        char c = hex[i];
+        uint8_t nibble;
+        if (c >= '0' && c <= '9')
+        {
+            nibble = c - '0';
+        }
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+        {
+            nibble = (c | 0x20) - 'a' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        digest[i / 2] = (digest[i / 2] << 4) | nibble;
     }
-    msg += "\n";
+    return true;
+}
 
-#if defined(ESP32)
-    char strBuffer[50];
-    msg += "<h3>ESP32 Chip Info</h3>";
-    sprintf(strBuffer, "<p>Flash size: %.1gMB<br>", spi_flash_get_chip_size() / 1024.0 / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "PSRAM size: %.1gMB<br>", ESP.getPsramSize() / 1024.0 / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Free PSRAM: %.1gMB<br>", ESP.getFreePsram() / 1024.0 / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Heap size: %.3gKB<br>", ESP.getHeapSize() / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Free heap: %.3gKB<br>", ESP.getFreeHeap() / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Chip temperature: %.1f&deg;C<br>", temperatureRead());
-    msg += String(strBuffer);
-    sprintf(strBuffer, "CPU frequency: %dMHz<br>", ESP.getCpuFreqMHz());
-    msg += String(strBuffer);
-    msg += "WIFI MAC: " + String(WiFi.macAddress()) + "<br>";
-    sprintf(strBuffer, "WIFI Signal: %d&percnt;</p>", getRSSIasQuality(WiFi.RSSI()));
-    msg += String(strBuffer);
-#elif defined(ESP8266)
-    char strBuffer[100];
-    msg += "<h3>ESP8266 Chip Info</h3>";
-    sprintf(strBuffer, "<p>Flash size: %.1gMB<br>", ESP.getFlashChipRealSize() / 1024.0 / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Free heap: %.3gKB<br>", ESP.getFreeHeap() / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "CPU frequency: %dMHz<br>", ESP.getCpuFreqMHz());
-    msg += String(strBuffer);
-    msg += "WIFI MAC: " + String(WiFi.macAddress()) + "<br>";
-    sprintf(strBuffer, "WIFI Signal: %d&percnt;<br>", getRSSIasQuality(WiFi.RSSI()));
-    msg += String(strBuffer);
-    msg += "Last restart reason: " + ESP.getResetInfo() + "</p>";
-#elif defined(LIBRETINY)
-    char strBuffer[100];
-    msg += "<h3>Beken Chip Info</h3>";
-    sprintf(strBuffer, "<p>Flash size: %.1gMB<br>", ESP.getFlashChipRealSize() / 1024.0 / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "Free heap: %.3gKB<br>", ESP.getFreeHeap() / 1024.0);
-    msg += String(strBuffer);
-    sprintf(strBuffer, "CPU frequency: %dMHz<br>", ESP.getCpuFreqMHz());
-    msg += String(strBuffer);
-    msg += "WIFI MAC: " + String(WiFi.macAddress()) + "<br>";
-    sprintf(strBuffer, "WIFI Signal: %d&percnt;<br>", getRSSIasQuality(WiFi.RSSI()));
-    msg += String(strBuffer);
-    sprintf(strBuffer, "SDK Version: %s<br>", ESP.getSdkVersion());
-    msg += String(strBuffer);
-    msg += "Last restart reason: " + ESP.getResetInfo() + "</p>";
-#endif
-    msg += "<p>" + buildDetails + "</p>\n";
-    msg += "</body>\n";
-    msg += "</html>\n";
-    server->send(200, "text/html", msg);
+// Resumable upload: /upload/begin announces size and SHA-256 of the file and answers the
+// offset to continue at, which is 0 unless the same file is already partly received.
+// Chunks are posted to /upload/chunk?offset=N, a connection lost during a chunk keeps the
+// upload running so the client asks /upload/begin again and resends from there.
+// /upload/end activates the image after its SHA-256 matched.
+void KnxWebserver::handleUploadBegin()
+{
+    uint8_t digest[KNXWEB_SHA256_SIZE];
+    size_t size = atol(transport.arg("size"));
+    transport.sendHeader("Cache-Control", "no-store");
+    if (size == 0 || !parseSha256(transport.arg("sha256"), digest))
+    {
+        transport.send(400, "application/json", "{\"error\":\"size and sha256 required\"}");
+        return;
+    }
+    if (!firmwareUpload.isResumable(size, digest))
+    {
+        // heatshrink has no magic number, it is recognized by the file extension
+        size_t nameLength = strlen(transport.arg("name"));
+        bool heatshrink = nameLength > 3 && strcmp(transport.arg("name") + nameLength - 3, ".hs") == 0;
+        firmwareUpload.begin(size, heatshrink, digest);
+    }
+    uploadClientIP = transport.remoteIP();
+    sendUploadOffset(200);
 }
 
-void KnxWebserver::handleProgMode()
+void KnxWebserver::handleUploadChunkData()
 {
-    if (setKnxModeFctn != nullptr)
+    const knxWebUpload_t &upload = transport.upload();
+    if (upload.status == KNXWEB_UPLOAD_START)
+    {
+        chunkOffset = atol(transport.arg("offset"));
+    }
+    else if (upload.status == KNXWEB_UPLOAD_WRITE)
     {
-        setKnxModeFctn(KNX_MODE_PROG);
+        bool running = firmwareUpload.getState() == UPLOAD_RUNNING;
+        firmwareUpload.writeAt(chunkOffset, upload.data, upload.length);
+        chunkOffset += upload.length;
+        if (running && firmwareUpload.getState() == UPLOAD_FAILED)
+        {
+            recordUploadResult(false);
+        }
     }
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
 }
 
-void KnxWebserver::handleNormalMode()
+void KnxWebserver::handleUploadChunk()
 {
-    if (setKnxModeFctn != nullptr)
+    transport.sendHeader("Cache-Control", "no-store");
+    if (firmwareUpload.getState() != UPLOAD_RUNNING)
     {
-        setKnxModeFctn(KNX_MODE_NORMAL);
+        sendUploadError();
+        return;
     }
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
+    // A chunk starting after the received data is ignored, the client resends from the offset
+    sendUploadOffset(chunkOffset > firmwareUpload.getReceived() ? 409 : 200);
+    chunkOffset = 0;
 }
 
-void KnxWebserver::handleKnxOff()
+void KnxWebserver::handleUploadEnd()
 {
-    if (setKnxModeFctn != nullptr)
+    transport.sendHeader("Cache-Control", "no-store");
+    if (firmwareUpload.getState() != UPLOAD_RUNNING || firmwareUpload.getReceived() != firmwareUpload.getTotal())
     {
-        setKnxModeFctn(KNX_MODE_OFF);
+        sendUploadError();
+        return;
     }
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
+    bool success = firmwareUpload.end();
+    recordUploadResult(success);
+    if (!success)
+    {
+        sendUploadError();
+        return;
+    }
+    // The device restarts, a kept connection would only be reset
+    transport.closeConnection();
+    sendUploadOffset(200);
+    requestRestart(KNX_HISTORY_WEB);
 }
 
-void KnxWebserver::handleOtaOn()
+void KnxWebserver::sendUploadOffset(int code)
 {
-    startOta();
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
+    char json[32];
+    snprintf(json, sizeof(json), "{\"offset\":%lu}", (unsigned long)firmwareUpload.getReceived());
+    transport.send(code, "application/json", json);
 }
 
-void KnxWebserver::handleOtaOff()
+// 409 while no upload runs or it is still incomplete, 502 when it failed
+void KnxWebserver::sendUploadError()
 {
-    endOta();
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
+    uploadState_t state = firmwareUpload.getState();
+    beginChunked(state == UPLOAD_FAILED ? 502 : 409, "application/json");
+    writeChunkf("{\"offset\":%lu,\"error\":", (unsigned long)firmwareUpload.getReceived());
+    writeJsonString(state == UPLOAD_FAILED ? firmwareUpload.getError() : state == UPLOAD_RUNNING ? "incomplete" : "no upload running");
+    writeChunk_P(PSTR("}"));
+    endChunked();
 }
 
-void KnxWebserver::handleRestart()
+void KnxWebserver::recordUploadResult(bool success)
 {
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
-    server->handleClient();
-    ESP.restart();
+    metrics.recordUpload(success, firmwareUpload.getReceived(), firmwareUpload.getBytesPerSecond());
+    pendingUpdateSuccess = success;
+    pendingUpdateBytes = firmwareUpload.getReceived();
+    queueTask(TASK_HISTORY);
 }
 
-void KnxWebserver::handleTftUpdate()
+void KnxWebserver::handleUploadStatus()
+{
+    static const char *const stateNames[] = {"idle", "running", "done", "failed"};
+    transport.sendHeader("Cache-Control", "no-store");
+    beginChunked(200, "application/json");
+    writeChunkf("{\"state\":\"%s\",\"received\":%lu,\"total\":%lu,\"written\":%lu,\"progress\":%u,\"bytesPerSecond\":%lu,\"eta\":%lu,\"error\":",
+                stateNames[firmwareUpload.getState()], (unsigned long)firmwareUpload.getReceived(), (unsigned long)firmwareUpload.getTotal(),
+                (unsigned long)firmwareUpload.getWritten(), firmwareUpload.getProgress(), (unsigned long)firmwareUpload.getBytesPerSecond(), (unsigned long)firmwareUpload.getEtaSeconds());
+    writeJsonString(firmwareUpload.getError());
+    writeChunkf(",\"verified\":%s}", firmwareUpload.isVerified() ? "true" : "false");
+    endChunked();
+}
+
+void KnxWebserver::handleLogout()
 {
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
-    if (startTftUpdateFctn != nullptr)
+    uint32_t token[4];
+    if (readSessionCookie(token))
     {
-        startTftUpdateFctn();
+        Session *session = findSession(token);
+        if (session != nullptr)
+        {
+            session->valid = false;
+        }
     }
+    transport.sendHeader("Set-Cookie", "KNXSESSION=; Max-Age=0; Path=/; HttpOnly; SameSite=Strict");
+    transport.requestAuthentication();
 }
 
-void KnxWebserver::handleTftDebug()
+void KnxWebserver::handleNotFound()
 {
-    server->sendHeader("Location", String("/"), true);
-    server->send(302, "text/plain", "");
-    if (startTftDebugFctn != nullptr)
+    unsigned long start = micros();
+    uint32_t retryAfter = admitRequest(1);
+    if (retryAfter != 0)
     {
-        startTftDebugFctn();
+        sendTooManyRequests(retryAfter);
+        arena.reset();
+        return;
     }
+    transport.send(404);
+    arena.reset();
+    metrics.recordRequest(NOT_FOUND_SLOT, micros() - start, 0, 0);
 }
 
-void KnxWebserver::handleWebUpdateProgress() {
-  size_t fsize = UPDATE_SIZE_UNKNOWN;
-  if (server->hasArg("size")) {
-    fsize = server->arg("size").toInt();
-  }
-  HTTPUpload &upload = server->upload();
-  if (upload.status == UPLOAD_FILE_START) {
-    Serial.printf("Receiving Update: %s, Size: %d\n", upload.filename.c_str(), fsize);
-    if (!Update.begin(fsize)) {
-      updateProgress = 0;
-      Update.printError(Serial);
-    }
-  } else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-      Update.printError(Serial);
-    } else {
-      updateProgress = 100 * Update.progress() / Update.size();
-    }
-  } else if (upload.status == UPLOAD_FILE_END) {
-    if (Update.end(true)) {
-      Serial.printf("Update Success: %u bytes\nRebooting...\n", upload.totalSize);
-    } else {
-      Serial.printf("%s\n", Update.errorString());
-      updateProgress = 0;
+// ?reset starts the loop figures over after they were sent, tools/knx_bench.py uses it to
+// see how long the sketch had to wait for loop() under its load
+void KnxWebserver::handleApiProfile()
+{
+    bool reset = transport.hasArg("reset");
+    transport.sendHeader("Cache-Control", "no-store");
+    beginChunked(200, "application/json");
+    writeChunkf("{\"uptime\":%lu,\"loopCalls\":%lu,\"loopMax\":%lu,\"loopGapMax\":%lu,\"loopOverBudget\":%lu,\"heap\":%lu,\"minHeap\":%lu",
+                millis() / 1000, (unsigned long)loopStats.calls, (unsigned long)loopStats.maxMicros, (unsigned long)loopStats.maxGapMicros,
+                (unsigned long)loopStats.overBudget, (unsigned long)ESP.getFreeHeap(), (unsigned long)systemInfo.getMinFreeHeap());
+    writeChunkf(",\"arenaSize\":%lu,\"arenaHighWater\":%lu,\"arenaOverflows\":%lu,\"arenaFailures\":%lu,\"connections\":%lu,\"inFlightMax\":%u",
+                (unsigned long)arena.getSize(), (unsigned long)arena.getHighWater(), (unsigned long)arena.getOverflows(),
+                (unsigned long)arena.getFailures(), (unsigned long)transport.getConnections(), transport.getMaxRequestsInFlight());
+#if KNXWEB_RATE_LIMIT
+    writeChunkf(",\"rateLimited\":%lu,\"overloaded\":%lu", (unsigned long)rateLimiter.getRejected(), (unsigned long)overloaded);
+#endif
+    writeChunk_P(PSTR(",\"routes\":["));
+    bool first = true;
+    for (uint8_t slot = 0; slot <= NOT_FOUND_SLOT; slot++)
+    {
+        uint32_t count = metrics.getRequests(slot);
+        if (count == 0)
+        {
+            continue;
+        }
+        const char *path = slot < ROUTE_COUNT ? routes[slot].path : slot < NOT_FOUND_SLOT ? staticAssets[slot - ROUTE_COUNT].path
+                                                                                         : "other";
+        // Durations in microseconds, bytes as average response body per request
+        writeChunk_P(first ? PSTR("{\"path\":") : PSTR(",{\"path\":"));
+        writeJsonString(path);
+        writeChunkf(",\"count\":%lu,\"avg\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu,\"bytes\":%lu,\"heapDelta\":%ld}",
+                    (unsigned long)count, (unsigned long)(metrics.getDurationMicros(slot) / count),
+                    (unsigned long)metrics.getPercentile(slot, 50), (unsigned long)metrics.getPercentile(slot, 99),
+                    (unsigned long)metrics.getMaxDuration(slot), (unsigned long)(metrics.getResponseBytes(slot) / count),
+                    (long)metrics.getMaxHeapDelta(slot));
+        first = false;
+    }
+    writeChunk_P(PSTR("]}"));
+    endChunked();
+    if (reset)
+    {
+        resetLoopStats();
     }
-  }
 }
 
-void KnxWebserver::handleWebUpdateDone() {
-  server->sendHeader("Connection", "close");
-  if (Update.hasError()) {
-    server->send(502, "text/plain", Update.errorString());
-  } else {
-    server->sendHeader("Refresh", "10");
-    server->sendHeader("Location", "/");
-    server->send(307);
-    ESP.restart();
-  }
+// Writes the name and the path label of a knxweb_request_duration_seconds series, the
+// caller adds further labels and the value. Paths are written like any string, whatever their length.
+void KnxWebserver::writeDurationSeries(PGM_P series, const char *path)
+{
+    writeChunk_P(PSTR("knxweb_request_duration_seconds_"));
+    writeChunk_P(series);
+    writeChunk_P(PSTR("{path=\""));
+    writeChunk(path, strlen(path));
+    writeChunk("\"", 1);
 }
 
-void KnxWebserver::handleNotFound()
+void KnxWebserver::handleMetrics()
+{
+    static const char *const bucketLabels[KNXWEB_METRICS_BUCKETS] = {"0.001", "0.005", "0.01", "0.05", "0.1", "0.5", "1"};
+    transport.sendHeader("Cache-Control", "no-store");
+    beginChunked(200, "text/plain; version=0.0.4");
+
+    writeChunk_P(PSTR("# HELP knxweb_request_duration_seconds Time to handle a request\n"
+                      "# TYPE knxweb_request_duration_seconds histogram\n"));
+    for (uint8_t slot = 0; slot <= NOT_FOUND_SLOT; slot++)
+    {
+        uint32_t count = metrics.getRequests(slot);
+        if (count == 0)
+        {
+            continue;
+        }
+        const char *path = slot < ROUTE_COUNT ? routes[slot].path : slot < NOT_FOUND_SLOT ? staticAssets[slot - ROUTE_COUNT].path
+                                                                                         : "other";
+        uint32_t cumulative = 0;
+        for (uint8_t bucket = 0; bucket < KNXWEB_METRICS_BUCKETS; bucket++)
+        {
+            cumulative += metrics.getBucket(slot, bucket);
+            writeDurationSeries(PSTR("bucket"), path);
+            writeChunkf(",le=\"%s\"} %lu\n", bucketLabels[bucket], (unsigned long)cumulative);
+        }
+        // A request recorded while writing may already be in a bucket but not yet in the count
+        count = max(count, cumulative);
+        uint64_t sum = metrics.getDurationMicros(slot);
+        writeDurationSeries(PSTR("bucket"), path);
+        writeChunkf(",le=\"+Inf\"} %lu\n", (unsigned long)count);
+        writeDurationSeries(PSTR("sum"), path);
+        writeChunkf("} %lu.%06lu\n", (unsigned long)(sum / 1000000), (unsigned long)(sum % 1000000));
+        writeDurationSeries(PSTR("count"), path);
+        writeChunkf("} %lu\n", (unsigned long)count);
+    }
+
+    writeChunk_P(PSTR("# HELP knxweb_response_bytes_total Bytes of response bodies and events sent\n"
+                      "# TYPE knxweb_response_bytes_total counter\n"));
+    writeChunkf("knxweb_response_bytes_total %lu\n", (unsigned long)transport.getBytesSent());
+    writeChunk_P(PSTR("# HELP knxweb_connections_total Connections that sent a request\n"
+                      "# TYPE knxweb_connections_total counter\n"));
+    writeChunkf("knxweb_connections_total %lu\n", (unsigned long)transport.getConnections());
+#if KNXWEB_DISCOVERY
+    writeChunk_P(PSTR("# HELP knxweb_discovery_queries_total Discovery queries answered\n"
+                      "# TYPE knxweb_discovery_queries_total counter\n"));
+    writeChunkf("knxweb_discovery_queries_total %lu\n", (unsigned long)discovery.getQueries());
+    writeChunk_P(PSTR("# HELP knxweb_discovery_dropped_total Discovery queries dropped because the reply queue was full\n"
+                      "# TYPE knxweb_discovery_dropped_total counter\n"));
+    writeChunkf("knxweb_discovery_dropped_total %lu\n", (unsigned long)discovery.getDropped());
+#endif
+    writeChunk_P(PSTR("# HELP knxweb_auth_failures_total Requests rejected for missing or wrong credentials\n"
+                      "# TYPE knxweb_auth_failures_total counter\n"));
+    writeChunkf("knxweb_auth_failures_total %lu\n", (unsigned long)metrics.getAuthFailures());
+#if KNXWEB_RATE_LIMIT
+    writeChunk_P(PSTR("# HELP knxweb_rate_limited_total Requests refused with 429 by the rate limiter\n"
+                      "# TYPE knxweb_rate_limited_total counter\n"));
+    writeChunkf("knxweb_rate_limited_total %lu\n", (unsigned long)rateLimiter.getRejected());
+    writeChunk_P(PSTR("# HELP knxweb_overloaded_total Requests refused with 429 because too many were in flight\n"
+                      "# TYPE knxweb_overloaded_total counter\n"));
+    writeChunkf("knxweb_overloaded_total %lu\n", (unsigned long)overloaded);
+#endif
+    writeChunk_P(PSTR("# HELP knxweb_uploads_total Finished firmware uploads\n"
+                      "# TYPE knxweb_uploads_total counter\n"));
+    writeChunkf("knxweb_uploads_total{result=\"success\"} %lu\n"
+                "knxweb_uploads_total{result=\"failure\"} %lu\n",
+                (unsigned long)metrics.getUploads(true), (unsigned long)metrics.getUploads(false));
+    writeChunk_P(PSTR("# HELP knxweb_upload_bytes_total Bytes received by firmware uploads\n"
+                      "# TYPE knxweb_upload_bytes_total counter\n"));
+    writeChunkf("knxweb_upload_bytes_total %lu\n", (unsigned long)metrics.getUploadBytes());
+    writeChunk_P(PSTR("# HELP knxweb_upload_bytes_per_second Throughput of the last firmware upload\n"
+                      "# TYPE knxweb_upload_bytes_per_second gauge\n"));
+    writeChunkf("knxweb_upload_bytes_per_second %lu\n", (unsigned long)metrics.getUploadBytesPerSecond());
+    writeChunk_P(PSTR("# HELP knxweb_ota_sessions_total Times ArduinoOTA was enabled\n"
+                      "# TYPE knxweb_ota_sessions_total counter\n"));
+    writeChunkf("knxweb_ota_sessions_total %lu\n", (unsigned long)metrics.getOtaSessions());
+    writeChunk_P(PSTR("# HELP knxweb_ota_polls_total Calls of ArduinoOTA.handle()\n"
+                      "# TYPE knxweb_ota_polls_total counter\n"));
+    writeChunkf("knxweb_ota_polls_total %lu\n", (unsigned long)ota.getPolls());
+    writeChunk_P(PSTR("# HELP knxweb_free_heap_bytes Free heap\n"
+                      "# TYPE knxweb_free_heap_bytes gauge\n"));
+    writeChunkf("knxweb_free_heap_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+    writeChunk_P(PSTR("# HELP knxweb_min_free_heap_bytes Lowest free heap since start\n"
+                      "# TYPE knxweb_min_free_heap_bytes gauge\n"));
+    writeChunkf("knxweb_min_free_heap_bytes %lu\n", (unsigned long)systemInfo.getMinFreeHeap());
+    writeChunk_P(PSTR("# HELP knxweb_arena_high_water_bytes Most memory a request used from the request arena\n"
+                      "# TYPE knxweb_arena_high_water_bytes gauge\n"));
+    writeChunkf("knxweb_arena_high_water_bytes %lu\n", (unsigned long)arena.getHighWater());
+    writeChunk_P(PSTR("# HELP knxweb_arena_overflows_total Allocations that did not fit in the request arena\n"
+                      "# TYPE knxweb_arena_overflows_total counter\n"));
+    writeChunkf("knxweb_arena_overflows_total %lu\n", (unsigned long)arena.getOverflows());
+    knxSysInfoRange_t rssi = systemInfo.getRssiRange();
+    writeChunk_P(PSTR("# HELP knxweb_wifi_rssi_dbm WiFi signal over the last samples\n"
+                      "# TYPE knxweb_wifi_rssi_dbm gauge\n"));
+    writeChunkf("knxweb_wifi_rssi_dbm{stat=\"min\"} %ld\n"
+                "knxweb_wifi_rssi_dbm{stat=\"avg\"} %ld\n"
+                "knxweb_wifi_rssi_dbm{stat=\"max\"} %ld\n",
+                (long)rssi.min, (long)rssi.avg, (long)rssi.max);
+#if defined(ESP32)
+    knxSysInfoRange_t temp = systemInfo.getTemperatureRange();
+    writeChunk_P(PSTR("# HELP knxweb_temperature_celsius Chip temperature over the last samples\n"
+                      "# TYPE knxweb_temperature_celsius gauge\n"));
+    writeChunkf("knxweb_temperature_celsius{stat=\"min\"} %.1f\n"
+                "knxweb_temperature_celsius{stat=\"avg\"} %.1f\n"
+                "knxweb_temperature_celsius{stat=\"max\"} %.1f\n",
+                temp.min / 10.0, temp.avg / 10.0, temp.max / 10.0);
+#endif
+    endChunked();
+}
+
+void KnxWebserver::beginChunked(int code, const char *contentType)
+{
+    chunkLength = 0;
+    transport.beginChunked(code, contentType);
+}
+
+void KnxWebserver::writeChunk(const char *data, size_t length)
+{
+    while (length > 0)
+    {
+        size_t part = min(length, sizeof(chunkBuffer) - chunkLength);
+        memcpy(chunkBuffer + chunkLength, data, part);
+        chunkLength += part;
+        data += part;
+        length -= part;
+        if (chunkLength == sizeof(chunkBuffer))
+        {
+            flushChunk();
+        }
+    }
+}
+
+void KnxWebserver::writeChunk(const String &text)
 {
-    server->send(404);
+    writeChunk(text.c_str(), text.length());
 }
 
-int KnxWebserver::getRSSIasQuality(int RSSI)
+void KnxWebserver::writeChunk_P(PGM_P text)
 {
-    int quality = 0;
+    writeChunk_P(text, strlen_P(text));
+}
 
-    if (RSSI <= -100)
+void KnxWebserver::writeChunk_P(PGM_P text, size_t length)
+{
+    while (length > 0)
     {
-        quality = 0;
+        size_t part = min(length, sizeof(chunkBuffer) - chunkLength);
+        memcpy_P(chunkBuffer + chunkLength, text, part);
+        chunkLength += part;
+        text += part;
+        length -= part;
+        if (chunkLength == sizeof(chunkBuffer))
+        {
+            flushChunk();
+        }
     }
-    else if (RSSI >= -50)
+}
+
+void KnxWebserver::writeChunkf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(chunkBuffer + chunkLength, sizeof(chunkBuffer) - chunkLength, format, args);
+    va_end(args);
+    if (length < 0)
     {
-        quality = 100;
+        return;
     }
-    else
+    if (chunkLength + length >= sizeof(chunkBuffer))
     {
-        quality = 2 * (RSSI + 100);
+        // Did not fit behind the pending data, flush and format again at the start of the buffer
+        flushChunk();
+        va_start(args, format);
+        length = vsnprintf(chunkBuffer, sizeof(chunkBuffer), format, args);
+        va_end(args);
+        if (length < 0)
+        {
+            return;
+        }
+        // Only values of bounded length are formatted, strings go through writeChunk() and writeJsonString()
+        length = min((size_t)length, sizeof(chunkBuffer) - 1);
     }
-    return quality;
+    chunkLength += length;
 }
 
-#if defined(ESP32) || defined(ESP8266)
-void KnxWebserver::otaSetup()
+void KnxWebserver::writeJsonString(const String &text)
 {
-    if (!otaIntialized)
-    {
-        ArduinoOTA.onStart([]()
-                           { Serial.println("Start"); });
-        ArduinoOTA.onEnd([]()
-                         { Serial.println("\nEnd"); });
-        ArduinoOTA.onProgress([](unsigned int progress, unsigned int total)
-                              { Serial.printf("Progress: %u%%\r", (progress / (total / 100))); });
-        ArduinoOTA.onError([](ota_error_t error)
-                           {
-        Serial.printf("Error[%u]: ", error);
-        if (error == OTA_AUTH_ERROR) Serial.println("Auth Failed");
-        else if (error == OTA_BEGIN_ERROR) Serial.println("Begin Failed");
-        else if (error == OTA_CONNECT_ERROR) Serial.println("Connect Failed");
-        else if (error == OTA_RECEIVE_ERROR) Serial.println("Receive Failed");
-        else if (error == OTA_END_ERROR) Serial.println("End Failed"); });
+    writeJsonString(text.c_str());
+}
 
-        otaIntialized = true;
+void KnxWebserver::writeJsonString(const char *text)
+{
+    writeChunk("\"", 1);
+    for (; *text != 0; text++)
+    {
+        char c = *text;
+        if (c == '"' || c == '\\')
+        {
+            char escaped[2] = {'\\', c};
+            writeChunk(escaped, sizeof(escaped));
+        }
+        else if ((uint8_t)c < 0x20)
+        {
+            writeChunkf("\\u%04x", c);
+        }
+        else
+        {
+            writeChunk(&c, 1);
+        }
     }
+    writeChunk("\"", 1);
 }
 
-void KnxWebserver::startOta()
+// Length of text written by writeJsonString()
+static size_t jsonStringLength(const char *text)
 {
-    otaSetup();
+    size_t length = 2;
+    for (; *text != 0; text++)
+    {
+        uint8_t c = *text;
+        length += c == '"' || c == '\\' ? 2 : c < 0x20 ? 6 : 1;
+    }
+    return length;
+}
 
-    otaActive = true;
-    otaStartTime = millis();
-    ArduinoOTA.begin();
+void KnxWebserver::sendPage(int code, const char *contentType, PGM_P text, const uint16_t *slots, size_t count, size_t length,
+                            const knxPageValue_t *values)
+{
+    size_t templateLength = length + count;
+    for (size_t i = 0; i < count; i++)
+    {
+        length += values[i].type == KNXPAGE_JSON_STRING ? jsonStringLength(values[i].text)
+                  : values[i].type == KNXPAGE_TEXT_P    ? strlen_P(values[i].text)
+                                                        : strlen(values[i].text);
+    }
+    transport.beginResponse(code, contentType, length);
+    chunkLength = 0;
+    size_t offset = 0;
+    for (size_t i = 0; i <= count; i++)
+    {
+        // The fragment before slot i, after the last slot the end of the template
+        size_t end = i < count ? pgm_read_word(&slots[i]) : templateLength;
+        writeChunk_P(text + offset, end - offset);
+        offset = end + 1;
+        if (i == count)
+        {
+            break;
+        }
+        switch (values[i].type)
+        {
+        case KNXPAGE_JSON_STRING:
+            writeJsonString(values[i].text);
+            break;
+        case KNXPAGE_TEXT_P:
+            writeChunk_P(values[i].text);
+            break;
+        default:
+            writeChunk(values[i].text, strlen(values[i].text));
+            break;
+        }
+    }
+    flushChunk();
+    transport.endResponse();
 }
 
-void KnxWebserver::endOta()
+void KnxWebserver::flushChunk()
 {
-    otaActive = false;
-    ArduinoOTA.end();
+    if (chunkLength > 0)
+    {
+        transport.sendChunk(chunkBuffer, chunkLength);
+        chunkLength = 0;
+    }
 }
-#else
-//not supported
-void KnxWebserver::otaSetup()
+
+void KnxWebserver::endChunked()
 {
+    flushChunk();
+    transport.endChunked();
 }
 
 void KnxWebserver::startOta()
 {
+#if defined(ESP32) || defined(ESP8266)
+    metrics.recordOtaSession();
+    ota.start(millis());
+#endif
 }
 
 void KnxWebserver::endOta()
 {
+    ota.stop();
 }
-#endif
\ No newline at end of file
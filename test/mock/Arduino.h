@@ -0,0 +1,104 @@
+#pragma once
+
+// Arduino core of the native test build, just enough of the ESP8266 core for KnxWebserver.
+// The test controls are in KnxMock.h.
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define F(s) (s)
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long max);
+long random(long min, long max);
+
+class String
+{
+public:
+    String() {}
+    String(const char *text) : text(text != nullptr ? text : "") {}
+    String(const std::string &text) : text(text) {}
+
+    const char *c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.size(); }
+    bool isEmpty() const { return text.empty(); }
+    bool startsWith(const char *prefix) const { return text.compare(0, strlen(prefix), prefix) == 0; }
+    bool endsWith(const char *suffix) const
+    {
+        size_t length = strlen(suffix);
+        return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+    }
+    String &operator+=(const String &other)
+    {
+        text += other.text;
+        return *this;
+    }
+    bool operator==(const char *other) const { return text == other; }
+    bool operator==(const String &other) const { return text == other.text; }
+    bool operator!=(const char *other) const { return text != other; }
+
+private:
+    std::string text;
+};
+
+class IPAddress
+{
+public:
+    IPAddress() {}
+    IPAddress(uint32_t address) : address(address) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+    operator uint32_t() const { return address; }
+
+private:
+    uint32_t address = 0;
+};
+
+struct rst_info
+{
+    uint32_t reason;
+};
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap();
+    uint32_t getFlashChipRealSize() { return 4 * 1024 * 1024; }
+    uint32_t getFreeSketchSpace() { return 1024 * 1024; }
+    uint8_t getCpuFreqMHz() { return 80; }
+    const char *getSdkVersion() { return "native"; }
+    String getResetInfo() { return "Power on"; }
+    rst_info *getResetInfoPtr() { return &resetInfo; }
+    uint32_t random() { return ::random(0x7FFFFFFF) ^ (uint32_t)::random(0x7FFFFFFF) << 1; }
+    // Counted instead, a test may check that a restart was requested
+    void restart() { restarts++; }
+
+    rst_info resetInfo = {0};
+    uint32_t restarts = 0;
+};
+
+extern EspClass ESP;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum
+{
+    OTA_AUTH_ERROR,
+    OTA_BEGIN_ERROR,
+    OTA_CONNECT_ERROR,
+    OTA_RECEIVE_ERROR,
+    OTA_END_ERROR
+} ota_error_t;
+
+// Never receives an update, the tests only switch it on and off
+class ArduinoOTAClass
+{
+public:
+    void onStart(std::function<void()> fn) { startFctn = fn; }
+    void onEnd(std::function<void()> fn) { endFctn = fn; }
+    void onProgress(std::function<void(unsigned int, unsigned int)> fn) { progressFctn = fn; }
+    void onError(std::function<void(ota_error_t)> fn) { errorFctn = fn; }
+    void setHostname(const char *name) { hostname = name; }
+    void begin() { running = true; }
+    void end() { running = false; }
+    void handle() { handles++; }
+
+    bool running = false;
+    uint32_t handles = 0;
+    String hostname;
+    std::function<void()> startFctn;
+    std::function<void()> endFctn;
+    std::function<void(unsigned int, unsigned int)> progressFctn;
+    std::function<void(ota_error_t)> errorFctn;
+};
+
+extern ArduinoOTAClass ArduinoOTA;
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+
+class WiFiClass
+{
+public:
+    int8_t RSSI()
+    {
+        rssiReads++;
+        return rssi;
+    }
+    uint8_t *macAddress(uint8_t *mac)
+    {
+        static const uint8_t address[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+        memcpy(mac, address, sizeof(address));
+        return mac;
+    }
+    IPAddress localIP() { return IPAddress(ip); }
+
+    // The tests switch the address to run several devices in one process
+    uint32_t ip = IPAddress(192, 168, 1, 10);
+    int8_t rssi = -60;
+    // Counted, a test may check when the radio is asked
+    uint32_t rssiReads = 0;
+};
+
+extern WiFiClass WiFi;
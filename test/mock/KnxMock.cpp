@@ -0,0 +1,453 @@
+#include "KnxMock.h"
+
+#include <chrono>
+#include <random>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+EspClass ESP;
+WiFiClass WiFi;
+ArduinoOTAClass ArduinoOTA;
+UpdateClass Update;
+fs::FS LittleFS;
+
+static const std::chrono::steady_clock::time_point clockStart = std::chrono::steady_clock::now();
+static unsigned long clockOffset = 0;
+static std::mt19937 randomEngine;
+
+static unsigned long clockMicros()
+{
+    auto elapsed = std::chrono::steady_clock::now() - clockStart;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + clockOffset;
+}
+
+unsigned long millis()
+{
+    return clockMicros() / 1000;
+}
+
+unsigned long micros()
+{
+    return clockMicros();
+}
+
+void knxMockAdvance(unsigned long ms)
+{
+    clockOffset += ms * 1000;
+}
+
+void delay(unsigned long ms)
+{
+    knxMockAdvance(ms);
+}
+
+void yield()
+{
+    knxMockAdvance(1);
+}
+
+long random(long max)
+{
+    return max > 0 ? randomEngine() % max : 0;
+}
+
+long random(long min, long max)
+{
+    return min < max ? min + random(max - min) : min;
+}
+
+// glibc lets a program replace malloc, its own allocations then go through it as well
+static knxMockHeapStats_t heapStats;
+static int uncounted = 0;
+
+KnxMockUncounted::KnxMockUncounted()
+{
+    uncounted++;
+}
+
+KnxMockUncounted::~KnxMockUncounted()
+{
+    uncounted--;
+}
+
+KnxMockCounted::KnxMockCounted() : saved(uncounted)
+{
+    uncounted = 0;
+}
+
+KnxMockCounted::~KnxMockCounted()
+{
+    uncounted = saved;
+}
+
+#if defined(__GLIBC__)
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *memory, size_t size);
+    void __libc_free(void *memory);
+}
+
+// Blocks of the mock, a hash set with linear probing that needs no allocation itself
+#define MOCK_BLOCKS 16384
+
+static void *mockBlocks[MOCK_BLOCKS];
+
+static size_t blockSlot(void *memory)
+{
+    return ((uintptr_t)memory >> 4) % MOCK_BLOCKS;
+}
+
+static bool addMockBlock(void *memory)
+{
+    size_t slot = blockSlot(memory);
+    for (size_t probe = 0; probe < MOCK_BLOCKS; probe++, slot = (slot + 1) % MOCK_BLOCKS)
+    {
+        if (mockBlocks[slot] == nullptr)
+        {
+            mockBlocks[slot] = memory;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool removeMockBlock(void *memory)
+{
+    size_t slot = blockSlot(memory);
+    while (mockBlocks[slot] != memory)
+    {
+        if (mockBlocks[slot] == nullptr)
+        {
+            return false;
+        }
+        slot = (slot + 1) % MOCK_BLOCKS;
+    }
+    // Moves back the entries that probed past the freed slot
+    size_t hole = slot;
+    for (size_t next = (slot + 1) % MOCK_BLOCKS; mockBlocks[next] != nullptr; next = (next + 1) % MOCK_BLOCKS)
+    {
+        size_t home = blockSlot(mockBlocks[next]);
+        if ((next - home + MOCK_BLOCKS) % MOCK_BLOCKS >= (next - hole + MOCK_BLOCKS) % MOCK_BLOCKS)
+        {
+            mockBlocks[hole] = mockBlocks[next];
+            hole = next;
+        }
+    }
+    mockBlocks[hole] = nullptr;
+    return true;
+}
+
+static void countAllocation(void *memory)
+{
+    if (memory == nullptr || (uncounted > 0 && addMockBlock(memory)))
+    {
+        return;
+    }
+    heapStats.allocations++;
+    heapStats.used += malloc_usable_size(memory);
+    heapStats.peak = max(heapStats.peak, heapStats.used);
+}
+
+static void countFree(void *memory)
+{
+    if (memory == nullptr || removeMockBlock(memory))
+    {
+        return;
+    }
+    heapStats.frees++;
+    // Memory from memalign and the like was never counted
+    heapStats.used -= min(heapStats.used, malloc_usable_size(memory));
+}
+
+extern "C" void *malloc(size_t size)
+{
+    void *memory = __libc_malloc(size);
+    countAllocation(memory);
+    return memory;
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    void *memory = __libc_calloc(count, size);
+    countAllocation(memory);
+    return memory;
+}
+
+extern "C" void *realloc(void *memory, size_t size)
+{
+    if (memory == nullptr)
+    {
+        return malloc(size);
+    }
+    countFree(memory);
+    void *moved = __libc_realloc(memory, size);
+    // A failed realloc keeps the block
+    countAllocation(moved != nullptr || size == 0 ? moved : memory);
+    return moved;
+}
+
+extern "C" void free(void *memory)
+{
+    countFree(memory);
+    __libc_free(memory);
+}
+#endif
+
+// What the C++ runtime allocated before the tests is not part of the device heap
+static const size_t heapBaseline = heapStats.used;
+
+knxMockHeapStats_t knxMockHeap()
+{
+    return heapStats;
+}
+
+void knxMockResetPeak()
+{
+    heapStats.peak = heapStats.used;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    size_t used = heapStats.used > heapBaseline ? heapStats.used - heapBaseline : 0;
+    return used < KNX_MOCK_HEAP_SIZE ? KNX_MOCK_HEAP_SIZE - used : 0;
+}
+
+bool UpdateClass::begin(size_t imageSize)
+{
+    begins++;
+    if (running)
+    {
+        error = "Already running";
+        return false;
+    }
+    image.clear();
+    size = imageSize;
+    running = true;
+    activated = false;
+    md5Set = false;
+    error = "";
+    return true;
+}
+
+size_t UpdateClass::write(uint8_t *data, size_t length)
+{
+    if (!running || error[0] != 0)
+    {
+        return 0;
+    }
+    if (image.size() + length > min(size, failAt))
+    {
+        error = image.size() + length > size ? "Not enough space" : "Flash write failed";
+        return 0;
+    }
+    KnxMockUncounted uncounted;
+    image.append((const char *)data, length);
+    return length;
+}
+
+bool UpdateClass::end(bool evenIfRemaining)
+{
+    if (!running)
+    {
+        error = "Not running";
+        return false;
+    }
+    running = false;
+    if (error[0] != 0)
+    {
+        return false;
+    }
+    if (!evenIfRemaining && image.size() != size)
+    {
+        error = "Not finished";
+        return false;
+    }
+    if (md5Set)
+    {
+        error = "MD5 check failed";
+        return false;
+    }
+    activated = true;
+    return true;
+}
+
+bool UpdateClass::setMD5(const char *expectedMD5)
+{
+    md5Set = strlen(expectedMD5) == 32;
+    return md5Set;
+}
+
+fs::File fs::FS::open(const char *path, const char *mode)
+{
+    KnxMockUncounted uncounted;
+    bool exists = files.count(path) > 0;
+    if (mode[0] == 'r' && !exists)
+    {
+        return File();
+    }
+    std::shared_ptr<std::string> data = std::make_shared<std::string>();
+    if (mode[0] != 'w' && exists)
+    {
+        *data = files[path];
+    }
+    return File(path, data, mode[0] != 'r');
+}
+
+bool fs::FS::rename(const char *from, const char *to)
+{
+    if (files.count(from) == 0)
+    {
+        return false;
+    }
+    KnxMockUncounted uncounted;
+    files[to] = files[from];
+    files.erase(from);
+    return true;
+}
+
+size_t fs::File::read(uint8_t *buffer, size_t length)
+{
+    if (data == nullptr || position >= data->size())
+    {
+        return 0;
+    }
+    length = min(length, data->size() - position);
+    memcpy(buffer, data->data() + position, length);
+    position += length;
+    return length;
+}
+
+size_t fs::File::write(const uint8_t *buffer, size_t length)
+{
+    if (data == nullptr || !writing || LittleFS.bytesWritten + length > LittleFS.capacity)
+    {
+        return 0;
+    }
+    KnxMockUncounted uncounted;
+    data->append((const char *)buffer, length);
+    LittleFS.bytesWritten += length;
+    return length;
+}
+
+bool fs::File::seek(uint32_t offset)
+{
+    if (data == nullptr || offset > data->size())
+    {
+        return false;
+    }
+    position = offset;
+    return true;
+}
+
+void fs::File::close()
+{
+    KnxMockUncounted uncounted;
+    if (data != nullptr && writing)
+    {
+        LittleFS.files[path] = *data;
+        LittleFS.commits++;
+    }
+    data = nullptr;
+}
+
+static WiFiUDP *sockets = nullptr;
+static uint16_t nextEphemeralPort = 49152;
+
+WiFiUDP::WiFiUDP()
+{
+    next = sockets;
+    sockets = this;
+}
+
+WiFiUDP::~WiFiUDP()
+{
+    for (WiFiUDP **socket = &sockets; *socket != nullptr; socket = &(*socket)->next)
+    {
+        if (*socket == this)
+        {
+            *socket = next;
+            break;
+        }
+    }
+}
+
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+    localIP = WiFi.ip;
+    localPort = port;
+    group = 0;
+    return 1;
+}
+
+uint8_t WiFiUDP::beginMulticast(IPAddress interfaceAddr, IPAddress multicast, uint16_t port)
+{
+    localIP = interfaceAddr;
+    localPort = port;
+    group = multicast;
+    return 1;
+}
+
+void WiFiUDP::stop()
+{
+    localPort = 0;
+    group = 0;
+    received.clear();
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port)
+{
+    KnxMockUncounted uncounted;
+    sending = {ip, port, std::string(), 0};
+    return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t *data, size_t length)
+{
+    KnxMockUncounted uncounted;
+    sending.data.append((const char *)data, length);
+    return length;
+}
+
+int WiFiUDP::endPacket()
+{
+    KnxMockUncounted uncounted;
+    if (localPort == 0)
+    {
+        localIP = WiFi.ip;
+        localPort = nextEphemeralPort++;
+    }
+    for (WiFiUDP *socket = sockets; socket != nullptr; socket = socket->next)
+    {
+        bool addressed = sending.ip == socket->group || sending.ip == socket->localIP;
+        if (socket != this && socket->localPort == sending.port && addressed)
+        {
+            socket->received.push_back({localIP, localPort, sending.data, 0});
+        }
+    }
+    return 1;
+}
+
+int WiFiUDP::parsePacket()
+{
+    KnxMockUncounted uncounted;
+    if (received.empty())
+    {
+        current = {};
+        return 0;
+    }
+    current = received.front();
+    received.pop_front();
+    return current.data.size();
+}
+
+int WiFiUDP::read(uint8_t *data, size_t length)
+{
+    length = min(length, current.data.size() - current.read);
+    memcpy(data, current.data.data() + current.read, length);
+    current.read += length;
+    return length;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Controls of the native test build, see platformio.ini [env:native]
+
+#include <Arduino.h>
+#include <ArduinoOTA.h>
+#include <ESP8266WiFi.h>
+#include <LittleFS.h>
+#include <Updater.h>
+#include <WiFiUdp.h>
+#include "KnxMockHttp.h"
+
+// Free heap reported with nothing allocated, about what an ESP8266 sketch has left
+#define KNX_MOCK_HEAP_SIZE (48 * 1024)
+
+typedef struct __knxMockHeapStats
+{
+    uint64_t allocations;
+    uint64_t frees;
+    // Bytes allocated now and at most since knxMockResetPeak()
+    size_t used;
+    size_t peak;
+} knxMockHeapStats_t;
+
+// millis() and micros() follow the host clock, this moves them forward. delay() advances
+// them without sleeping and yield() by 1 ms, so waits in the code under test end right away.
+void knxMockAdvance(unsigned long ms);
+
+// Allocations through malloc and new, only counted with glibc. The data of the mock, like
+// the responses, the image in Update and the files, is left out and does not use the
+// heap ESP.getFreeHeap() reports.
+knxMockHeapStats_t knxMockHeap();
+void knxMockResetPeak();
+
+// Allocations while one exists belong to the mock
+class KnxMockUncounted
+{
+public:
+    KnxMockUncounted();
+    ~KnxMockUncounted();
+};
+
+// Counts allocations again inside a KnxMockUncounted scope, for the code under test
+class KnxMockCounted
+{
+public:
+    KnxMockCounted();
+    ~KnxMockCounted();
+
+private:
+    int saved;
+};
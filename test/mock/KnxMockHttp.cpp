@@ -0,0 +1,438 @@
+#include "KnxMock.h"
+#include "esp-knx-webserver.h"
+
+#include <strings.h>
+
+static std::string base64(const std::string &text)
+{
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    for (size_t i = 0; i < text.size(); i += 3)
+    {
+        uint32_t group = (uint8_t)text[i] << 16;
+        if (i + 1 < text.size())
+            group |= (uint8_t)text[i + 1] << 8;
+        if (i + 2 < text.size())
+            group |= (uint8_t)text[i + 2];
+        encoded += digits[group >> 18 & 0x3F];
+        encoded += digits[group >> 12 & 0x3F];
+        encoded += i + 1 < text.size() ? digits[group >> 6 & 0x3F] : '=';
+        encoded += i + 2 < text.size() ? digits[group & 0x3F] : '=';
+    }
+    return encoded;
+}
+
+static const std::string *findHeader(const knxMockHeaders_t &headers, const char *name)
+{
+    for (const auto &header : headers)
+    {
+        if (strcasecmp(header.first.c_str(), name) == 0)
+        {
+            return &header.second;
+        }
+    }
+    return nullptr;
+}
+
+static int hexDigit(char c)
+{
+    return c >= '0' && c <= '9' ? c - '0' : (c | 0x20) >= 'a' && (c | 0x20) <= 'f' ? (c | 0x20) - 'a' + 10 : -1;
+}
+
+static std::string urlDecode(const std::string &text)
+{
+    std::string decoded;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        if (text[i] == '%' && i + 2 < text.size() && hexDigit(text[i + 1]) >= 0 && hexDigit(text[i + 2]) >= 0)
+        {
+            decoded += (char)(hexDigit(text[i + 1]) << 4 | hexDigit(text[i + 2]));
+            i += 2;
+        }
+        else
+        {
+            decoded += text[i] == '+' ? ' ' : text[i];
+        }
+    }
+    return decoded;
+}
+
+static bool findArg(const std::string &query, const char *name, std::string &value)
+{
+    size_t start = 0;
+    while (start < query.size())
+    {
+        size_t end = query.find('&', start);
+        if (end == std::string::npos)
+        {
+            end = query.size();
+        }
+        std::string pair = query.substr(start, end - start);
+        size_t equals = pair.find('=');
+        if (urlDecode(pair.substr(0, equals)) == name)
+        {
+            value = equals != std::string::npos ? urlDecode(pair.substr(equals + 1)) : "";
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+std::string KnxMockResponse::header(const char *name) const
+{
+    const std::string *value = findHeader(headers, name);
+    return value != nullptr ? *value : "";
+}
+
+void KnxMockHttp::setCredentials(const char *username, const char *password)
+{
+    authorization = username[0] != 0 ? "Basic " + base64(std::string(username) + ":" + password) : "";
+}
+
+KnxMockHttp &KnxMockHttp::header(const char *name, const char *value)
+{
+    nextHeaders.emplace_back(name, value);
+    return *this;
+}
+
+KnxMockResponse KnxMockHttp::get(const std::string &uri)
+{
+    return request(KNXWEB_HTTP_GET, uri, "");
+}
+
+KnxMockResponse KnxMockHttp::post(const std::string &uri, const std::string &body)
+{
+    return request(KNXWEB_HTTP_POST, uri, body);
+}
+
+KnxMockResponse KnxMockHttp::upload(const std::string &uri, const std::string &filename, const std::string &data,
+                                    size_t partSize, size_t abortAfter)
+{
+    KnxMockUncounted uncounted;
+    KnxMockRequest request;
+    request.method = KNXWEB_HTTP_POST;
+    size_t query = uri.find('?');
+    request.path = uri.substr(0, query);
+    request.query = query != std::string::npos ? uri.substr(query + 1) : "";
+    request.body = data;
+    request.upload = true;
+    request.filename = filename;
+    request.partSize = partSize;
+    request.abortAfter = abortAfter;
+    return send(request);
+}
+
+KnxMockResponse KnxMockHttp::request(uint8_t method, const std::string &uri, const std::string &body)
+{
+    KnxMockUncounted uncounted;
+    KnxMockRequest request;
+    request.method = method;
+    size_t query = uri.find('?');
+    request.path = uri.substr(0, query);
+    request.query = query != std::string::npos ? uri.substr(query + 1) : "";
+    request.body = body;
+    return send(request);
+}
+
+KnxMockResponse KnxMockHttp::send(KnxMockRequest &request)
+{
+    KnxMockUncounted uncounted;
+    request.headers.insert(request.headers.end(), nextHeaders.begin(), nextHeaders.end());
+    nextHeaders.clear();
+    if (!authorization.empty() && findHeader(request.headers, "Authorization") == nullptr)
+    {
+        request.headers.emplace_back("Authorization", authorization);
+    }
+    setClient(request);
+    request.inFlight = max(request.inFlight, inFlight);
+    KnxMockResponse response;
+    transport.serve(request, response);
+    return response;
+}
+
+bool KnxMockHttp::sendUpload(KnxMockRequest &request, KnxMockResponse &response)
+{
+    KnxMockUncounted uncounted;
+    setClient(request);
+    return transport.serve(request, response);
+}
+
+void KnxMockHttp::setClient(KnxMockRequest &request)
+{
+    if (request.remoteIP == 0)
+    {
+        request.remoteIP = remoteIP;
+    }
+    if (request.remotePort == 0)
+    {
+        request.remotePort = remotePort != 0 ? remotePort : nextPort;
+        // Ephemeral ports, each request gets another one
+        nextPort = nextPort == 65535 ? 49152 : nextPort + 1;
+    }
+}
+
+std::string KnxMockHttp::takeEvents()
+{
+    return transport.takeEvents();
+}
+
+// KnxWebTransport of the native build. Each request is served like the synchronous server
+// does: the upload handler gets the file in parts, then the route handler runs.
+
+void KnxWebTransport::begin(KnxWebserver *webserver, KnxArena *arena, uint16_t port)
+{
+    this->webserver = webserver;
+    this->arena = arena;
+}
+
+void KnxWebTransport::loop()
+{
+    // Requests are served by serve()
+}
+
+bool KnxWebTransport::serve(const KnxMockRequest &request, KnxMockResponse &response)
+{
+    bool resumed = &request == uploadRequest;
+    this->request = &request;
+    this->response = &response;
+    // An upload waiting for held data is still in flight
+    requestsInFlight = request.inFlight + (uploadRequest != nullptr && !resumed ? 1 : 0);
+    if (requestsInFlight > maxRequestsInFlight)
+    {
+        maxRequestsInFlight = requestsInFlight;
+    }
+    if (!resumed && !countConnection(request.remoteIP, request.remotePort))
+    {
+        // Like the core with keepAlive(false)
+        response.closeConnection = true;
+    }
+    String uri(request.path);
+    // The synchronous server keeps a copy of the file name as well
+    currentUpload.filename = request.filename.c_str();
+    KnxMockCounted counted;
+    uint64_t allocations = knxMockHeap().allocations;
+    const KnxWebserver::Route *route = webserver->findRoute(request.method, uri);
+    bool aborted = false;
+    bool waiting = false;
+    if (request.upload && route != nullptr && route->uploadHandler != nullptr)
+    {
+        if (!resumed)
+        {
+            currentUpload.status = KNXWEB_UPLOAD_START;
+            currentUpload.data = nullptr;
+            currentUpload.length = 0;
+            currentUpload.totalSize = 0;
+            webserver->dispatchUpload(uri);
+            uploadOffset = 0;
+            uploadParts = 0;
+            heldBytes = 0;
+        }
+        for (; uploadOffset < request.body.size() && !aborted; uploadOffset += request.partSize, uploadParts++)
+        {
+            if (heldBytes >= request.window)
+            {
+                waiting = true;
+                break;
+            }
+            aborted = uploadParts == request.abortAfter;
+            if (!aborted)
+            {
+                currentUpload.status = KNXWEB_UPLOAD_WRITE;
+                currentUpload.data = (const uint8_t *)request.body.data() + uploadOffset;
+                currentUpload.length = min(request.partSize, request.body.size() - uploadOffset);
+                currentUpload.totalSize = uploadOffset + currentUpload.length;
+                webserver->dispatchUpload(uri);
+            }
+        }
+        if (!waiting)
+        {
+            // The whole file arrived, held data needs no more flow control
+            heldBytes = 0;
+            currentUpload.status = aborted ? KNXWEB_UPLOAD_ABORTED : KNXWEB_UPLOAD_END;
+            currentUpload.data = nullptr;
+            currentUpload.length = 0;
+            webserver->dispatchUpload(uri);
+        }
+    }
+    if (!aborted && !waiting)
+    {
+        if (route != nullptr || webserver->findStaticAsset(request.method, uri) != nullptr)
+        {
+            webserver->dispatch(request.method, uri);
+        }
+        else
+        {
+            webserver->handleNotFound();
+        }
+    }
+    response.allocations += knxMockHeap().allocations - allocations;
+    if (request.upload)
+    {
+        uploadRequest = waiting ? &request : nullptr;
+    }
+    requestsInFlight = 0;
+    this->request = nullptr;
+    this->response = nullptr;
+    return !waiting;
+}
+
+std::string KnxWebTransport::takeEvents()
+{
+    std::string text;
+    text.swap(events);
+    return text;
+}
+
+// Request data is copied like the synchronous server does, the arena use is the same
+const char *KnxWebTransport::copyToArena(const std::string &text)
+{
+    char *copy = arena->copy(text.c_str(), text.size());
+    return copy != nullptr ? copy : "";
+}
+
+const char *KnxWebTransport::header(const char *name)
+{
+    const std::string *value = findHeader(request->headers, name);
+    return value != nullptr ? copyToArena(*value) : "";
+}
+
+bool KnxWebTransport::hasArg(const char *name)
+{
+    std::string value;
+    return findArg(request->query, name, value);
+}
+
+const char *KnxWebTransport::arg(const char *name)
+{
+    std::string value;
+    return findArg(request->query, name, value) ? copyToArena(value) : "";
+}
+
+bool KnxWebTransport::authenticate(const char *username, const char *password)
+{
+    KnxMockUncounted uncounted;
+    const std::string *value = findHeader(request->headers, "Authorization");
+    return value != nullptr && *value == "Basic " + base64(std::string(username) + ":" + password);
+}
+
+uint32_t KnxWebTransport::remoteIP()
+{
+    return request->remoteIP;
+}
+
+const char *KnxWebTransport::body(size_t &length)
+{
+    if (request->upload || request->body.size() >= sizeof(bodyBuffer))
+    {
+        length = 0;
+        return request->upload ? "" : nullptr;
+    }
+    memcpy(bodyBuffer, request->body.c_str(), request->body.size() + 1);
+    length = request->body.size();
+    return bodyBuffer;
+}
+
+void KnxWebTransport::sendHeader(const char *name, const char *value)
+{
+    KnxMockUncounted uncounted;
+    response->headers.emplace_back(name, value);
+}
+
+void KnxWebTransport::send(int code, const char *contentType, const char *content)
+{
+    KnxMockUncounted uncounted;
+    bytesSent += strlen(content);
+    response->code = code;
+    response->contentType = contentType != nullptr ? contentType : "";
+    response->body = content;
+}
+
+void KnxWebTransport::send_P(int code, const char *contentType, PGM_P content, size_t length)
+{
+    KnxMockUncounted uncounted;
+    bytesSent += length;
+    response->code = code;
+    response->contentType = contentType;
+    response->body.assign(content, length);
+}
+
+void KnxWebTransport::requestAuthentication()
+{
+    sendHeader("WWW-Authenticate", "Basic realm=\"Login Required\"");
+    send(401);
+}
+
+void KnxWebTransport::beginChunked(int code, const char *contentType)
+{
+    KnxMockUncounted uncounted;
+    response->code = code;
+    response->contentType = contentType;
+    response->chunked = true;
+}
+
+void KnxWebTransport::sendChunk(const char *data, size_t length)
+{
+    KnxMockUncounted uncounted;
+    bytesSent += length;
+    response->body.append(data, length);
+}
+
+void KnxWebTransport::endChunked()
+{
+}
+
+void KnxWebTransport::beginResponse(int code, const char *contentType, size_t length)
+{
+    KnxMockUncounted uncounted;
+    response->code = code;
+    response->contentType = contentType;
+    response->contentLength = length;
+}
+
+void KnxWebTransport::endResponse()
+{
+}
+
+void KnxWebTransport::closeConnection()
+{
+    response->closeConnection = true;
+}
+
+// Counts the part as unacknowledged, the client sends at most request.window bytes ahead
+void KnxWebTransport::holdUpload()
+{
+    heldBytes += currentUpload.length;
+}
+
+void KnxWebTransport::releaseUpload(size_t length)
+{
+    heldBytes -= min(heldBytes, length);
+}
+
+void KnxWebTransport::beginEventStream()
+{
+    KnxMockUncounted uncounted;
+    eventStreams++;
+    response->code = 200;
+    response->contentType = "text/event-stream";
+    response->eventStream = true;
+}
+
+size_t KnxWebTransport::eventClientCount()
+{
+    return eventStreams;
+}
+
+void KnxWebTransport::sendEvent(const char *event, const char *data)
+{
+    char text[192];
+    int length = snprintf(text, sizeof(text), "event: %s\ndata: %s\n\n", event, data);
+    if (length < 0 || length >= (int)sizeof(text))
+    {
+        return;
+    }
+    bytesSent += length;
+    KnxMockUncounted uncounted;
+    events.append(text, length);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+class KnxWebTransport;
+
+typedef std::vector<std::pair<std::string, std::string>> knxMockHeaders_t;
+
+// Request of the mock client as KnxWebTransport::serve() takes it
+struct KnxMockRequest
+{
+    // KNXWEB_HTTP_GET or KNXWEB_HTTP_POST
+    uint8_t method = 0;
+    std::string path;
+    std::string query;
+    knxMockHeaders_t headers;
+    std::string body;
+    uint32_t remoteIP = 0;
+    // Port of the client connection, requests from the same address and port share a kept
+    // connection like on the synchronous server. 0 takes the port of KnxMockHttp.
+    uint16_t remotePort = 0;
+    // Requests in flight while this one is served, counting itself, like several
+    // connections of the async server
+    uint8_t inFlight = 1;
+    // Multipart upload of body as file, passed to the upload handler in parts
+    bool upload = false;
+    std::string filename;
+    size_t partSize = 1460;
+    // The client goes away after so many parts, the upload is aborted without a response
+    size_t abortAfter = SIZE_MAX;
+    // Bytes the client sends ahead of the ones the webserver held with holdUpload(), like
+    // the TCP window on the async server
+    size_t window = SIZE_MAX;
+};
+
+struct KnxMockResponse
+{
+    // 0 when nothing was sent
+    int code = 0;
+    std::string contentType;
+    knxMockHeaders_t headers;
+    std::string body;
+    // Length announced before the body, SIZE_MAX for chunked and plain responses
+    size_t contentLength = SIZE_MAX;
+    bool chunked = false;
+    bool closeConnection = false;
+    bool eventStream = false;
+    // Heap allocations of the webserver while it handled the request
+    uint64_t allocations = 0;
+
+    // Empty when missing
+    std::string header(const char *name) const;
+};
+
+// HTTP client of the native tests. The requests go straight to the KnxWebTransport of a
+// KnxWebserver, the handlers run before the call returns.
+class KnxMockHttp
+{
+public:
+    explicit KnxMockHttp(KnxWebTransport &transport) : transport(transport) {}
+
+    // Used for all following requests, an empty username sends no Authorization
+    void setCredentials(const char *username, const char *password);
+    void setRemoteIP(uint32_t ip) { remoteIP = ip; }
+    // Following requests share one kept connection from port, 0 opens a new one for each
+    void setRemotePort(uint16_t port) { remotePort = port; }
+    void setInFlight(uint8_t count) { inFlight = count; }
+    // Added to the next request only
+    KnxMockHttp &header(const char *name, const char *value);
+
+    KnxMockResponse get(const std::string &uri);
+    KnxMockResponse post(const std::string &uri, const std::string &body = "");
+    KnxMockResponse upload(const std::string &uri, const std::string &filename, const std::string &data,
+                           size_t partSize = 1460, size_t abortAfter = SIZE_MAX);
+    KnxMockResponse send(KnxMockRequest &request);
+    // Starts or continues an upload with a window. Returns false when the client waits for
+    // held data, loop() releases it and other requests may be sent meanwhile. request and
+    // response stay in use until it returned true.
+    bool sendUpload(KnxMockRequest &request, KnxMockResponse &response);
+
+    // Text written to the event streams since the last call
+    std::string takeEvents();
+
+private:
+    KnxWebTransport &transport;
+    std::string authorization;
+    uint32_t remoteIP = IPAddress(192, 168, 1, 100);
+    uint16_t remotePort = 0;
+    uint16_t nextPort = 49152;
+    uint8_t inFlight = 1;
+    knxMockHeaders_t nextHeaders;
+
+    KnxMockResponse request(uint8_t method, const std::string &uri, const std::string &body);
+    void setClient(KnxMockRequest &request);
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <string>
+
+// File system in RAM. Data written to a file shows in it with close(), like LittleFS
+// commits appended data. The counters tell how often the flash would be written.
+namespace fs
+{
+class File
+{
+public:
+    File() {}
+    File(const std::string &path, std::shared_ptr<std::string> data, bool writing) : path(path), data(data), writing(writing) {}
+
+    size_t read(uint8_t *buffer, size_t length);
+    size_t write(const uint8_t *buffer, size_t length);
+    size_t size() { return data != nullptr ? data->size() : 0; }
+    bool seek(uint32_t position);
+    void close();
+    operator bool() const { return data != nullptr; }
+
+private:
+    std::string path;
+    std::shared_ptr<std::string> data;
+    bool writing = false;
+    size_t position = 0;
+};
+
+class FS
+{
+public:
+    bool begin() { return mountable; }
+    File open(const char *path, const char *mode = "r");
+    bool exists(const char *path) { return files.count(path) > 0; }
+    bool remove(const char *path) { return files.erase(path) > 0; }
+    bool rename(const char *from, const char *to);
+
+    std::map<std::string, std::string> files;
+    bool mountable = true;
+    // Bytes committed and files closed after writing
+    size_t bytesWritten = 0;
+    uint32_t commits = 0;
+    // Writes fail once that many bytes were written
+    size_t capacity = SIZE_MAX;
+};
+}
+
+using fs::File;
+
+extern fs::FS LittleFS;
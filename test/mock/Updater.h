@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+#include <string>
+
+// Flash updater with the behaviour of the ESP8266 core: end() activates the image unless
+// it is incomplete or an expected MD5 was set. The mock does not hash, an MD5 never matches.
+class UpdateClass
+{
+public:
+    bool begin(size_t size);
+    size_t write(uint8_t *data, size_t length);
+    bool end(bool evenIfRemaining = false);
+    bool setMD5(const char *expectedMD5);
+    bool isRunning() { return running; }
+    bool isFinished() { return image.size() == size; }
+    String getErrorString() { return error; }
+
+    // Written image, also after a failed end()
+    std::string image;
+    size_t size = 0;
+    bool running = false;
+    // An image end() accepted, the device would boot it next
+    bool activated = false;
+    // write() fails once the image would grow beyond it
+    size_t failAt = SIZE_MAX;
+    const char *error = "";
+    uint32_t begins = 0;
+
+private:
+    bool md5Set = false;
+};
+
+extern UpdateClass Update;
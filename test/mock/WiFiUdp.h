@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include <string>
+
+// UDP over an in-process network. A datagram goes to every socket bound to its port with
+// the destination as multicast group or local address, the sender gets no copy.
+class WiFiUDP
+{
+public:
+    WiFiUDP();
+    ~WiFiUDP();
+
+    uint8_t begin(uint16_t port);
+    uint8_t beginMulticast(IPAddress interfaceAddr, IPAddress multicast, uint16_t port);
+    void stop();
+
+    int beginPacket(IPAddress ip, uint16_t port);
+    size_t write(const uint8_t *data, size_t length);
+    int endPacket();
+
+    int parsePacket();
+    int read(uint8_t *data, size_t length);
+    IPAddress remoteIP() { return IPAddress(current.ip); }
+    uint16_t remotePort() { return current.port; }
+
+    // Address the socket sends from, WiFi.localIP() when it was bound
+    uint32_t localIP = 0;
+    uint16_t localPort = 0;
+    uint32_t group = 0;
+
+private:
+    struct Datagram
+    {
+        uint32_t ip;
+        uint16_t port;
+        std::string data;
+        size_t read;
+    };
+
+    std::deque<Datagram> received;
+    Datagram current = {};
+    Datagram sending = {};
+    WiFiUDP *next = nullptr;
+};
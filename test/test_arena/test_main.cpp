@@ -0,0 +1,134 @@
+// Soak of the request arena: millions of allocations and a million requests with a Cookie
+// header larger than the arena. The heap must end where it started and not grow in between.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#define SOAK_ROUNDS 5000000
+#define SOAK_REQUESTS 1000000
+#define SOAK_COOKIE_SIZE 1200
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+// Bytes the host heap got from the system, grows when freed blocks can't be reused
+static size_t hostHeapSize()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    return mallinfo2().arena;
+#else
+    return 0;
+#endif
+}
+
+static unsigned long profileValue(const std::string &profile, const char *name)
+{
+    std::string key = std::string("\"") + name + "\":";
+    size_t position = profile.find(key);
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(profile.c_str() + position + key.size(), nullptr, 10);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_arena_rounds()
+{
+    KnxArena arena;
+    knxMockHeapStats_t before = knxMockHeap();
+    knxMockResetPeak();
+    size_t largest = 0;
+    for (uint32_t round = 0; round < SOAK_ROUNDS; round++)
+    {
+        // Mostly small copies like headers, now and then one that does not fit
+        uint32_t count = 1 + random(8);
+        size_t total = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            size_t size = random(16) == 0 ? 256 + random(1024) : 1 + random(96);
+            uint8_t *memory = (uint8_t *)arena.allocate(size);
+            TEST_ASSERT_NOT_NULL(memory);
+            memset(memory, 0xA5, size);
+            total += (size + 3) & ~(size_t)3;
+        }
+        largest = max(largest, total);
+        arena.reset();
+    }
+    knxMockHeapStats_t after = knxMockHeap();
+
+    TEST_ASSERT_EQUAL_size_t(before.used, after.used);
+    TEST_ASSERT_EQUAL(after.allocations - before.allocations, after.frees - before.frees);
+    TEST_ASSERT_EQUAL_UINT32(arena.getOverflows(), (uint32_t)(after.allocations - before.allocations));
+    TEST_ASSERT_GREATER_THAN(0, arena.getOverflows());
+    TEST_ASSERT_EQUAL_UINT32(0, arena.getFailures());
+    TEST_ASSERT_LESS_OR_EQUAL(arena.getSize(), arena.getHighWater());
+    // At most one round of overflows is on the heap at a time
+    TEST_ASSERT_LESS_OR_EQUAL(largest + 8 * 64, after.peak - before.used);
+}
+
+void test_requests_with_large_cookie()
+{
+    http.setCredentials("admin", "secret");
+    std::string padding = "; prefs=" + std::string(SOAK_COOKIE_SIZE, 'x');
+    std::string cookie;
+    const char *paths[] = {"/", "/api/status", "/soak-not-found"};
+    const int codes[] = {200, 200, 404};
+
+    size_t heapSize = 0;
+    knxMockHeapStats_t before = {};
+    for (uint32_t i = 0; i < SOAK_REQUESTS; i++)
+    {
+        // Within the rate limit, the session expires now and then and is created again
+        knxMockAdvance(250);
+        if (i == SOAK_REQUESTS / 10)
+        {
+            before = knxMockHeap();
+            knxMockResetPeak();
+            heapSize = hostHeapSize();
+        }
+        std::string cookies = cookie + padding;
+        KnxMockResponse response = http.header("Cookie", cookies.c_str()).get(paths[i % 3]);
+        TEST_ASSERT_EQUAL_INT(codes[i % 3], response.code);
+        std::string setCookie = response.header("Set-Cookie");
+        if (!setCookie.empty())
+        {
+            cookie = setCookie.substr(0, setCookie.find(';'));
+        }
+        webserver.loop();
+    }
+    knxMockHeapStats_t after = knxMockHeap();
+
+    TEST_ASSERT_EQUAL_size_t(before.used, after.used);
+    TEST_ASSERT_EQUAL(after.allocations - before.allocations, after.frees - before.frees);
+    // A request holds a copy or two of the header, none stays behind
+    TEST_ASSERT_LESS_OR_EQUAL(3 * SOAK_COOKIE_SIZE, after.peak - before.used);
+    TEST_ASSERT_EQUAL_size_t(heapSize, hostHeapSize());
+
+    std::string profile = http.header("Cookie", cookie.c_str()).get("/api/profile").body;
+    // Each request of a route that needs the login copied the Cookie header to the heap
+    TEST_ASSERT_GREATER_OR_EQUAL(SOAK_REQUESTS / 3 * 2, profileValue(profile, "arenaOverflows"));
+    TEST_ASSERT_EQUAL_UINT32(0, profileValue(profile, "arenaFailures"));
+    TEST_ASSERT_LESS_OR_EQUAL(profileValue(profile, "arenaSize"), profileValue(profile, "arenaHighWater"));
+}
+
+int main()
+{
+    webserver.startWeb("admin", "secret");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_arena_rounds);
+    RUN_TEST(test_requests_with_large_cookie);
+    return UNITY_END();
+}
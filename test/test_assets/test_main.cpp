@@ -0,0 +1,134 @@
+// Embedded files: every asset from the sorted table with its own ETag per representation,
+// 304 for a matching If-None-Match and the gzip variant for clients that accept it.
+// Requests are a second apart so the rate limiter lets them through.
+
+#include <KnxMock.h>
+#include <esp-knx-webassets.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <set>
+#include <string>
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+struct Asset
+{
+    const char *path;
+    const char *contentType;
+    const char *cacheControl;
+    std::string data;
+    std::string gzipData;
+};
+
+static const Asset assets[] = {
+    {"/", "text/html", "no-cache", std::string(ROOT_HTML, ROOT_HTML_LEN), std::string(ROOT_HTML_GZ, ROOT_HTML_GZ_LEN)},
+    {"/favicon.ico", "image/png", "max-age=604800", std::string(FAVICON, FAVICON_LEN), std::string(FAVICON_GZ, FAVICON_GZ_LEN)},
+    {"/webupdate", "text/html", "no-cache", std::string(UPDATE_HTML, UPDATE_HTML_LEN), std::string(UPDATE_HTML_GZ, UPDATE_HTML_GZ_LEN)},
+};
+
+static KnxMockResponse get(const char *path, const char *acceptEncoding, const std::string &etag = "")
+{
+    knxMockAdvance(1000);
+    if (acceptEncoding != nullptr)
+    {
+        http.header("Accept-Encoding", acceptEncoding);
+    }
+    if (!etag.empty())
+    {
+        http.header("If-None-Match", etag.c_str());
+    }
+    return http.get(path);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_plain()
+{
+    std::set<std::string> etags;
+    for (const Asset &asset : assets)
+    {
+        KnxMockResponse response = get(asset.path, nullptr);
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_EQUAL_STRING(asset.contentType, response.contentType.c_str());
+        TEST_ASSERT_TRUE(response.body == asset.data);
+        TEST_ASSERT_EQUAL_STRING("", response.header("Content-Encoding").c_str());
+        TEST_ASSERT_EQUAL_STRING(asset.cacheControl, response.header("Cache-Control").c_str());
+        TEST_ASSERT_EQUAL_STRING("Accept-Encoding", response.header("Vary").c_str());
+        // Strong ETag of the content hash
+        std::string etag = response.header("ETag");
+        TEST_ASSERT_EQUAL_size_t(10, etag.size());
+        TEST_ASSERT_TRUE(etag.front() == '"' && etag.back() == '"');
+        etags.insert(etag);
+    }
+    TEST_ASSERT_EQUAL_size_t(sizeof(assets) / sizeof(assets[0]), etags.size());
+}
+
+void test_gzip()
+{
+    for (const Asset &asset : assets)
+    {
+        KnxMockResponse plain = get(asset.path, nullptr);
+        KnxMockResponse response = get(asset.path, "gzip, deflate, br");
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_EQUAL_STRING(asset.contentType, response.contentType.c_str());
+        TEST_ASSERT_EQUAL_STRING("gzip", response.header("Content-Encoding").c_str());
+        TEST_ASSERT_TRUE(response.body == asset.gzipData);
+        std::string etag = plain.header("ETag");
+        TEST_ASSERT_EQUAL_STRING((etag.substr(0, etag.size() - 1) + "-gz\"").c_str(), response.header("ETag").c_str());
+    }
+}
+
+// A matching ETag costs only the headers, the one of the other representation does not match
+void test_not_modified()
+{
+    for (const Asset &asset : assets)
+    {
+        std::string etag = get(asset.path, nullptr).header("ETag");
+        KnxMockResponse response = get(asset.path, nullptr, etag);
+        TEST_ASSERT_EQUAL_INT(304, response.code);
+        TEST_ASSERT_EQUAL_STRING("", response.body.c_str());
+        TEST_ASSERT_EQUAL_STRING(etag.c_str(), response.header("ETag").c_str());
+        TEST_ASSERT_EQUAL_STRING(asset.cacheControl, response.header("Cache-Control").c_str());
+
+        std::string gzipEtag = get(asset.path, "gzip").header("ETag");
+        response = get(asset.path, "gzip", gzipEtag);
+        TEST_ASSERT_EQUAL_INT(304, response.code);
+        TEST_ASSERT_EQUAL_STRING("", response.body.c_str());
+
+        TEST_ASSERT_EQUAL_INT(200, get(asset.path, "gzip", etag).code);
+        TEST_ASSERT_EQUAL_INT(200, get(asset.path, nullptr, gzipEtag).code);
+        TEST_ASSERT_EQUAL_INT(200, get(asset.path, nullptr, "\"00000000\"").code);
+    }
+}
+
+// Paths next to the assets in the sorted tables are not taken for one of them
+void test_lookup()
+{
+    TEST_ASSERT_EQUAL_INT(404, get("/favicon", nullptr).code);
+    TEST_ASSERT_EQUAL_INT(404, get("/favicon.icon", nullptr).code);
+    TEST_ASSERT_EQUAL_INT(404, get("/webupdat", nullptr).code);
+    TEST_ASSERT_EQUAL_INT(404, get("/zzz", nullptr).code);
+    TEST_ASSERT_EQUAL_INT(200, get("/api/status", nullptr).code);
+    knxMockAdvance(1000);
+    TEST_ASSERT_EQUAL_INT(404, http.post("/", "").code);
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_plain);
+    RUN_TEST(test_gzip);
+    RUN_TEST(test_not_modified);
+    RUN_TEST(test_lookup);
+    return UNITY_END();
+}
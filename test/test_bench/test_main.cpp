@@ -0,0 +1,199 @@
+// Latency and memory benchmark of the routes on the host. Prints one JSON document like
+// tools/knx_bench.py does for a device. The latencies depend on the host and are only
+// reported, the allocation figures are the same on every run and are checked.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define BENCH_REQUESTS 2000
+#define BENCH_UPLOADS 100
+#define BENCH_IMAGE_SIZE (64 * 1024)
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+std::string results;
+
+static knxModeOptions_t knxMode = KNX_MODE_NORMAL;
+
+static void setKnxMode(knxModeOptions_t mode)
+{
+    knxMode = mode;
+}
+
+static knxModeOptions_t getKnxMode()
+{
+    return knxMode;
+}
+
+struct BenchResult
+{
+    uint32_t requests;
+    double p50Us;
+    double p99Us;
+    double maxUs;
+    double allocationsPerRequest;
+    size_t peakHeap;
+    size_t leaked;
+    size_t bytesPerRequest;
+};
+
+// Durations are in nanoseconds, the result in microseconds
+static double percentile(std::vector<uint64_t> values, uint32_t percent)
+{
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (values.size() * percent + 99) / 100 - 1)] / 1000.0;
+}
+
+// Header lines as the handler set them, the server adds its own few
+static size_t wireSize(const KnxMockResponse &response)
+{
+    size_t size = strlen("HTTP/1.1 200 OK\r\n\r\n") + response.body.size();
+    for (const auto &header : response.headers)
+    {
+        size += header.first.size() + 2 + header.second.size() + 2;
+    }
+    return size;
+}
+
+// Runs request count times, one loop() call after each like a sketch would do
+template <typename Request>
+static BenchResult bench(const char *path, int expectedCode, uint32_t count, Request request)
+{
+    // The first request allocates what stays for the lifetime, like the session
+    request();
+    webserver.loop();
+    std::vector<uint64_t> durations;
+    durations.reserve(count);
+    knxMockHeapStats_t before = knxMockHeap();
+    knxMockResetPeak();
+    uint64_t allocations = 0;
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // The rate limiter refills, every request is admitted
+        knxMockAdvance(1000);
+        auto start = std::chrono::steady_clock::now();
+        KnxMockResponse response = request();
+        auto end = std::chrono::steady_clock::now();
+        allocations += response.allocations;
+        TEST_ASSERT_EQUAL_INT(expectedCode, response.code);
+        durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        bytes += wireSize(response);
+        webserver.loop();
+    }
+    knxMockHeapStats_t after = knxMockHeap();
+
+    BenchResult result;
+    result.requests = count;
+    result.p50Us = percentile(durations, 50);
+    result.p99Us = percentile(durations, 99);
+    result.maxUs = *std::max_element(durations.begin(), durations.end()) / 1000.0;
+    result.allocationsPerRequest = (double)allocations / count;
+    result.peakHeap = after.peak - before.used;
+    result.leaked = after.used > before.used ? after.used - before.used : 0;
+    result.bytesPerRequest = bytes / count;
+
+    char json[320];
+    snprintf(json, sizeof(json),
+             "%s{\"path\":\"%s\",\"requests\":%u,\"p50Us\":%.2f,\"p99Us\":%.2f,\"maxUs\":%.2f,\"allocationsPerRequest\":%.2f,"
+             "\"peakHeap\":%zu,\"leaked\":%zu,\"bytesPerRequest\":%zu}",
+             results.empty() ? "" : ",\n    ", path, result.requests, result.p50Us, result.p99Us, result.maxUs,
+             result.allocationsPerRequest, result.peakHeap, result.leaked, result.bytesPerRequest);
+    results += json;
+    return result;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// Requests are served from the arena, nothing may stay on the heap afterwards
+static void assertLean(const BenchResult &result)
+{
+    TEST_ASSERT_EQUAL_size_t(0, result.leaked);
+    TEST_ASSERT_TRUE(result.allocationsPerRequest == 0);
+}
+
+void test_root()
+{
+    BenchResult result = bench("/", 200, BENCH_REQUESTS, []()
+                               { return http.header("Accept-Encoding", "gzip, deflate").get("/"); });
+    assertLean(result);
+}
+
+void test_root_not_modified()
+{
+    std::string etag = http.header("Accept-Encoding", "gzip").get("/").header("ETag");
+    BenchResult result = bench("/ (304)", 304, BENCH_REQUESTS, [&etag]()
+                               { return http.header("Accept-Encoding", "gzip").header("If-None-Match", etag.c_str()).get("/"); });
+    assertLean(result);
+}
+
+void test_favicon()
+{
+    BenchResult result = bench("/favicon.ico", 200, BENCH_REQUESTS, []()
+                               { return http.get("/favicon.ico"); });
+    assertLean(result);
+}
+
+void test_progmode()
+{
+    BenchResult result = bench("/progmode", 204, BENCH_REQUESTS, []()
+                               { return http.post("/progmode"); });
+    assertLean(result);
+    TEST_ASSERT_EQUAL(KNX_MODE_PROG, knxMode);
+}
+
+void test_api_status()
+{
+    BenchResult result = bench("/api/status", 200, BENCH_REQUESTS, []()
+                               { return http.get("/api/status"); });
+    assertLean(result);
+}
+
+void test_not_found()
+{
+    BenchResult result = bench("/bench-not-found", 404, BENCH_REQUESTS, []()
+                               { return http.get("/bench-not-found"); });
+    assertLean(result);
+}
+
+void test_upload()
+{
+    // Raw image of the announced size, every upload is accepted and asks for a restart
+    std::string image(BENCH_IMAGE_SIZE, '\xA5');
+    std::string uri = "/upload?size=" + std::to_string(image.size());
+    BenchResult result = bench("/upload", 307, BENCH_UPLOADS, [&image, &uri]()
+                               { return http.upload(uri, "bench.bin", image); });
+    assertLean(result);
+    TEST_ASSERT_TRUE(Update.activated);
+    TEST_ASSERT_TRUE(Update.image == image);
+}
+
+int main()
+{
+    webserver.registerSetKnxModeCallback(setKnxMode);
+    webserver.registerGetKnxModeCallback(getKnxMode);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_root);
+    RUN_TEST(test_root_not_modified);
+    RUN_TEST(test_favicon);
+    RUN_TEST(test_progmode);
+    RUN_TEST(test_api_status);
+    RUN_TEST(test_not_found);
+    RUN_TEST(test_upload);
+    printf("{\"host\": \"native\", \"routes\": [\n    %s\n]}\n", results.c_str());
+    return UNITY_END();
+}
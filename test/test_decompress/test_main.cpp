@@ -0,0 +1,316 @@
+// heatshrink compressed firmware uploads. The test compresses its image with a small LZSS
+// encoder that writes the bit format of heatshrink -w 11 -l 4, sends it to /upload as a
+// .hs file and compares what reached the mock Update. Prints the upload throughput in
+// the format of test_bench.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define IMAGE_SIZE (96 * 1024)
+#define BENCH_UPLOADS 20
+
+#define WINDOW_SIZE (1 << KNXWEB_HEATSHRINK_WINDOW)
+#define LOOKAHEAD_SIZE (1 << KNXWEB_HEATSHRINK_LOOKAHEAD)
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+std::string image;
+std::string compressed;
+std::string results;
+
+class BitWriter
+{
+public:
+    std::string data;
+
+    void write(uint32_t value, uint8_t count)
+    {
+        while (count-- > 0)
+        {
+            current = current << 1 | ((value >> count) & 1);
+            if (++used == 8)
+            {
+                data += (char)current;
+                current = 0;
+                used = 0;
+            }
+        }
+    }
+
+    // The encoder pads the last byte with zero bits
+    std::string finish()
+    {
+        if (used > 0)
+        {
+            data += (char)(current << (8 - used));
+        }
+        return data;
+    }
+
+private:
+    uint8_t current = 0;
+    uint8_t used = 0;
+};
+
+// Greedy LZSS: a back reference is tag 0, distance - 1 and length - 1, a literal tag 1 and the byte
+static std::string heatshrink(const std::string &input)
+{
+    BitWriter out;
+    size_t i = 0;
+    while (i < input.size())
+    {
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        for (size_t distance = 1; distance <= WINDOW_SIZE && distance <= i; distance++)
+        {
+            size_t length = 0;
+            while (length < LOOKAHEAD_SIZE && i + length < input.size() && input[i + length] == input[i - distance + length])
+            {
+                length++;
+            }
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestDistance = distance;
+            }
+            if (bestLength == LOOKAHEAD_SIZE)
+            {
+                break;
+            }
+        }
+        // Two literals take 18 bits, a reference 16
+        if (bestLength >= 2)
+        {
+            out.write(0, 1);
+            out.write(bestDistance - 1, KNXWEB_HEATSHRINK_WINDOW);
+            out.write(bestLength - 1, KNXWEB_HEATSHRINK_LOOKAHEAD);
+            i += bestLength;
+        }
+        else
+        {
+            out.write(1, 1);
+            out.write((uint8_t)input[i], 8);
+            i++;
+        }
+    }
+    return out.finish();
+}
+
+static bool collect(void *context, const uint8_t *data, size_t length)
+{
+    ((std::string *)context)->append((const char *)data, length);
+    return true;
+}
+
+static std::string sha256Hex(const std::string &data)
+{
+    KnxSha256 hash;
+    uint8_t digest[KNXWEB_SHA256_SIZE];
+    hash.begin();
+    hash.update((const uint8_t *)data.data(), data.size());
+    hash.finish(digest);
+    char hex[2 * KNXWEB_SHA256_SIZE + 1];
+    for (size_t i = 0; i < KNXWEB_SHA256_SIZE; i++)
+    {
+        snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+    }
+    return hex;
+}
+
+static KnxMockResponse upload(const std::string &filename, const std::string &data, size_t partSize = 1460)
+{
+    knxMockAdvance(1000);
+    return http.upload("/upload?size=" + std::to_string(data.size()), filename, data, partSize);
+}
+
+void setUp()
+{
+    Update.failAt = SIZE_MAX;
+    Update.activated = false;
+}
+
+void tearDown()
+{
+    webserver.loop();
+}
+
+// Every split of a stream that holds literals, short and long references
+void test_decoder_splits()
+{
+    std::string input = "KNX KNX KNX-IP\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00 web web web";
+    input += image.substr(0, 3000);
+    std::string stream = heatshrink(input);
+    KnxHeatshrinkDecoder decoder;
+    for (size_t split = 0; split <= stream.size(); split++)
+    {
+        std::string output;
+        TEST_ASSERT_TRUE(decoder.begin(collect, &output));
+        TEST_ASSERT_TRUE(decoder.decode((const uint8_t *)stream.data(), split));
+        TEST_ASSERT_TRUE(decoder.decode((const uint8_t *)stream.data() + split, stream.size() - split));
+        decoder.end();
+        TEST_ASSERT_TRUE(output == input);
+    }
+}
+
+// Back references into the zeroed window before the data, like the heatshrink encoder
+// emits for an image that starts with zeros
+void test_decoder_initial_window()
+{
+    BitWriter out;
+    out.write(0, 1);
+    out.write(WINDOW_SIZE - 1, KNXWEB_HEATSHRINK_WINDOW);
+    out.write(LOOKAHEAD_SIZE - 1, KNXWEB_HEATSHRINK_LOOKAHEAD);
+    out.write(1, 1);
+    out.write('A', 8);
+    std::string stream = out.finish();
+    std::string output;
+    KnxHeatshrinkDecoder decoder;
+    TEST_ASSERT_TRUE(decoder.begin(collect, &output));
+    TEST_ASSERT_TRUE(decoder.decode((const uint8_t *)stream.data(), stream.size()));
+    decoder.end();
+    TEST_ASSERT_TRUE(output == std::string(LOOKAHEAD_SIZE, '\0') + "A");
+}
+
+// A part boundary falls inside every field when the parts are one byte long
+void test_upload_round_trip()
+{
+    for (size_t partSize : {(size_t)1, (size_t)7, (size_t)1460, (size_t)4096})
+    {
+        setUp();
+        knxMockHeapStats_t before = knxMockHeap();
+        KnxMockResponse response = upload("firmware.bin.hs", compressed, partSize);
+        TEST_ASSERT_EQUAL_INT(307, response.code);
+        TEST_ASSERT_TRUE(Update.activated);
+        TEST_ASSERT_TRUE(Update.image == image);
+        // The window of the decoder was given back
+        TEST_ASSERT_EQUAL_size_t(before.used, knxMockHeap().used);
+    }
+    std::string state = http.get("/upload/status").body;
+    TEST_ASSERT_TRUE(state.find(("\"received\":" + std::to_string(compressed.size())).c_str()) != std::string::npos);
+}
+
+// heatshrink has no check of its own, a damaged stream decodes to a damaged image. The
+// resumable upload catches it with the digest of the file that was sent.
+void test_corrupt_stream()
+{
+    std::string damaged = compressed;
+    damaged[damaged.size() / 2] ^= 0x5A;
+    knxMockHeapStats_t before = knxMockHeap();
+    knxMockAdvance(1000);
+    KnxMockResponse response = http.post("/upload/begin?size=" + std::to_string(damaged.size()) + "&sha256=" +
+                                          sha256Hex(compressed) + "&name=firmware.bin.hs");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    knxMockAdvance(1000);
+    TEST_ASSERT_EQUAL_INT(200, http.upload("/upload/chunk?offset=0", "blob", damaged, 1460).code);
+    knxMockAdvance(1000);
+    response = http.post("/upload/end");
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_TRUE(response.body.find("\"error\":\"SHA-256 mismatch\"") != std::string::npos);
+    TEST_ASSERT_FALSE(Update.activated);
+    TEST_ASSERT_FALSE(Update.image == image);
+    TEST_ASSERT_EQUAL_size_t(before.used, knxMockHeap().used);
+}
+
+// References that repeat the same bytes over and over grow beyond the flash, Update stops it
+void test_expanding_stream()
+{
+    BitWriter out;
+    out.write(1, 1);
+    out.write(0xE9, 8);
+    for (size_t i = 0; i < 2 * 1024 * 1024 / LOOKAHEAD_SIZE; i++)
+    {
+        out.write(0, 1);
+        out.write(0, KNXWEB_HEATSHRINK_WINDOW);
+        out.write(LOOKAHEAD_SIZE - 1, KNXWEB_HEATSHRINK_LOOKAHEAD);
+    }
+    std::string bomb = out.finish();
+    knxMockHeapStats_t before = knxMockHeap();
+    KnxMockResponse response = upload("bomb.bin.hs", bomb);
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_EQUAL_STRING("Not enough space", response.body.c_str());
+    TEST_ASSERT_FALSE(Update.activated);
+    TEST_ASSERT_FALSE(Update.running);
+    TEST_ASSERT_EQUAL_size_t(before.used, knxMockHeap().used);
+}
+
+static void bench(const char *format, const std::string &filename, const std::string &data)
+{
+    std::vector<uint64_t> durations;
+    for (uint32_t i = 0; i < BENCH_UPLOADS; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        KnxMockResponse response = upload(filename, data);
+        auto end = std::chrono::steady_clock::now();
+        TEST_ASSERT_EQUAL_INT(307, response.code);
+        TEST_ASSERT_TRUE(Update.image == image);
+        durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        webserver.loop();
+    }
+    std::sort(durations.begin(), durations.end());
+    double p50Us = durations[durations.size() / 2] / 1000.0;
+    double p99Us = durations[std::min(durations.size() - 1, (durations.size() * 99 + 99) / 100 - 1)] / 1000.0;
+    char json[256];
+    snprintf(json, sizeof(json),
+             "%s{\"format\":\"%s\",\"uploads\":%u,\"uploaded\":%zu,\"image\":%zu,\"p50Us\":%.2f,\"p99Us\":%.2f,"
+             "\"imageMBps\":%.1f}",
+             results.empty() ? "" : ",\n    ", format, BENCH_UPLOADS, data.size(), image.size(), p50Us, p99Us,
+             image.size() / p50Us);
+    results += json;
+}
+
+void test_throughput()
+{
+    bench("raw", "firmware.bin", image);
+    bench("heatshrink", "firmware.bin.hs", compressed);
+}
+
+int main()
+{
+    // Code like sections: repeated instruction patterns, zero padding and some noise
+    uint32_t seed = 1;
+    while (image.size() < IMAGE_SIZE)
+    {
+        seed = seed * 1103515245 + 12345;
+        switch (seed >> 29)
+        {
+        case 0:
+            image.append(64 + (seed >> 8) % 200, '\0');
+            break;
+        case 1:
+        case 2:
+        case 3:
+            if (image.size() > WINDOW_SIZE)
+            {
+                image += image.substr(image.size() - 1 - (seed >> 8) % WINDOW_SIZE, 4 + (seed >> 4) % 40);
+                break;
+            }
+        default:
+            for (int i = 0; i < 24; i++)
+            {
+                seed = seed * 1103515245 + 12345;
+                image += (char)(seed >> 16);
+            }
+            break;
+        }
+    }
+    image.resize(IMAGE_SIZE);
+    image[0] = (char)0xE9;
+    compressed = heatshrink(image);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_decoder_splits);
+    RUN_TEST(test_decoder_initial_window);
+    RUN_TEST(test_corrupt_stream);
+    RUN_TEST(test_expanding_stream);
+    RUN_TEST(test_upload_round_trip);
+    RUN_TEST(test_throughput);
+    printf("{\"host\": \"native\", \"uploads\": [\n    %s\n]}\n", results.c_str());
+    return UNITY_END();
+}
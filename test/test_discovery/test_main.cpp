@@ -0,0 +1,252 @@
+// Discovery over the in-process network of the mock: a few devices answer the queries of a
+// collector like tools/knx_discover.py sends them
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#define DEVICES 3
+#define COLLECTOR_PORT 40000
+
+KnxWebserver devices[DEVICES];
+WiFiUDP collector;
+
+static const uint32_t collectorIP = IPAddress(192, 168, 1, 50);
+
+struct Reply
+{
+    uint32_t ip;
+    uint8_t flags;
+    uint8_t mode;
+    std::string physAddr;
+    std::string hostname;
+    std::string build;
+};
+
+static knxModeOptions_t getKnxMode()
+{
+    return KNX_MODE_NORMAL;
+}
+
+static uint32_t deviceIP(int device)
+{
+    return IPAddress(192, 168, 1, 11 + device);
+}
+
+// Every device runs its loop with its own address, like on its own board
+static void loopDevices()
+{
+    for (int i = 0; i < DEVICES; i++)
+    {
+        WiFi.ip = deviceIP(i);
+        devices[i].loop();
+    }
+    WiFi.ip = collectorIP;
+}
+
+static void sendQuery(WiFiUDP &socket, uint32_t target, uint16_t spread, uint8_t version = KNXWEB_DISCOVERY_VERSION)
+{
+    uint8_t query[7] = {'K', 'N', 'X', 'Q', version, (uint8_t)spread, (uint8_t)(spread >> 8)};
+    socket.beginPacket(IPAddress(target), KNXWEB_DISCOVERY_PORT);
+    socket.write(query, sizeof(query));
+    socket.endPacket();
+}
+
+// Parses like parse_reply() of tools/knx_discover.py
+static std::vector<Reply> receive(WiFiUDP &socket)
+{
+    std::vector<Reply> replies;
+    int length;
+    while ((length = socket.parsePacket()) > 0)
+    {
+        uint8_t data[KNXWEB_DISCOVERY_SIZE];
+        TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_DISCOVERY_SIZE, length);
+        TEST_ASSERT_EQUAL_INT(length, socket.read(data, sizeof(data)));
+        TEST_ASSERT_GREATER_OR_EQUAL(19, length);
+        TEST_ASSERT_EQUAL_MEMORY("KNXR", data, 4);
+        TEST_ASSERT_EQUAL_UINT8(KNXWEB_DISCOVERY_VERSION, data[4]);
+        Reply reply;
+        reply.ip = socket.remoteIP();
+        reply.flags = data[5];
+        reply.mode = data[6];
+        uint16_t phys = data[8] | data[9] << 8;
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u", phys >> 12, (phys >> 8) & 0x0F, phys & 0xFF);
+        reply.physAddr = text;
+        int offset = 18;
+        TEST_ASSERT_LESS_OR_EQUAL(length, offset + 1 + data[offset]);
+        reply.hostname.assign((const char *)data + offset + 1, data[offset]);
+        offset += 1 + data[offset];
+        TEST_ASSERT_LESS_THAN(length, offset);
+        TEST_ASSERT_EQUAL_INT(length, offset + 1 + data[offset]);
+        reply.build.assign((const char *)data + offset + 1, data[offset]);
+        replies.push_back(reply);
+    }
+    return replies;
+}
+
+static unsigned long metric(KnxWebserver &device, const char *name)
+{
+    KnxMockHttp http(device.getTransport());
+    http.setCredentials("admin", "secret");
+    std::string metrics = http.get("/metrics").body;
+    size_t position = metrics.find(std::string("\n") + name + " ");
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(metrics.c_str() + position + strlen(name) + 2, nullptr, 10);
+}
+
+void setUp()
+{
+    // Replies still waiting from the test before are sent and dropped
+    knxMockAdvance(65536);
+    loopDevices();
+    receive(collector);
+}
+
+void tearDown()
+{
+}
+
+void test_every_device_replies()
+{
+    sendQuery(collector, KNXWEB_DISCOVERY_GROUP, 0);
+    loopDevices();
+    std::vector<Reply> replies = receive(collector);
+    TEST_ASSERT_EQUAL_size_t(DEVICES, replies.size());
+    for (int i = 0; i < DEVICES; i++)
+    {
+        const Reply &reply = replies[i];
+        TEST_ASSERT_EQUAL_UINT32(deviceIP(i), reply.ip);
+        TEST_ASSERT_EQUAL_STRING(("knx-" + std::to_string(i)).c_str(), reply.hostname.c_str());
+        TEST_ASSERT_EQUAL_STRING(("1.1." + std::to_string(i + 1)).c_str(), reply.physAddr.c_str());
+        TEST_ASSERT_EQUAL_UINT8(KNXWEB_DISCOVERY_CONFIG_OK, reply.flags & KNXWEB_DISCOVERY_CONFIG_OK);
+    }
+    // Device 0 has a mode callback and no login, device 2 requires a login
+    TEST_ASSERT_EQUAL_UINT8(KNX_MODE_NORMAL, replies[0].mode);
+    TEST_ASSERT_EQUAL_UINT8(0xFF, replies[1].mode);
+    TEST_ASSERT_EQUAL_STRING("build 1", replies[0].build.c_str());
+    TEST_ASSERT_EQUAL_UINT8(KNXWEB_DISCOVERY_AUTH, replies[2].flags & KNXWEB_DISCOVERY_AUTH);
+    TEST_ASSERT_EQUAL_STRING("", replies[2].build.c_str());
+}
+
+void test_directed_query()
+{
+    sendQuery(collector, deviceIP(1), 0);
+    loopDevices();
+    std::vector<Reply> replies = receive(collector);
+    TEST_ASSERT_EQUAL_size_t(1, replies.size());
+    TEST_ASSERT_EQUAL_UINT32(deviceIP(1), replies[0].ip);
+}
+
+void test_replies_are_spread()
+{
+    sendQuery(collector, KNXWEB_DISCOVERY_GROUP, 1000);
+    size_t received = 0;
+    for (int step = 0; step <= 20; step++)
+    {
+        loopDevices();
+        received += receive(collector).size();
+        knxMockAdvance(50);
+    }
+    TEST_ASSERT_EQUAL_size_t(DEVICES, received);
+    // Nothing more after the delay
+    knxMockAdvance(1000);
+    loopDevices();
+    TEST_ASSERT_EQUAL_size_t(0, receive(collector).size());
+}
+
+void test_invalid_queries_are_ignored()
+{
+    sendQuery(collector, KNXWEB_DISCOVERY_GROUP, 0, KNXWEB_DISCOVERY_VERSION + 1);
+    collector.beginPacket(IPAddress(KNXWEB_DISCOVERY_GROUP), KNXWEB_DISCOVERY_PORT);
+    collector.write((const uint8_t *)"KNX", 3);
+    collector.endPacket();
+    loopDevices();
+    loopDevices();
+    TEST_ASSERT_EQUAL_size_t(0, receive(collector).size());
+}
+
+void test_repeated_query_keeps_its_place()
+{
+    unsigned long queries = metric(devices[2], "knxweb_discovery_queries_total");
+    sendQuery(collector, deviceIP(2), 60000);
+    sendQuery(collector, deviceIP(2), 60000);
+    loopDevices();
+    loopDevices();
+    knxMockAdvance(60000);
+    loopDevices();
+    loopDevices();
+    TEST_ASSERT_EQUAL_size_t(1, receive(collector).size());
+    TEST_ASSERT_EQUAL(queries + 1, metric(devices[2], "knxweb_discovery_queries_total"));
+}
+
+void test_full_queue_drops()
+{
+    // More queriers than the queue holds, each on its own port
+    WiFiUDP queriers[KNXWEB_DISCOVERY_QUEUE + 2];
+    unsigned long dropped = metric(devices[2], "knxweb_discovery_dropped_total");
+    for (size_t i = 0; i < KNXWEB_DISCOVERY_QUEUE + 2; i++)
+    {
+        queriers[i].begin(COLLECTOR_PORT + 1 + i);
+        sendQuery(queriers[i], deviceIP(2), 60000);
+        loopDevices();
+    }
+    TEST_ASSERT_EQUAL(dropped + 2, metric(devices[2], "knxweb_discovery_dropped_total"));
+    knxMockAdvance(60000);
+    size_t answered = 0;
+    for (size_t i = 0; i < KNXWEB_DISCOVERY_QUEUE + 2; i++)
+    {
+        loopDevices();
+    }
+    for (size_t i = 0; i < KNXWEB_DISCOVERY_QUEUE + 2; i++)
+    {
+        answered += receive(queriers[i]).size();
+    }
+    TEST_ASSERT_EQUAL_size_t(KNXWEB_DISCOVERY_QUEUE, answered);
+}
+
+void test_address_change_rebinds()
+{
+    sendQuery(collector, deviceIP(0), 60000);
+    loopDevices();
+    // The device gets a new address, the waiting reply to the old one is dropped
+    WiFi.ip = IPAddress(192, 168, 1, 99);
+    devices[0].loop();
+    sendQuery(collector, IPAddress(192, 168, 1, 99), 0);
+    devices[0].loop();
+    WiFi.ip = collectorIP;
+    knxMockAdvance(60000);
+    std::vector<Reply> replies = receive(collector);
+    TEST_ASSERT_EQUAL_size_t(1, replies.size());
+    TEST_ASSERT_EQUAL_UINT32(IPAddress(192, 168, 1, 99), replies[0].ip);
+    loopDevices();
+    TEST_ASSERT_EQUAL_size_t(0, receive(collector).size());
+}
+
+int main()
+{
+    for (int i = 0; i < DEVICES; i++)
+    {
+        devices[i].setHostname(("knx-" + std::to_string(i)).c_str());
+        devices[i].setBuildDetails(("build " + std::to_string(i + 1)).c_str());
+        devices[i].setKnxDetail(("1.1." + std::to_string(i + 1)).c_str(), true);
+        devices[i].startWeb(i == 2 ? "admin" : "", "secret");
+    }
+    devices[0].registerGetKnxModeCallback(getKnxMode);
+    WiFi.ip = collectorIP;
+    collector.begin(COLLECTOR_PORT);
+    loopDevices();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_every_device_replies);
+    RUN_TEST(test_directed_query);
+    RUN_TEST(test_replies_are_spread);
+    RUN_TEST(test_invalid_queries_are_ignored);
+    RUN_TEST(test_repeated_query_keeps_its_place);
+    RUN_TEST(test_full_queue_drops);
+    RUN_TEST(test_address_change_rebinds);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// Status events on /events: the first publish with every field, the deltas after it, the
+// heap and RSSI steps and the event stream framing. Each check moves the clock past the
+// sysinfo sample and the event interval and compares the text written to the stream.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+knxModeOptions_t knxMode = KNX_MODE_NORMAL;
+// Held by the sketch, moves the free heap the webserver samples. The strings of the test
+// are left out of it.
+void *blocks[2];
+
+static knxModeOptions_t getKnxMode()
+{
+    return knxMode;
+}
+
+static std::string frame(const std::string &data)
+{
+    return "event: status\ndata: " + data + "\n\n";
+}
+
+static std::string heapField()
+{
+    return "\"heap\":" + std::to_string(ESP.getFreeHeap());
+}
+
+// A new sample is taken first, the event interval has passed as well when it is published
+static std::string publish()
+{
+    knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+    webserver.loop();
+    knxMockAdvance(KNXWEB_EVENT_INTERVAL);
+    webserver.loop();
+    return http.takeEvents();
+}
+
+void setUp()
+{
+    // What changed between the tests, like the output buffer of the test runner, is sent
+    // before the test starts
+    KnxMockUncounted uncounted;
+    publish();
+}
+
+void tearDown()
+{
+}
+
+void test_first_publish()
+{
+    KnxMockUncounted uncounted;
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+    KnxMockResponse response = http.get("/events");
+    TEST_ASSERT_TRUE(response.eventStream);
+    TEST_ASSERT_EQUAL_STRING("text/event-stream", response.contentType.c_str());
+    std::string expected = frame("{\"mode\":\"normal\",\"configOk\":false,\"otaActive\":false,\"otaState\":\"off\","
+                                 "\"otaError\":\"\"," + heapField() + ",\"rssi\":-60}");
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), publish().c_str());
+    // Unchanged, nothing is sent
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+}
+
+void test_changed_fields()
+{
+    KnxMockUncounted uncounted;
+    knxMode = KNX_MODE_PROG;
+    TEST_ASSERT_EQUAL_STRING(frame("{\"mode\":\"prog\"}").c_str(), publish().c_str());
+    webserver.setKnxDetail("1.1.1", true);
+    knxMode = KNX_MODE_NORMAL;
+    TEST_ASSERT_EQUAL_STRING(frame("{\"mode\":\"normal\",\"configOk\":true}").c_str(), publish().c_str());
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+}
+
+// Steps below the threshold add up until their sum reaches it
+void test_rssi_step()
+{
+    KnxMockUncounted uncounted;
+    WiFi.rssi = -60 + KNXWEB_EVENT_RSSI_STEP - 1;
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+    WiFi.rssi = -60 + KNXWEB_EVENT_RSSI_STEP;
+    std::string expected = frame("{\"rssi\":" + std::to_string(-60 + KNXWEB_EVENT_RSSI_STEP) + "}");
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), publish().c_str());
+    WiFi.rssi = -60;
+    expected = frame("{\"rssi\":-60}");
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), publish().c_str());
+}
+
+void test_heap_step()
+{
+    KnxMockUncounted uncounted;
+    uint32_t published = ESP.getFreeHeap();
+    {
+        KnxMockCounted counted;
+        blocks[0] = malloc(KNXWEB_EVENT_HEAP_STEP / 2);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(KNXWEB_EVENT_HEAP_STEP, published - ESP.getFreeHeap());
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+    {
+        KnxMockCounted counted;
+        blocks[1] = malloc(KNXWEB_EVENT_HEAP_STEP / 2);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(KNXWEB_EVENT_HEAP_STEP, published - ESP.getFreeHeap());
+    TEST_ASSERT_EQUAL_STRING(frame("{" + heapField() + "}").c_str(), publish().c_str());
+    {
+        KnxMockCounted counted;
+        free(blocks[0]);
+        free(blocks[1]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(published, ESP.getFreeHeap());
+    TEST_ASSERT_EQUAL_STRING(frame("{" + heapField() + "}").c_str(), publish().c_str());
+}
+
+void test_ota_fields()
+{
+    KnxMockUncounted uncounted;
+    TEST_ASSERT_EQUAL_INT(200, http.post("/api/command", "{\"ota\":true}").code);
+    // OTA starts with the sample, the remaining time is sent once and the page counts down itself
+    std::string expected = frame("{\"otaActive\":true,\"otaRemaining\":" + std::to_string(KNXWEB_OTA_TIMEOUT) +
+                                 ",\"otaState\":\"waiting\",\"otaError\":\"\"}");
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), publish().c_str());
+    TEST_ASSERT_EQUAL_STRING("", publish().c_str());
+    TEST_ASSERT_EQUAL_INT(200, http.post("/api/command", "{\"ota\":false}").code);
+    TEST_ASSERT_EQUAL_STRING(frame("{\"otaActive\":false,\"otaState\":\"off\",\"otaError\":\"\"}").c_str(), publish().c_str());
+}
+
+// A stream opened later gets every field again
+void test_new_client()
+{
+    KnxMockUncounted uncounted;
+    http.get("/events");
+    std::string expected = frame("{\"mode\":\"normal\",\"configOk\":true,\"otaActive\":false,\"otaState\":\"off\","
+                                 "\"otaError\":\"\"," + heapField() + ",\"rssi\":-60}");
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), publish().c_str());
+}
+
+int main()
+{
+    webserver.registerGetKnxModeCallback(getKnxMode);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_first_publish);
+    RUN_TEST(test_changed_fields);
+    RUN_TEST(test_rssi_step);
+    RUN_TEST(test_heap_step);
+    RUN_TEST(test_ota_fields);
+    RUN_TEST(test_new_client);
+    return UNITY_END();
+}
@@ -0,0 +1,146 @@
+// Restart history on the flash emulator of the mock: batching, the two log files and the
+// records that survive a restart. A new KnxHistory on the same files is the next boot.
+
+#include <KnxMock.h>
+#include <esp-knx-history.h>
+#include <unity.h>
+
+#include <vector>
+
+#define FILE_RECORDS (KNXWEB_HISTORY_RECORDS / 2)
+
+static std::vector<knxHistoryRecord_t> records(KnxHistory &history)
+{
+    std::vector<knxHistoryRecord_t> all;
+    history.forEach([&all](const knxHistoryRecord_t &record)
+                    { all.push_back(record); });
+    return all;
+}
+
+void setUp()
+{
+    LittleFS.files.clear();
+    LittleFS.capacity = SIZE_MAX;
+}
+
+void tearDown()
+{
+}
+
+void test_boots_are_counted()
+{
+    for (uint16_t boot = 0; boot < 3; boot++)
+    {
+        KnxHistory history;
+        history.begin(6, 30000);
+        std::vector<knxHistoryRecord_t> all = records(history);
+        TEST_ASSERT_EQUAL_size_t(boot + 1, all.size());
+        TEST_ASSERT_EQUAL_UINT16(boot, all.back().boot);
+        TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_BOOT, all.back().type);
+        TEST_ASSERT_EQUAL_UINT8(6, all.back().reason);
+    }
+}
+
+void test_statistics_are_batched()
+{
+    KnxHistory history;
+    history.begin(0, 30000);
+    uint32_t commits = LittleFS.commits;
+    size_t bytes = LittleFS.bytesWritten;
+    for (int i = 1; i < KNXWEB_HISTORY_BATCH; i++)
+    {
+        knxMockAdvance(KNXWEB_HISTORY_INTERVAL * 1000UL);
+        history.noteLatency(100 * i);
+        history.loop(millis(), 30000 - i);
+    }
+    // Collected in RAM, visible all the same
+    TEST_ASSERT_EQUAL_UINT32(commits, LittleFS.commits);
+    std::vector<knxHistoryRecord_t> all = records(history);
+    TEST_ASSERT_EQUAL_size_t(KNXWEB_HISTORY_BATCH, all.size());
+    TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_STATS, all.back().type);
+    TEST_ASSERT_EQUAL_UINT32(100 * (KNXWEB_HISTORY_BATCH - 1), all.back().value);
+
+    knxMockAdvance(KNXWEB_HISTORY_INTERVAL * 1000UL);
+    history.loop(millis(), 29000);
+    TEST_ASSERT_EQUAL_UINT32(commits + 1, LittleFS.commits);
+    TEST_ASSERT_EQUAL_size_t(bytes + KNXWEB_HISTORY_BATCH * KNXWEB_HISTORY_RECORD_SIZE, LittleFS.bytesWritten);
+    // Peak latency starts over with each record
+    TEST_ASSERT_EQUAL_UINT32(0, records(history).back().value);
+}
+
+void test_restart_is_written_at_once()
+{
+    KnxHistory history;
+    history.begin(0, 30000);
+    knxMockAdvance(KNXWEB_HISTORY_INTERVAL * 1000UL);
+    history.loop(millis(), 30000);
+    uint32_t commits = LittleFS.commits;
+    history.add(KNX_HISTORY_RESTART, KNX_HISTORY_WEB, 28000, 1234);
+    TEST_ASSERT_EQUAL_UINT32(commits + 1, LittleFS.commits);
+
+    // The pending statistics record went with it and is read after the restart
+    KnxHistory next;
+    next.begin(0, 30000);
+    std::vector<knxHistoryRecord_t> all = records(next);
+    TEST_ASSERT_EQUAL_size_t(4, all.size());
+    TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_STATS, all[1].type);
+    TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_RESTART, all[2].type);
+    TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_WEB, all[2].reason);
+    TEST_ASSERT_EQUAL_UINT32(1234, all[2].value);
+    TEST_ASSERT_EQUAL_UINT16(1, all[3].boot);
+}
+
+void test_full_log_replaces_previous()
+{
+    KnxHistory history;
+    history.begin(0, 30000);
+    size_t bytes = LittleFS.bytesWritten;
+    const uint32_t added = 5 * KNXWEB_HISTORY_RECORDS;
+    for (uint32_t i = 1; i <= added; i++)
+    {
+        history.add(KNX_HISTORY_UPDATE, KNX_HISTORY_OTA, 30000, i);
+    }
+    std::vector<knxHistoryRecord_t> all = records(history);
+    TEST_ASSERT_GREATER_OR_EQUAL(FILE_RECORDS, all.size());
+    TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_HISTORY_RECORDS, all.size());
+    // The latest records, oldest first without gaps
+    for (size_t i = 0; i < all.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(added - all.size() + 1 + i, all[i].value);
+    }
+    TEST_ASSERT_TRUE(LittleFS.exists(KNXWEB_HISTORY_OLD_FILE));
+    TEST_ASSERT_LESS_OR_EQUAL(FILE_RECORDS * KNXWEB_HISTORY_RECORD_SIZE, LittleFS.files[KNXWEB_HISTORY_FILE].size());
+    // Every record is written once, nothing is copied when the files rotate
+    TEST_ASSERT_EQUAL_size_t(bytes + added * KNXWEB_HISTORY_RECORD_SIZE, LittleFS.bytesWritten);
+
+    KnxHistory next;
+    next.begin(0, 30000);
+    TEST_ASSERT_EQUAL_UINT16(1, records(next).back().boot);
+}
+
+void test_full_flash_keeps_latest_in_ram()
+{
+    KnxHistory history;
+    history.begin(0, 30000);
+    LittleFS.capacity = LittleFS.bytesWritten;
+    for (uint32_t i = 1; i <= 3 * KNXWEB_HISTORY_BATCH; i++)
+    {
+        history.add(KNX_HISTORY_UPDATE_FAILED, KNX_HISTORY_WEB, 30000, i);
+    }
+    std::vector<knxHistoryRecord_t> all = records(history);
+    TEST_ASSERT_EQUAL_size_t(1 + KNXWEB_HISTORY_BATCH, all.size());
+    TEST_ASSERT_EQUAL_UINT8(KNX_HISTORY_BOOT, all[0].type);
+    TEST_ASSERT_EQUAL_UINT32(2 * KNXWEB_HISTORY_BATCH + 1, all[1].value);
+    TEST_ASSERT_EQUAL_UINT32(3 * KNXWEB_HISTORY_BATCH, all.back().value);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_boots_are_counted);
+    RUN_TEST(test_statistics_are_batched);
+    RUN_TEST(test_restart_is_written_at_once);
+    RUN_TEST(test_full_log_replaces_previous);
+    RUN_TEST(test_full_flash_keeps_latest_in_ram);
+    return UNITY_END();
+}
@@ -0,0 +1,122 @@
+// Requests served while an upload is in flight, like on the async server. The display image
+// is sent with a window: the client stops while the webserver holds that much of it with
+// holdUpload() and goes on when loop() passed it to the display and released it.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+#define IMAGE_SIZE (48 * 1024)
+#define WINDOW (4 * 1024)
+#define PART_SIZE 1460
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+std::string image;
+std::string received;
+bool success = false;
+
+static bool sinkBegin(size_t size)
+{
+    return size == image.size();
+}
+
+// A slow display, it takes part of a piece per call
+static size_t sinkWrite(const uint8_t *data, size_t length)
+{
+    KnxMockUncounted uncounted;
+    size_t taken = min(length, (size_t)512);
+    received.append((const char *)data, taken);
+    return taken;
+}
+
+static void sinkEnd(bool ok)
+{
+    success = ok;
+}
+
+static unsigned long value(const std::string &body, const char *name)
+{
+    std::string key = std::string("\"") + name + "\":";
+    size_t position = body.find(key);
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(body.c_str() + position + key.size(), nullptr, 10);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_requests_during_held_upload()
+{
+    KnxMockRequest upload;
+    upload.method = KNXWEB_HTTP_POST;
+    upload.path = "/tftupload";
+    upload.query = "size=" + std::to_string(image.size());
+    upload.body = image;
+    upload.upload = true;
+    upload.filename = "display.tft";
+    upload.partSize = PART_SIZE;
+    upload.window = WINDOW;
+    KnxMockResponse response;
+
+    int rounds = 0;
+    while (!http.sendUpload(upload, response))
+    {
+        rounds++;
+        TEST_ASSERT_EQUAL_INT(0, response.code);
+        // Both requests are answered at once, the upload stays where it is
+        knxMockAdvance(200);
+        KnxMockResponse status = http.get("/api/status");
+        TEST_ASSERT_EQUAL_INT(200, status.code);
+        KnxMockResponse progress = http.get("/tftupload/status");
+        TEST_ASSERT_EQUAL_INT(200, progress.code);
+        TEST_ASSERT_TRUE(progress.body.find("\"state\":\"running\"") != std::string::npos);
+        unsigned long arrived = value(progress.body, "received");
+        TEST_ASSERT_TRUE(arrived < image.size());
+        // Nothing beyond the window reached the webserver before loop() passed it on
+        TEST_ASSERT_LESS_OR_EQUAL(WINDOW + PART_SIZE, arrived - received.size());
+
+        // The display gets the held data and the client may send again
+        for (int i = 0; i < 20; i++)
+        {
+            knxMockAdvance(1);
+            webserver.loop();
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(image.size() / (WINDOW + PART_SIZE) - 1, rounds);
+    TEST_ASSERT_TRUE(response.code == 200 || response.code == 202);
+    for (int i = 0; i < 1000 && received.size() < image.size(); i++)
+    {
+        knxMockAdvance(1);
+        webserver.loop();
+    }
+    webserver.loop();
+    TEST_ASSERT_TRUE(received == image);
+    TEST_ASSERT_TRUE(success);
+
+    // Each request saw the upload in flight besides itself
+    knxMockAdvance(200);
+    std::string profile = http.get("/api/profile").body;
+    TEST_ASSERT_EQUAL_UINT32(2, value(profile, "inFlightMax"));
+}
+
+int main()
+{
+    for (size_t i = 0; i < IMAGE_SIZE; i++)
+    {
+        image += (char)(i * 7 + (i >> 8));
+    }
+    webserver.registerTftUploadCallbacks(sinkBegin, sinkWrite, sinkEnd);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_requests_during_held_upload);
+    return UNITY_END();
+}
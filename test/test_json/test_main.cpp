@@ -0,0 +1,197 @@
+// KnxJsonReader and the commands of /api/command, plus the throughput of the reader
+
+#include <KnxMock.h>
+#include <esp-knx-json.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+
+#define JSON_BENCH_ROUNDS 20000
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+// Tokens of the whole text in one letter each, E for an error
+static std::string tokens(const char *text)
+{
+    static const char letters[] = ".E{}[]ks#tfn";
+    KnxJsonReader json(text, strlen(text));
+    std::string result;
+    knxJsonToken_t token;
+    do
+    {
+        token = json.next();
+        result += letters[token];
+    } while (token != KNXJSON_END && token != KNXJSON_ERROR);
+    return result;
+}
+
+static bool toInt(const char *number, int32_t &value)
+{
+    KnxJsonReader json(number, strlen(number));
+    TEST_ASSERT_EQUAL(KNXJSON_NUMBER, json.next());
+    return json.textToInt(value);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_valid_documents()
+{
+    TEST_ASSERT_EQUAL_STRING("{ksk[#tfn]k{}}.", tokens("{\"a\":\"b\",\"c\":[1,true,false,null],\"d\":{}}").c_str());
+    TEST_ASSERT_EQUAL_STRING("[].", tokens(" [ ] ").c_str());
+    TEST_ASSERT_EQUAL_STRING("#.", tokens("-0.5e+10").c_str());
+    TEST_ASSERT_EQUAL_STRING("s.", tokens("\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u00e4\"").c_str());
+    TEST_ASSERT_EQUAL_STRING("[[[[]]]].", tokens("[[[[]]]]").c_str());
+}
+
+void test_syntax_errors()
+{
+    const char *invalid[] = {
+        "", "{", "{\"a\"}", "{\"a\":}", "{\"a\":1,}", "[1,]", "[1 2]", "{a:1}", "\"open",
+        "\"tab\there\"", "\"\\x\"", "\"\\u12g4\"", "01", "-", "1.", "1e", "tru", "nul", "{} {}", "]",
+        "{\"a\":1]", "[1}",
+    };
+    for (const char *text : invalid)
+    {
+        std::string result = tokens(text);
+        TEST_ASSERT_EQUAL_MESSAGE('E', result.back(), text);
+    }
+}
+
+void test_error_is_final()
+{
+    KnxJsonReader json("[1,,2]", 6);
+    TEST_ASSERT_EQUAL(KNXJSON_ARRAY_BEGIN, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_NUMBER, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_ERROR, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_ERROR, json.next());
+    TEST_ASSERT_FALSE(json.skip());
+}
+
+void test_depth_limit()
+{
+    std::string deepest = std::string(KNXJSON_MAX_DEPTH, '[') + std::string(KNXJSON_MAX_DEPTH, ']');
+    TEST_ASSERT_EQUAL('.', tokens(deepest.c_str()).back());
+    std::string tooDeep = std::string(KNXJSON_MAX_DEPTH + 1, '[') + std::string(KNXJSON_MAX_DEPTH + 1, ']');
+    TEST_ASSERT_EQUAL('E', tokens(tooDeep.c_str()).back());
+}
+
+void test_text_and_skip()
+{
+    const char *text = "{\"skip\":{\"x\":[1,{\"y\":2}]},\"key\\n\":\"va\\\"lue\",\"last\":3}";
+    KnxJsonReader json(text, strlen(text));
+    TEST_ASSERT_EQUAL(KNXJSON_OBJECT_BEGIN, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_KEY, json.next());
+    TEST_ASSERT_TRUE(json.textEquals("skip"));
+    TEST_ASSERT_TRUE(json.skip());
+    TEST_ASSERT_EQUAL(KNXJSON_KEY, json.next());
+    // Escapes are left as they were sent
+    TEST_ASSERT_TRUE(json.textEquals("key\\n"));
+    TEST_ASSERT_EQUAL(KNXJSON_STRING, json.next());
+    TEST_ASSERT_EQUAL_size_t(7, json.textLength());
+    TEST_ASSERT_EQUAL(KNXJSON_KEY, json.next());
+    TEST_ASSERT_FALSE(json.textEquals("las"));
+    TEST_ASSERT_EQUAL(KNXJSON_NUMBER, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_OBJECT_END, json.next());
+    TEST_ASSERT_EQUAL(KNXJSON_END, json.next());
+}
+
+void test_int32_range()
+{
+    int32_t value = 0;
+    TEST_ASSERT_TRUE(toInt("2147483647", value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, value);
+    TEST_ASSERT_TRUE(toInt("-2147483648", value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, value);
+    TEST_ASSERT_TRUE(toInt("-0", value));
+    TEST_ASSERT_EQUAL_INT32(0, value);
+    // A fraction or exponent is cut off
+    TEST_ASSERT_TRUE(toInt("12.9", value));
+    TEST_ASSERT_EQUAL_INT32(12, value);
+    TEST_ASSERT_TRUE(toInt("3e5", value));
+    TEST_ASSERT_EQUAL_INT32(3, value);
+
+    value = 42;
+    TEST_ASSERT_FALSE(toInt("2147483648", value));
+    TEST_ASSERT_FALSE(toInt("-2147483649", value));
+    TEST_ASSERT_FALSE(toInt("4294967326", value));
+    TEST_ASSERT_FALSE(toInt("99999999999999999999", value));
+    TEST_ASSERT_EQUAL_INT32(42, value);
+}
+
+void test_commands()
+{
+    KnxMockResponse response = http.post("/api/command", "{\"otaTimeout\":600,\"ota\":false}");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"otaTimeout\":\"ok\",\"ota\":\"ok\"}", response.body.c_str());
+
+    // 2^32 + 30 would be a valid timeout after a wrap around
+    response = http.post("/api/command", "{\"ota\":true,\"otaTimeout\":4294967326}");
+    TEST_ASSERT_EQUAL_INT(400, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"ota\":\"skipped\",\"otaTimeout\":\"invalid\"}", response.body.c_str());
+
+    response = http.post("/api/command", "{\"restart\":true,\"x\":[1,{\"y\":2}]}");
+    TEST_ASSERT_EQUAL_INT(400, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"restart\":\"skipped\",\"x\":\"unknown\"}", response.body.c_str());
+    TEST_ASSERT_EQUAL_UINT32(0, ESP.restarts);
+
+    response = http.post("/api/command", "{\"ota\":true");
+    TEST_ASSERT_EQUAL_INT(400, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"error\":\"invalid JSON\"}", response.body.c_str());
+}
+
+void test_throughput()
+{
+    // A batch of commands with the nesting and escapes a client could send
+    std::string text = "{";
+    for (int i = 0; text.size() < 2000; i++)
+    {
+        text += "\"key" + std::to_string(i) + "\":[" + std::to_string(i * 7919) + ",-12.5e3,true,null,\"a\\\"b\\u00e4\"],";
+    }
+    text += "\"end\":{}}";
+
+    uint64_t allocations = knxMockHeap().allocations;
+    uint32_t tokenCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < JSON_BENCH_ROUNDS; round++)
+    {
+        KnxJsonReader json(text.data(), text.size());
+        knxJsonToken_t token;
+        while ((token = json.next()) != KNXJSON_END)
+        {
+            TEST_ASSERT_TRUE(token != KNXJSON_ERROR);
+            tokenCount++;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    TEST_ASSERT_EQUAL(0, knxMockHeap().allocations - allocations);
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("{\"host\": \"native\", \"json\": {\"bytes\":%zu,\"rounds\":%u,\"MBps\":%.1f,\"tokensPerUs\":%.1f}}\n",
+           text.size(), JSON_BENCH_ROUNDS, text.size() * (double)JSON_BENCH_ROUNDS / seconds / 1e6,
+           tokenCount / seconds / 1e6);
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_valid_documents);
+    RUN_TEST(test_syntax_errors);
+    RUN_TEST(test_error_is_final);
+    RUN_TEST(test_depth_limit);
+    RUN_TEST(test_text_and_skip);
+    RUN_TEST(test_int32_range);
+    RUN_TEST(test_commands);
+    RUN_TEST(test_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+// Kept connections of the synchronous server on the ESP8266: the request that reaches
+// KNXWEB_KEEPALIVE_REQUESTS closes its connection, the connections are counted by address
+// and port. Page actions posted by the page get a 204, links still the redirect.
+// Requests are 200 ms apart so the rate limiter lets them through.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+static const char *const actions[] = {"/knxoff", "/normalmode", "/otaoff", "/otaon", "/progmode", "/tftdebug", "/tftupdate"};
+
+static unsigned long connections()
+{
+    http.setRemotePort(0);
+    knxMockAdvance(200);
+    std::string profile = http.get("/api/profile").body;
+    size_t position = profile.find("\"connections\":");
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(profile.c_str() + position + 14, nullptr, 10);
+}
+
+static KnxMockResponse get(const char *uri)
+{
+    knxMockAdvance(200);
+    return http.get(uri);
+}
+
+void setUp()
+{
+    http.setRemotePort(0);
+}
+
+void tearDown()
+{
+}
+
+void test_request_cap()
+{
+    unsigned long before = connections();
+    http.setRemotePort(50000);
+    for (int i = 1; i < KNXWEB_KEEPALIVE_REQUESTS; i++)
+    {
+        KnxMockResponse response = get("/api/status");
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_FALSE(response.closeConnection);
+    }
+    KnxMockResponse last = get("/api/status");
+    TEST_ASSERT_EQUAL_INT(200, last.code);
+    TEST_ASSERT_TRUE(last.closeConnection);
+
+    // The client opens the next connection from another port
+    http.setRemotePort(50001);
+    TEST_ASSERT_FALSE(get("/api/status").closeConnection);
+    // The profile request itself was one more
+    TEST_ASSERT_EQUAL_UINT32(before + 3, connections());
+}
+
+// Without kept connections every request is one
+void test_new_connections()
+{
+    unsigned long before = connections();
+    for (int i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_FALSE(get("/api/status").closeConnection);
+    }
+    TEST_ASSERT_EQUAL_UINT32(before + 6, connections());
+}
+
+// The other client in between ends the count of the kept connection
+void test_other_client()
+{
+    http.setRemotePort(50002);
+    for (int i = 1; i < KNXWEB_KEEPALIVE_REQUESTS; i++)
+    {
+        get("/api/status");
+    }
+    http.setRemotePort(0);
+    get("/api/status");
+    http.setRemotePort(50002);
+    TEST_ASSERT_FALSE(get("/api/status").closeConnection);
+}
+
+void test_actions()
+{
+    for (const char *action : actions)
+    {
+        knxMockAdvance(200);
+        KnxMockResponse posted = http.post(action);
+        TEST_ASSERT_EQUAL_INT(204, posted.code);
+        TEST_ASSERT_EQUAL_STRING("", posted.body.c_str());
+        TEST_ASSERT_EQUAL_STRING("", posted.header("Location").c_str());
+
+        KnxMockResponse linked = get(action);
+        TEST_ASSERT_EQUAL_INT(302, linked.code);
+        TEST_ASSERT_EQUAL_STRING("/", linked.header("Location").c_str());
+        webserver.loop();
+    }
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_request_cap);
+    RUN_TEST(test_new_connections);
+    RUN_TEST(test_other_client);
+    RUN_TEST(test_actions);
+    return UNITY_END();
+}
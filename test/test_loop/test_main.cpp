@@ -0,0 +1,143 @@
+// loop() with a time budget: the slices a call runs, the rotation to the slice after the
+// last one that ran, the loop statistics and the actions handlers leave to loop(). The
+// KNX mode callback takes 2 ms of the mock clock, ArduinoOTA.handle() shows the slice after it.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#define SLOW_TASK_MS 2
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+uint32_t modeChanges = 0;
+knxModeOptions_t knxMode = KNX_MODE_NORMAL;
+uint32_t tftUpdates = 0;
+
+static void setKnxMode(knxModeOptions_t mode)
+{
+    knxMode = mode;
+    modeChanges++;
+    knxMockAdvance(SLOW_TASK_MS);
+}
+
+static void startTftUpdate()
+{
+    tftUpdates++;
+}
+
+// An OTA poll is due in the next slice that gets to it
+static void otaPollDue()
+{
+    knxMockAdvance(KNXWEB_OTA_POLL_MAX + 1);
+}
+
+// Posted like the buttons of the page do
+static void command(const char *path)
+{
+    knxMockAdvance(1000);
+    TEST_ASSERT_EQUAL_INT(204, http.post(path).code);
+}
+
+void setUp()
+{
+    modeChanges = 0;
+    command("/otaon");
+    webserver.loop();
+    TEST_ASSERT_TRUE(ArduinoOTA.running);
+    webserver.resetLoopStats();
+}
+
+void tearDown()
+{
+    command("/otaoff");
+    webserver.loop();
+}
+
+// Without a budget every slice runs in one call, the new mode and an OTA poll included
+void test_unbudgeted()
+{
+    command("/progmode");
+    TEST_ASSERT_EQUAL_UINT32(0, modeChanges);
+    otaPollDue();
+    uint32_t handles = ArduinoOTA.handles;
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, modeChanges);
+    TEST_ASSERT_EQUAL_INT(KNX_MODE_PROG, knxMode);
+    TEST_ASSERT_EQUAL_UINT32(handles + 1, ArduinoOTA.handles);
+
+    const knxWebLoopStats_t &stats = webserver.getLoopStats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats.calls);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(SLOW_TASK_MS * 1000, stats.lastMicros);
+    TEST_ASSERT_EQUAL_UINT32(stats.lastMicros, stats.maxMicros);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.overBudget);
+}
+
+// A call stops after the slice that used up the budget, the next one goes on with the OTA slice
+void test_budget_rotation()
+{
+    uint32_t budget = SLOW_TASK_MS * 1000 / 2;
+    otaPollDue();
+    command("/normalmode");
+    uint32_t handles = ArduinoOTA.handles;
+    // A call without a budget ran every slice before, this one starts with the tasks
+    webserver.loop(budget);
+    TEST_ASSERT_EQUAL_UINT32(1, modeChanges);
+    TEST_ASSERT_EQUAL_UINT32(handles, ArduinoOTA.handles);
+    TEST_ASSERT_EQUAL_UINT32(1, webserver.getLoopStats().overBudget);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(SLOW_TASK_MS * 1000, webserver.getLoopStats().lastMicros);
+
+    webserver.loop(budget);
+    TEST_ASSERT_EQUAL_UINT32(handles + 1, ArduinoOTA.handles);
+    TEST_ASSERT_EQUAL_UINT32(1, webserver.getLoopStats().overBudget);
+}
+
+// A budget that is not used up runs every slice, like no budget
+void test_budget_not_reached()
+{
+    for (int i = 0; i < 5; i++)
+    {
+        otaPollDue();
+        uint32_t handles = ArduinoOTA.handles;
+        webserver.loop(1000000);
+        TEST_ASSERT_EQUAL_UINT32(handles + 1, ArduinoOTA.handles);
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, webserver.getLoopStats().calls);
+    TEST_ASSERT_EQUAL_UINT32(0, webserver.getLoopStats().overBudget);
+    // The time between two calls is what the sketch waited
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32((KNXWEB_OTA_POLL_MAX + 1) * 1000UL, webserver.getLoopStats().maxGapMicros);
+}
+
+// Handlers only queue the TFT update and the restart, loop() runs them after the response
+void test_deferred_actions()
+{
+    command("/tftupdate");
+    TEST_ASSERT_EQUAL_UINT32(0, tftUpdates);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, tftUpdates);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, tftUpdates);
+
+    uint32_t restarts = ESP.restarts;
+    command("/restart");
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(restarts, ESP.restarts);
+    // millis() follows the host clock as well, the margin leaves time for the test itself
+    knxMockAdvance(600);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(restarts + 1, ESP.restarts);
+}
+
+int main()
+{
+    webserver.registerSetKnxModeCallback(setKnxMode);
+    webserver.registerTftUpdateCallback(startTftUpdate);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_unbudgeted);
+    RUN_TEST(test_budget_rotation);
+    RUN_TEST(test_budget_not_reached);
+    RUN_TEST(test_deferred_actions);
+    return UNITY_END();
+}
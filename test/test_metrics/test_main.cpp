@@ -0,0 +1,225 @@
+// /metrics in the Prometheus text format: HELP and TYPE before every family, the cumulative
+// latency buckets with their _sum and _count, and the buckets KnxMetrics counts a request in.
+// Prints the cost of recording a request in the format of test_bench.
+
+#include <KnxMock.h>
+#include <esp-knx-metrics.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define STATUS_REQUESTS 25
+#define RECORD_BATCHES 1000
+#define RECORD_BATCH_SIZE 1000
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+struct Sample
+{
+    std::string name;
+    std::string labels;
+    std::string value;
+};
+
+static std::vector<std::string> lines(const std::string &text)
+{
+    std::vector<std::string> all;
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        all.push_back(line);
+    }
+    return all;
+}
+
+static Sample parseSample(const std::string &line)
+{
+    Sample sample;
+    size_t brace = line.find('{');
+    size_t space = line.rfind(' ');
+    sample.name = line.substr(0, std::min(brace, space));
+    if (brace != std::string::npos)
+    {
+        sample.labels = line.substr(brace + 1, line.find('}') - brace - 1);
+    }
+    sample.value = line.substr(space + 1);
+    return sample;
+}
+
+static std::vector<Sample> series(const std::string &text, const std::string &name, const std::string &labels)
+{
+    std::vector<Sample> found;
+    for (const std::string &line : lines(text))
+    {
+        if (line[0] != '#')
+        {
+            Sample sample = parseSample(line);
+            if (sample.name == name && sample.labels.compare(0, labels.size(), labels) == 0)
+            {
+                found.push_back(sample);
+            }
+        }
+    }
+    return found;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// Every sample follows the HELP and TYPE of its family, the suffixes of a histogram included
+void test_families()
+{
+    KnxMockResponse response = http.get("/metrics");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_EQUAL_STRING("text/plain; version=0.0.4", response.contentType.c_str());
+    TEST_ASSERT_TRUE(response.body.back() == '\n');
+
+    std::map<std::string, std::string> types;
+    std::string family;
+    std::string type;
+    for (const std::string &line : lines(response.body))
+    {
+        TEST_ASSERT_FALSE(line.empty());
+        if (line.compare(0, 7, "# HELP ") == 0)
+        {
+            family = line.substr(7, line.find(' ', 7) - 7);
+            TEST_ASSERT_TRUE(types.count(family) == 0);
+            type = "";
+            continue;
+        }
+        if (line.compare(0, 7, "# TYPE ") == 0)
+        {
+            TEST_ASSERT_EQUAL_STRING(("# TYPE " + family + " ").c_str(), line.substr(0, 8 + family.size()).c_str());
+            type = line.substr(8 + family.size());
+            TEST_ASSERT_TRUE(type == "counter" || type == "gauge" || type == "histogram");
+            types[family] = type;
+            continue;
+        }
+        TEST_ASSERT_FALSE(type.empty());
+        Sample sample = parseSample(line);
+        if (type == "histogram")
+        {
+            TEST_ASSERT_TRUE(sample.name == family + "_bucket" || sample.name == family + "_sum" || sample.name == family + "_count");
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_STRING(family.c_str(), sample.name.c_str());
+        }
+        TEST_ASSERT_TRUE(sample.value.find_first_not_of("-0123456789.") == std::string::npos);
+    }
+    TEST_ASSERT_EQUAL_STRING("histogram", types["knxweb_request_duration_seconds"].c_str());
+    TEST_ASSERT_EQUAL_STRING("counter", types["knxweb_response_bytes_total"].c_str());
+    TEST_ASSERT_EQUAL_STRING("gauge", types["knxweb_free_heap_bytes"].c_str());
+}
+
+// Buckets in the order of their bounds with counts that only grow, +Inf is the _count
+void test_histogram()
+{
+    for (int i = 0; i < STATUS_REQUESTS; i++)
+    {
+        // Past the rate limiter
+        knxMockAdvance(1000);
+        TEST_ASSERT_EQUAL_INT(200, http.get("/api/status").code);
+    }
+    std::string body = http.get("/metrics").body;
+    std::vector<Sample> buckets = series(body, "knxweb_request_duration_seconds_bucket", "path=\"/api/status\",");
+    TEST_ASSERT_EQUAL_size_t(KNXWEB_METRICS_BUCKETS + 1, buckets.size());
+    unsigned long last = 0;
+    for (size_t i = 0; i < KNXWEB_METRICS_BUCKETS; i++)
+    {
+        char label[32];
+        snprintf(label, sizeof(label), "le=\"%g\"", KnxMetrics::bucketBounds[i] / 1e6);
+        TEST_ASSERT_EQUAL_STRING(("path=\"/api/status\"," + std::string(label)).c_str(), buckets[i].labels.c_str());
+        unsigned long cumulative = std::stoul(buckets[i].value);
+        TEST_ASSERT_TRUE(cumulative >= last);
+        last = cumulative;
+    }
+    TEST_ASSERT_EQUAL_STRING("path=\"/api/status\",le=\"+Inf\"", buckets.back().labels.c_str());
+    TEST_ASSERT_EQUAL_STRING(std::to_string(STATUS_REQUESTS).c_str(), buckets.back().value.c_str());
+    TEST_ASSERT_TRUE(last <= STATUS_REQUESTS);
+
+    std::vector<Sample> count = series(body, "knxweb_request_duration_seconds_count", "path=\"/api/status\"");
+    TEST_ASSERT_EQUAL_size_t(1, count.size());
+    TEST_ASSERT_EQUAL_STRING("path=\"/api/status\"", count[0].labels.c_str());
+    TEST_ASSERT_EQUAL_STRING(buckets.back().value.c_str(), count[0].value.c_str());
+    // Seconds with the microseconds as fraction
+    std::vector<Sample> sum = series(body, "knxweb_request_duration_seconds_sum", "path=\"/api/status\"");
+    TEST_ASSERT_EQUAL_size_t(1, sum.size());
+    TEST_ASSERT_EQUAL_size_t(sum[0].value.size() - 7, sum[0].value.find('.'));
+    // A route that was never requested has no series
+    TEST_ASSERT_EQUAL_size_t(0, series(body, "knxweb_request_duration_seconds_count", "path=\"/api/history\"").size());
+}
+
+// A request is counted in the first bucket whose bound it does not exceed, slower ones only in the count
+void test_buckets()
+{
+    KnxMetrics metrics;
+    for (size_t i = 0; i < KNXWEB_METRICS_BUCKETS; i++)
+    {
+        metrics.recordRequest(1, KnxMetrics::bucketBounds[i], 0, 0);
+        metrics.recordRequest(1, KnxMetrics::bucketBounds[i] + 1, 0, 0);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, metrics.getBucket(1, 0));
+    for (size_t i = 1; i < KNXWEB_METRICS_BUCKETS; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(2, metrics.getBucket(1, i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(2 * KNXWEB_METRICS_BUCKETS, metrics.getRequests(1));
+    TEST_ASSERT_EQUAL_UINT32(KnxMetrics::bucketBounds[KNXWEB_METRICS_BUCKETS - 1] + 1, metrics.getMaxDuration(1));
+    TEST_ASSERT_EQUAL_UINT32(0, metrics.getRequests(0));
+    // Out of range slots are ignored
+    metrics.recordRequest(KNXWEB_METRICS_SLOTS, 1, 0, 0);
+}
+
+// Nanoseconds per recordRequest(), the request path pays it once per request
+void test_record_cost()
+{
+    static KnxMetrics metrics;
+    std::vector<double> batches;
+    batches.reserve(RECORD_BATCHES);
+    uint32_t duration = 1;
+    uint64_t allocations = knxMockHeap().allocations;
+    for (int batch = 0; batch < RECORD_BATCHES; batch++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < RECORD_BATCH_SIZE; i++)
+        {
+            // Spread over all buckets and slots
+            duration = duration * 1103515245 + 12345;
+            metrics.recordRequest(i % KNXWEB_METRICS_SLOTS, (duration >> 8) % 2000000, 200, 0);
+        }
+        auto end = std::chrono::steady_clock::now();
+        batches.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)RECORD_BATCH_SIZE);
+    }
+    TEST_ASSERT_EQUAL_UINT64(allocations, knxMockHeap().allocations);
+    std::sort(batches.begin(), batches.end());
+    double p50Ns = batches[batches.size() / 2];
+    double p99Ns = batches[(batches.size() * 99 + 99) / 100 - 1];
+    printf("{\"host\": \"native\", \"recordRequest\": {\"samples\":%d,\"p50Ns\":%.2f,\"p99Ns\":%.2f}}\n",
+           RECORD_BATCHES * RECORD_BATCH_SIZE, p50Ns, p99Ns);
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_families);
+    RUN_TEST(test_histogram);
+    RUN_TEST(test_buckets);
+    RUN_TEST(test_record_cost);
+    return UNITY_END();
+}
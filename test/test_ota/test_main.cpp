@@ -0,0 +1,196 @@
+// OTA service: the adaptive ArduinoOTA polling, the timeout and the otaTimeout command. The
+// mock ArduinoOTA never receives an update, the tests call its callbacks like handle() would.
+// The service gets the time from its caller, the webserver from the mock millis().
+
+#include <KnxMock.h>
+#include <esp-knx-ota.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+// Times loop() polled ArduinoOTA at, calling it every ms from start to end
+static std::vector<unsigned long> polls(KnxOtaService &ota, unsigned long start, unsigned long end)
+{
+    std::vector<unsigned long> times;
+    for (unsigned long now = start; now < end; now++)
+    {
+        uint32_t handles = ArduinoOTA.handles;
+        if (ota.loop(now))
+        {
+            times.push_back(now);
+            TEST_ASSERT_EQUAL_UINT32(handles + 1, ArduinoOTA.handles);
+        }
+    }
+    return times;
+}
+
+static std::string status()
+{
+    return http.get("/api/status").body;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// Disabled, loop() never touches ArduinoOTA
+void test_idle()
+{
+    KnxOtaService ota;
+    TEST_ASSERT_EQUAL_size_t(0, polls(ota, 1000, 5000).size());
+    TEST_ASSERT_EQUAL_UINT32(0, ota.getPolls());
+    TEST_ASSERT_EQUAL_INT32(0, ota.getRemaining(5000));
+}
+
+// The first poll is right away, then the interval doubles up to KNXWEB_OTA_POLL_MAX
+void test_poll_backoff()
+{
+    KnxOtaService ota;
+    ota.start(1000);
+    TEST_ASSERT_TRUE(ArduinoOTA.running);
+    std::vector<unsigned long> times = polls(ota, 1000, 3000);
+    std::vector<unsigned long> expected;
+    unsigned long now = 1000;
+    uint32_t interval = KNXWEB_OTA_POLL_MIN;
+    while (now < 3000)
+    {
+        expected.push_back(now);
+        interval = min((uint32_t)KNXWEB_OTA_POLL_MAX, interval * 2);
+        now += interval;
+    }
+    TEST_ASSERT_EQUAL_size_t(expected.size(), times.size());
+    TEST_ASSERT_TRUE(times == expected);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_OTA_POLL_MAX, ota.getPollInterval());
+    TEST_ASSERT_EQUAL_UINT32(times.size(), ota.getPolls());
+    ota.stop();
+    TEST_ASSERT_FALSE(ArduinoOTA.running);
+}
+
+// Update activity seen in handle() brings the interval back to the minimum and restarts the timeout
+void test_activity()
+{
+    KnxOtaService ota;
+    bool result = false;
+    uint32_t results = 0;
+    ota.setResultCallback([&](bool success)
+                          { result = success; results++; });
+    ota.start(0);
+    polls(ota, 0, 10000);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_OTA_POLL_MAX, ota.getPollInterval());
+
+    // An update that kept handle() busy for 20 s
+    ArduinoOTA.startFctn();
+    ArduinoOTA.progressFctn(50, 200);
+    TEST_ASSERT_EQUAL_STRING("running", ota.getStateName());
+    TEST_ASSERT_EQUAL_UINT8(25, ota.getProgress());
+    std::vector<unsigned long> times = polls(ota, 30000, 30000 + 7 * KNXWEB_OTA_POLL_MIN);
+    TEST_ASSERT_EQUAL_UINT32(30000, ota.getActivityTime());
+    TEST_ASSERT_EQUAL_size_t(3, times.size());
+    TEST_ASSERT_EQUAL_UINT32(30000, times[0]);
+    TEST_ASSERT_EQUAL_UINT32(30000 + 2 * KNXWEB_OTA_POLL_MIN, times[1]);
+    TEST_ASSERT_EQUAL_UINT32(30000 + 6 * KNXWEB_OTA_POLL_MIN, times[2]);
+
+    // A running update is never switched off
+    polls(ota, 30000 + 7 * KNXWEB_OTA_POLL_MIN, 30000 + ota.getTimeout() * 1000UL + 1000);
+    TEST_ASSERT_TRUE(ota.isActive());
+
+    ArduinoOTA.errorFctn(OTA_RECEIVE_ERROR);
+    TEST_ASSERT_EQUAL_STRING("failed", ota.getStateName());
+    TEST_ASSERT_EQUAL_STRING("Receive failed", ota.getError());
+    TEST_ASSERT_EQUAL_UINT32(1, results);
+    TEST_ASSERT_FALSE(result);
+    unsigned long failed = 400000;
+    ota.loop(failed);
+    TEST_ASSERT_EQUAL_UINT32(failed, ota.getActivityTime());
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_OTA_POLL_MIN * 2, ota.getPollInterval());
+
+    // The uploader retries
+    ArduinoOTA.startFctn();
+    ArduinoOTA.endFctn();
+    TEST_ASSERT_EQUAL_STRING("done", ota.getStateName());
+    TEST_ASSERT_EQUAL_UINT8(100, ota.getProgress());
+    TEST_ASSERT_EQUAL_STRING("", ota.getError());
+    TEST_ASSERT_EQUAL_UINT32(2, results);
+    TEST_ASSERT_TRUE(result);
+    ota.stop();
+}
+
+// The timeout counts from the start or the last activity
+void test_timeout()
+{
+    KnxOtaService ota;
+    ota.setTimeout(KNXWEB_OTA_TIMEOUT_MIN);
+    ota.start(5000);
+    unsigned long end = 5000 + KNXWEB_OTA_TIMEOUT_MIN * 1000UL;
+    ota.loop(end - 1000);
+    TEST_ASSERT_EQUAL_INT32(1, ota.getRemaining(end - 1000));
+    ota.loop(end - 1);
+    TEST_ASSERT_TRUE(ota.isActive());
+    TEST_ASSERT_TRUE(ArduinoOTA.running);
+    uint32_t handles = ArduinoOTA.handles;
+    TEST_ASSERT_FALSE(ota.loop(end));
+    TEST_ASSERT_FALSE(ota.isActive());
+    TEST_ASSERT_FALSE(ArduinoOTA.running);
+    TEST_ASSERT_EQUAL_STRING("off", ota.getStateName());
+    TEST_ASSERT_EQUAL_UINT32(handles, ArduinoOTA.handles);
+    TEST_ASSERT_EQUAL_INT32(0, ota.getRemaining(end));
+
+    // Out of range values are limited
+    ota.setTimeout(1);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_OTA_TIMEOUT_MIN, ota.getTimeout());
+    ota.setTimeout(UINT32_MAX);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_OTA_TIMEOUT_MAX, ota.getTimeout());
+}
+
+// The command is checked right away, the new timeout is taken and saved from loop()
+void test_timeout_command()
+{
+    std::string timeout = "{\"otaTimeout\":" + std::to_string(KNXWEB_OTA_TIMEOUT_MIN - 1) + "}";
+    KnxMockResponse response = http.post("/api/command", timeout);
+    TEST_ASSERT_EQUAL_INT(400, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"otaTimeout\":\"invalid\"}", response.body.c_str());
+
+    timeout = "{\"otaTimeout\":" + std::to_string(KNXWEB_OTA_TIMEOUT_MIN) + "}";
+    TEST_ASSERT_EQUAL_INT(200, http.post("/api/command", timeout).code);
+    std::string field = "\"otaTimeout\":" + std::to_string(KNXWEB_OTA_TIMEOUT_MIN) + ",";
+    TEST_ASSERT_TRUE(status().find(field) == std::string::npos);
+    webserver.loop();
+    TEST_ASSERT_TRUE(status().find(field) != std::string::npos);
+    TEST_ASSERT_EQUAL_STRING(("otaTimeout=" + std::to_string(KNXWEB_OTA_TIMEOUT_MIN) + "\n").c_str(),
+                             LittleFS.files[KNXWEB_SETTINGS_FILE].c_str());
+
+    // Enabled over the API, switched off by loop() after the new timeout
+    TEST_ASSERT_EQUAL_INT(200, http.post("/api/command", "{\"ota\":true}").code);
+    webserver.loop();
+    TEST_ASSERT_TRUE(status().find("\"otaActive\":true") != std::string::npos);
+    // millis() follows the host clock as well, the margins leave time for the test itself
+    knxMockAdvance(KNXWEB_OTA_TIMEOUT_MIN * 1000UL - 500);
+    webserver.loop();
+    TEST_ASSERT_TRUE(status().find("\"otaActive\":true,\"otaRemaining\":1,") != std::string::npos);
+    knxMockAdvance(1000);
+    webserver.loop();
+    TEST_ASSERT_TRUE(status().find("\"otaActive\":false") != std::string::npos);
+    TEST_ASSERT_FALSE(ArduinoOTA.running);
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_idle);
+    RUN_TEST(test_poll_backoff);
+    RUN_TEST(test_activity);
+    RUN_TEST(test_timeout);
+    RUN_TEST(test_timeout_command);
+    return UNITY_END();
+}
@@ -0,0 +1,520 @@
+// Compares the compile-time page template of 8e46c0a with the chunked renderer it replaced.
+// Both render the /api/status document as it was before the split into /api/info and
+// /api/status, for the ESP8266 like the native build. The renderers are copies of the two
+// versions of handleApiStatus() on a copy of the chunk buffer of KnxWebserver, so both
+// are measured on the same values. Prints one JSON document with the sizes and render times.
+
+#include <KnxMock.h>
+#include <esp-knx-page.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+
+#define PAGE_RENDERS 100000
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+static knxModeOptions_t getKnxMode()
+{
+    return KNX_MODE_NORMAL;
+}
+
+// The values a handler reads from the webserver, systemInfo and ota
+struct StatusValues
+{
+    const char *name;
+    const char *physAddr;
+    bool configOk;
+    bool hasMode;
+    knxModeOptions_t mode;
+    bool otaActive;
+    long otaRemaining;
+    unsigned long otaTimeout;
+    const char *otaState;
+    unsigned otaProgress;
+    const char *otaError;
+    bool tftUpdate;
+    bool tftDebug;
+    bool auth;
+    unsigned long flash;
+    unsigned long heap;
+    unsigned long cpu;
+    int rssi;
+    uint8_t mac[6];
+    long heapRange[3];
+    long rssiRange[3];
+    const char *sdk;
+    const char *resetReason;
+    unsigned long loopMax;
+    const char *build;
+};
+
+static const StatusValues idle = {
+    "knx-device", "1.1.20", true, true, KNX_MODE_NORMAL, false, 0, 300000, "idle", 0, "",
+    true, false, true, 4194304, 41234, 80, -61, {0x5C, 0xCF, 0x7F, 0x12, 0x34, 0x56},
+    {39876, 41012, 42380}, {-72, -63, -55}, "2.2.2-dev(38a443e)", "Power On", 1874,
+    "v1.4.2 Oct 17 2026 21:14:31"};
+
+static const StatusValues updating = {
+    "Kitchen \"north\" \\ 2\n", "15.15.255", false, true, KNX_MODE_PROG, true, 287345, 300000, "receiving", 57,
+    "Flash \"write\" failed", false, true, false, 1048576, 18020, 160, -88, {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+    {-2147483647L, 0, 2147483647L}, {-100, -90, -1}, "", "Exception", 4294967295UL, ""};
+
+static const StatusValues noMode = {
+    "", "0.0.0", false, false, KNX_MODE_OFF, false, 0, 0, "idle", 0, "", false, false, false,
+    0, 0, 0, 0, {0, 0, 0, 0, 0, 0}, {0, 0, 0}, {0, 0, 0}, "native", "", 0, "x"};
+
+// The chunk buffer of KnxWebserver, the chunks go to body instead of the transport
+class ChunkWriter
+{
+public:
+    std::string body;
+    size_t chunks = 0;
+    size_t chunkFraming = 0;
+
+    void begin()
+    {
+        body.clear();
+        chunks = 0;
+        chunkFraming = 0;
+        chunkLength = 0;
+    }
+
+    void writeChunk(const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            size_t part = min(length, sizeof(chunkBuffer) - chunkLength);
+            memcpy(chunkBuffer + chunkLength, data, part);
+            chunkLength += part;
+            data += part;
+            length -= part;
+            if (chunkLength == sizeof(chunkBuffer))
+            {
+                flushChunk();
+            }
+        }
+    }
+
+    void writeChunk_P(PGM_P text)
+    {
+        writeChunk_P(text, strlen_P(text));
+    }
+
+    void writeChunk_P(PGM_P text, size_t length)
+    {
+        while (length > 0)
+        {
+            size_t part = min(length, sizeof(chunkBuffer) - chunkLength);
+            memcpy_P(chunkBuffer + chunkLength, text, part);
+            chunkLength += part;
+            text += part;
+            length -= part;
+            if (chunkLength == sizeof(chunkBuffer))
+            {
+                flushChunk();
+            }
+        }
+    }
+
+    void writeChunkf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(chunkBuffer + chunkLength, sizeof(chunkBuffer) - chunkLength, format, args);
+        va_end(args);
+        if (length < 0)
+        {
+            return;
+        }
+        if (chunkLength + length < sizeof(chunkBuffer))
+        {
+            chunkLength += length;
+            return;
+        }
+        flushChunk();
+        if ((size_t)length < sizeof(chunkBuffer))
+        {
+            va_start(args, format);
+            vsnprintf(chunkBuffer, sizeof(chunkBuffer), format, args);
+            va_end(args);
+            chunkLength = length;
+            return;
+        }
+        char *text = (char *)malloc(length + 1);
+        if (text == nullptr)
+        {
+            return;
+        }
+        va_start(args, format);
+        vsnprintf(text, length + 1, format, args);
+        va_end(args);
+        writeChunk(text, length);
+        free(text);
+    }
+
+    void writeJsonString(const char *text)
+    {
+        writeChunk("\"", 1);
+        for (; *text != 0; text++)
+        {
+            char c = *text;
+            if (c == '"' || c == '\\')
+            {
+                char escaped[2] = {'\\', c};
+                writeChunk(escaped, sizeof(escaped));
+            }
+            else if ((uint8_t)c < 0x20)
+            {
+                writeChunkf("\\u%04x", c);
+            }
+            else
+            {
+                writeChunk(&c, 1);
+            }
+        }
+        writeChunk("\"", 1);
+    }
+
+    // A chunk of the transfer encoding is framed by its length in hex and two CRLF
+    void flushChunk()
+    {
+        if (chunkLength > 0)
+        {
+            body.append(chunkBuffer, chunkLength);
+            chunks++;
+            char size[12];
+            chunkFraming += snprintf(size, sizeof(size), "%zx", chunkLength) + 4;
+            chunkLength = 0;
+        }
+    }
+
+    // The terminating chunk "0\r\n\r\n"
+    void endChunked()
+    {
+        flushChunk();
+        chunkFraming += 5;
+    }
+
+private:
+    char chunkBuffer[KNXWEB_CHUNK_SIZE];
+    size_t chunkLength = 0;
+};
+
+// handleApiStatus() before 8e46c0a, the ESP8266 branch
+static void renderChunked(const StatusValues &v, ChunkWriter &out)
+{
+    out.begin();
+    out.writeChunk_P(PSTR("{\"name\":"));
+    out.writeJsonString(v.name);
+    out.writeChunk_P(PSTR(",\"physAddr\":"));
+    out.writeJsonString(v.physAddr);
+    out.writeChunkf(",\"configOk\":%s", v.configOk ? "true" : "false");
+    if (v.hasMode)
+    {
+        switch (v.mode)
+        {
+        case KNX_MODE_OFF:
+            out.writeChunk_P(PSTR(",\"mode\":\"off\""));
+            break;
+        case KNX_MODE_NORMAL:
+            out.writeChunk_P(PSTR(",\"mode\":\"normal\""));
+            break;
+        case KNX_MODE_PROG:
+            out.writeChunk_P(PSTR(",\"mode\":\"prog\""));
+            break;
+        }
+    }
+    if (v.otaActive)
+    {
+        out.writeChunkf(",\"otaActive\":true,\"otaRemaining\":%ld", v.otaRemaining);
+    }
+    else
+    {
+        out.writeChunk_P(PSTR(",\"otaActive\":false"));
+    }
+    out.writeChunkf(",\"otaTimeout\":%lu,\"otaState\":\"%s\",\"otaProgress\":%u,\"otaError\":",
+                    v.otaTimeout, v.otaState, v.otaProgress);
+    out.writeJsonString(v.otaError);
+    out.writeChunkf(",\"tftUpdate\":%s,\"tftDebug\":%s,\"auth\":%s",
+                    v.tftUpdate ? "true" : "false", v.tftDebug ? "true" : "false", v.auth ? "true" : "false");
+    out.writeChunk_P(PSTR(",\"chip\":\"ESP8266\""));
+    out.writeChunkf(",\"flash\":%lu,\"heap\":%lu", v.flash, v.heap);
+    out.writeChunkf(",\"cpu\":%lu,\"rssi\":%d,\"mac\":\"%02X:%02X:%02X:%02X:%02X:%02X\"", v.cpu, v.rssi,
+                    v.mac[0], v.mac[1], v.mac[2], v.mac[3], v.mac[4], v.mac[5]);
+    out.writeChunkf(",\"heapRange\":[%ld,%ld,%ld],\"rssiRange\":[%ld,%ld,%ld]", v.heapRange[0], v.heapRange[1], v.heapRange[2],
+                    v.rssiRange[0], v.rssiRange[1], v.rssiRange[2]);
+    out.writeChunk_P(PSTR(",\"sdk\":"));
+    out.writeJsonString(v.sdk);
+    out.writeChunk_P(PSTR(",\"resetReason\":"));
+    out.writeJsonString(v.resetReason);
+    out.writeChunkf(",\"loopMax\":%lu", v.loopMax);
+    out.writeChunk_P(PSTR(",\"build\":"));
+    out.writeJsonString(v.build);
+    out.writeChunk_P(PSTR("}"));
+    out.endChunked();
+}
+
+// The template of 8e46c0a, the ESP8266 branch
+#define S KNXPAGE_SLOT
+constexpr char STATUS_JSON[] PROGMEM =
+    "{\"name\":" S ",\"physAddr\":" S ",\"configOk\":" S S
+    ",\"otaActive\":" S S ",\"otaTimeout\":" S ",\"otaState\":\"" S "\",\"otaProgress\":" S ",\"otaError\":" S
+    ",\"tftUpdate\":" S ",\"tftDebug\":" S ",\"auth\":" S
+    ",\"chip\":\"ESP8266\",\"flash\":" S ",\"heap\":" S
+    ",\"cpu\":" S ",\"rssi\":" S ",\"mac\":\"" S "\",\"heapRange\":[" S "],\"rssiRange\":[" S "]"
+    ",\"sdk\":" S ",\"resetReason\":" S ",\"loopMax\":" S ",\"build\":" S "}";
+#undef S
+constexpr size_t STATUS_SLOTS = knxPageCountSlots(STATUS_JSON, sizeof(STATUS_JSON) - 1);
+constexpr KnxPageLayout<STATUS_SLOTS> statusLayout PROGMEM = knxPageLayout<STATUS_SLOTS>(STATUS_JSON, sizeof(STATUS_JSON) - 1);
+
+static const char *formatValue(char *buffer, size_t size, size_t &used, const char *format, ...)
+{
+    char *text = buffer + used;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(text, size - used, format, args);
+    va_end(args);
+    used = written > 0 ? min(used + written + 1, size - 1) : used;
+    return text;
+}
+
+static size_t jsonStringLength(const char *text)
+{
+    size_t length = 2;
+    for (; *text != 0; text++)
+    {
+        uint8_t c = *text;
+        length += c == '"' || c == '\\' ? 2 : c < 0x20 ? 6 : 1;
+    }
+    return length;
+}
+
+// KnxWebserver::sendPage(), returns the Content-Length it sends
+static size_t sendPage(ChunkWriter &out, PGM_P text, const uint16_t *slots, size_t count, size_t length, const knxPageValue_t *values)
+{
+    size_t templateLength = length + count;
+    for (size_t i = 0; i < count; i++)
+    {
+        length += values[i].type == KNXPAGE_JSON_STRING ? jsonStringLength(values[i].text)
+                  : values[i].type == KNXPAGE_TEXT_P    ? strlen_P(values[i].text)
+                                                        : strlen(values[i].text);
+    }
+    out.begin();
+    size_t offset = 0;
+    for (size_t i = 0; i <= count; i++)
+    {
+        size_t end = i < count ? pgm_read_word(&slots[i]) : templateLength;
+        out.writeChunk_P(text + offset, end - offset);
+        offset = end + 1;
+        if (i == count)
+        {
+            break;
+        }
+        switch (values[i].type)
+        {
+        case KNXPAGE_JSON_STRING:
+            out.writeJsonString(values[i].text);
+            break;
+        case KNXPAGE_TEXT_P:
+            out.writeChunk_P(values[i].text);
+            break;
+        default:
+            out.writeChunk(values[i].text, strlen(values[i].text));
+            break;
+        }
+    }
+    out.flushChunk();
+    return length;
+}
+
+// handleApiStatus() of 8e46c0a
+static size_t renderTemplate(const StatusValues &v, ChunkWriter &out)
+{
+    static const char modeOff[] PROGMEM = ",\"mode\":\"off\"";
+    static const char modeNormal[] PROGMEM = ",\"mode\":\"normal\"";
+    static const char modeProg[] PROGMEM = ",\"mode\":\"prog\"";
+    char numbers[320];
+    size_t used = 0;
+    knxPageValue_t values[STATUS_SLOTS];
+    size_t n = 0;
+    auto text = [](const char *value) { return knxPageValue_t{value, KNXPAGE_TEXT}; };
+    auto flag = [](bool value) { return knxPageValue_t{value ? "true" : "false", KNXPAGE_TEXT}; };
+    auto jsonString = [](const char *value) { return knxPageValue_t{value, KNXPAGE_JSON_STRING}; };
+
+    values[n++] = jsonString(v.name);
+    values[n++] = jsonString(v.physAddr);
+    values[n++] = flag(v.configOk);
+    values[n++] = {"", KNXPAGE_TEXT};
+    if (v.hasMode)
+    {
+        values[n - 1] = {v.mode == KNX_MODE_OFF ? modeOff : v.mode == KNX_MODE_NORMAL ? modeNormal : modeProg, KNXPAGE_TEXT_P};
+    }
+    values[n++] = flag(v.otaActive);
+    values[n++] = text(v.otaActive ? formatValue(numbers, sizeof(numbers), used, ",\"otaRemaining\":%ld", v.otaRemaining) : "");
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", v.otaTimeout));
+    values[n++] = text(v.otaState);
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%u", v.otaProgress));
+    values[n++] = jsonString(v.otaError);
+    values[n++] = flag(v.tftUpdate);
+    values[n++] = flag(v.tftDebug);
+    values[n++] = flag(v.auth);
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", v.flash));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", v.heap));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", v.cpu));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%d", v.rssi));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%02X:%02X:%02X:%02X:%02X:%02X",
+                                   v.mac[0], v.mac[1], v.mac[2], v.mac[3], v.mac[4], v.mac[5]));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%ld,%ld,%ld", v.heapRange[0], v.heapRange[1], v.heapRange[2]));
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%ld,%ld,%ld", v.rssiRange[0], v.rssiRange[1], v.rssiRange[2]));
+    values[n++] = jsonString(v.sdk);
+    values[n++] = jsonString(v.resetReason);
+    values[n++] = text(formatValue(numbers, sizeof(numbers), used, "%lu", v.loopMax));
+    values[n++] = jsonString(v.build);
+    TEST_ASSERT_EQUAL_size_t(STATUS_SLOTS, n);
+
+    return sendPage(out, STATUS_JSON, statusLayout.slots, STATUS_SLOTS, statusLayout.length, values);
+}
+
+// Names of the members of a flat JSON object, enough for the documents here
+static std::set<std::string> keys(const std::string &json)
+{
+    std::set<std::string> names;
+    for (size_t i = 0; i < json.size(); i++)
+    {
+        if (json[i] == '\\')
+        {
+            i++;
+        }
+        else if (json[i] == '"' && (json[i - 1] == '{' || json[i - 1] == ','))
+        {
+            size_t end = json.find('"', i + 1);
+            if (json[end + 1] == ':')
+            {
+                names.insert(json.substr(i + 1, end - i - 1));
+            }
+            i = end;
+        }
+    }
+    return names;
+}
+
+ChunkWriter chunked;
+ChunkWriter templated;
+
+void setUp()
+{
+    chunked.body.reserve(1024);
+    templated.body.reserve(1024);
+}
+
+void tearDown()
+{
+}
+
+// The template was meant as a drop-in replacement, the bytes must not change
+void test_same_output()
+{
+    for (const StatusValues *values : {&idle, &updating, &noMode})
+    {
+        renderChunked(*values, chunked);
+        size_t length = renderTemplate(*values, templated);
+        TEST_ASSERT_EQUAL_STRING(chunked.body.c_str(), templated.body.c_str());
+        TEST_ASSERT_EQUAL_size_t(templated.body.size(), length);
+    }
+}
+
+// The two routes that replaced it carry the same members, the status changes only
+void test_split_routes()
+{
+    KnxMockResponse info = http.get("/api/info");
+    KnxMockResponse status = http.get("/api/status");
+    TEST_ASSERT_EQUAL_INT(200, info.code);
+    TEST_ASSERT_EQUAL_INT(200, status.code);
+    TEST_ASSERT_EQUAL_size_t(info.body.size(), info.contentLength);
+    TEST_ASSERT_EQUAL_size_t(status.body.size(), status.contentLength);
+
+    std::set<std::string> split = keys(info.body);
+    std::set<std::string> polled = keys(status.body);
+    split.insert(polled.begin(), polled.end());
+    renderChunked(idle, chunked);
+    std::set<std::string> before = keys(chunked.body);
+    // otaRemaining is only there during an update
+    before.erase("otaRemaining");
+    TEST_ASSERT_TRUE(before == split);
+    TEST_ASSERT_LESS_THAN(chunked.body.size(), status.body.size());
+}
+
+static double percentile(std::vector<uint64_t> values, uint32_t percent)
+{
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (values.size() * percent + 99) / 100 - 1)] / 1000.0;
+}
+
+template <typename Render>
+static std::vector<uint64_t> bench(Render render, uint64_t &allocations)
+{
+    std::vector<uint64_t> durations;
+    durations.reserve(PAGE_RENDERS);
+    render();
+    uint64_t before = knxMockHeap().allocations;
+    for (uint32_t i = 0; i < PAGE_RENDERS; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        render();
+        auto end = std::chrono::steady_clock::now();
+        durations.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    allocations = knxMockHeap().allocations - before;
+    return durations;
+}
+
+// Wire size of the response body and its framing header
+void test_render()
+{
+    uint64_t chunkedAllocations;
+    uint64_t templateAllocations;
+    std::vector<uint64_t> chunkedTimes = bench([]()
+                                               { renderChunked(idle, chunked); }, chunkedAllocations);
+    std::vector<uint64_t> templateTimes = bench([]()
+                                                { renderTemplate(idle, templated); }, templateAllocations);
+    TEST_ASSERT_EQUAL_UINT64(0, chunkedAllocations);
+    TEST_ASSERT_EQUAL_UINT64(0, templateAllocations);
+
+    char length[12];
+    size_t chunkedWire = strlen("Transfer-Encoding: chunked\r\n") + chunked.chunkFraming + chunked.body.size();
+    size_t templateWire = strlen("Content-Length: \r\n") + snprintf(length, sizeof(length), "%zu", templated.body.size()) +
+                          templated.body.size();
+    // What the template adds to the stack of the handler on the ESP8266, 8 bytes a value
+    size_t templateStack = 320 + STATUS_SLOTS * 8;
+    // The part that is still polled since the split
+    KnxMockResponse status = http.get("/api/status");
+
+    printf("{\"host\": \"native\", \"renders\": %u, \"statusBody\": %zu, \"renderers\": [\n"
+           "    {\"renderer\":\"chunked\",\"p50Us\":%.2f,\"p99Us\":%.2f,\"allocations\":%llu,\"body\":%zu,\"chunks\":%zu,"
+           "\"wireBytes\":%zu,\"templateBytes\":0,\"stackBytes\":0},\n"
+           "    {\"renderer\":\"template\",\"p50Us\":%.2f,\"p99Us\":%.2f,\"allocations\":%llu,\"body\":%zu,\"chunks\":%zu,"
+           "\"wireBytes\":%zu,\"templateBytes\":%zu,\"stackBytes\":%zu}\n]}\n",
+           PAGE_RENDERS, status.body.size(), percentile(chunkedTimes, 50), percentile(chunkedTimes, 99), (unsigned long long)chunkedAllocations,
+           chunked.body.size(), chunked.chunks, chunkedWire,
+           percentile(templateTimes, 50), percentile(templateTimes, 99), (unsigned long long)templateAllocations,
+           templated.body.size(), templated.chunks, templateWire, sizeof(STATUS_JSON) + sizeof(statusLayout), templateStack);
+}
+
+int main()
+{
+    webserver.registerGetKnxModeCallback(getKnxMode);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_same_output);
+    RUN_TEST(test_split_routes);
+    RUN_TEST(test_render);
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+// Admission control under load: floods from one and from many clients, the free chunks of a
+// running upload and the in-flight gate. Requests are 1 ms apart on the clock of the mock.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define FLOOD_REQUESTS 2000
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+static uint32_t clientIP(int client)
+{
+    return IPAddress(192, 168, 2, 1 + client);
+}
+
+static unsigned long profileValue(const char *name)
+{
+    http.setRemoteIP(IPAddress(192, 168, 3, 1));
+    std::string profile = http.get("/api/profile").body;
+    http.setRemoteIP(clientIP(0));
+    std::string key = std::string("\"") + name + "\":";
+    size_t position = profile.find(key);
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(profile.c_str() + position + key.size(), nullptr, 10);
+}
+
+static uint64_t median(std::vector<uint64_t> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void setUp()
+{
+    // All buckets are full again
+    knxMockAdvance(60000);
+    http.setRemoteIP(clientIP(0));
+    http.setInFlight(1);
+}
+
+void tearDown()
+{
+}
+
+void test_flood_from_one_client()
+{
+    std::vector<uint64_t> admittedNanos, rejectedNanos;
+    uint64_t slowestNanos = 0;
+    webserver.resetLoopStats();
+    for (int i = 0; i < FLOOD_REQUESTS; i++)
+    {
+        knxMockAdvance(1);
+        // The synchronous server answers from loop(), both count for the sketch
+        auto start = std::chrono::steady_clock::now();
+        KnxMockResponse response = http.get("/api/status");
+        webserver.loop();
+        uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        slowestNanos = max(slowestNanos, nanos);
+        if (response.code == 200)
+        {
+            admittedNanos.push_back(nanos);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(429, response.code);
+        TEST_ASSERT_EQUAL_STRING("1", response.header("Retry-After").c_str());
+        TEST_ASSERT_EQUAL_UINT64(0, response.allocations);
+        rejectedNanos.push_back(nanos);
+    }
+    unsigned long gap = profileValue("loopGapMax");
+
+    // The burst, then the refill of about 2 s at 10 per second
+    TEST_ASSERT_GREATER_OR_EQUAL(KNXWEB_RATE_BURST + 2 * KNXWEB_RATE_PER_SECOND - 1, admittedNanos.size());
+    TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_RATE_BURST + 2 * KNXWEB_RATE_PER_SECOND + 2, admittedNanos.size());
+    // Refusing is cheaper than serving, loop() keeps getting called every ms
+    TEST_ASSERT_LESS_OR_EQUAL(median(admittedNanos), median(rejectedNanos));
+    TEST_ASSERT_LESS_THAN(5000000, slowestNanos);
+    TEST_ASSERT_LESS_OR_EQUAL(1000 + slowestNanos / 1000 + 1000, gap);
+    printf("{\"host\": \"native\", \"flood\": {\"requests\":%d,\"admitted\":%zu,\"admittedP50Us\":%.2f,\"rejectedP50Us\":%.2f,"
+           "\"slowestUs\":%.2f,\"loopGapMaxUs\":%lu}}\n",
+           FLOOD_REQUESTS, admittedNanos.size(), median(admittedNanos) / 1000.0, median(rejectedNanos) / 1000.0,
+           slowestNanos / 1000.0, gap);
+}
+
+void test_flood_from_many_clients()
+{
+    // More clients than the limiter tracks, each new one starts with a full bucket
+    size_t admittedCost = 0;
+    for (int i = 0; i < FLOOD_REQUESTS; i++)
+    {
+        knxMockAdvance(1);
+        http.setRemoteIP(clientIP(i % (KNXWEB_RATE_CLIENTS + 4)));
+        KnxMockResponse response = http.get("/");
+        TEST_ASSERT_TRUE(response.code == 200 || response.code == 429);
+        admittedCost += response.code == 200 ? 4 : 0;
+    }
+    // The global bucket caps them together, pages leave the reserve untouched
+    TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_RATE_GLOBAL_BURST + 2 * KNXWEB_RATE_GLOBAL_PER_SECOND + 4, admittedCost);
+    http.setRemoteIP(clientIP(50));
+    TEST_ASSERT_EQUAL_INT(429, http.get("/").code);
+    TEST_ASSERT_EQUAL_INT(200, http.get("/api/status").code);
+}
+
+void test_running_upload_is_not_charged()
+{
+    KnxMockResponse response = http.post("/upload/begin?size=1000000&sha256=" + std::string(64, 'a'));
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    // Far more chunks and polls than a bucket holds, without any time passing
+    std::string chunk(512, '\x11');
+    chunk[0] = (char)0xE9;
+    for (int i = 0; i < 200; i++)
+    {
+        response = http.upload("/upload/chunk?offset=" + std::to_string(i * chunk.size()), "blob", chunk);
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_EQUAL_INT(200, http.get("/upload/status").code);
+    }
+    // Other requests of the uploading client and polls of other clients are charged
+    int admitted = 0;
+    for (int i = 0; i < 2 * KNXWEB_RATE_BURST; i++)
+    {
+        admitted += http.get("/api/status").code == 200;
+    }
+    TEST_ASSERT_EQUAL_INT(KNXWEB_RATE_BURST - 1, admitted);
+    http.setRemoteIP(clientIP(1));
+    admitted = 0;
+    for (int i = 0; i < 2 * KNXWEB_RATE_BURST; i++)
+    {
+        admitted += http.get("/upload/status").code == 200;
+    }
+    TEST_ASSERT_EQUAL_INT(KNXWEB_RATE_BURST, admitted);
+}
+
+void test_in_flight_gate()
+{
+    unsigned long overloaded = profileValue("overloaded");
+    http.setInFlight(KNXWEB_RATE_IN_FLIGHT + 1);
+    KnxMockResponse response = http.get("/api/status");
+    TEST_ASSERT_EQUAL_INT(429, response.code);
+    TEST_ASSERT_EQUAL_STRING("1", response.header("Retry-After").c_str());
+    TEST_ASSERT_EQUAL_INT(429, http.get("/").code);
+    // The chunks of the upload still running from the test before cost nothing
+    std::string chunk(512, '\x11');
+    response = http.upload("/upload/chunk?offset=" + std::to_string(200 * chunk.size()), "blob", chunk);
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+
+    http.setInFlight(KNXWEB_RATE_IN_FLIGHT);
+    TEST_ASSERT_EQUAL_INT(200, http.get("/api/status").code);
+    http.setInFlight(1);
+    TEST_ASSERT_EQUAL(overloaded + 2, profileValue("overloaded"));
+    TEST_ASSERT_EQUAL(KNXWEB_RATE_IN_FLIGHT + 1, profileValue("inFlightMax"));
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_flood_from_one_client);
+    RUN_TEST(test_flood_from_many_clients);
+    RUN_TEST(test_running_upload_is_not_charged);
+    RUN_TEST(test_in_flight_gate);
+    return UNITY_END();
+}
@@ -0,0 +1,170 @@
+// Login sessions: the cookie a Basic auth login hands out, its reuse instead of the
+// credentials, the session of a client address that sends no cookie, expiry, the slot
+// table and /logout. Requests are a second apart so the rate limiter lets them through.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <set>
+#include <string>
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+uint8_t nextClient = 1;
+
+static KnxMockResponse get(const char *uri, const std::string &cookie = "")
+{
+    knxMockAdvance(1000);
+    if (!cookie.empty())
+    {
+        http.header("Cookie", ("KNXSESSION=" + cookie).c_str());
+    }
+    return http.get(uri);
+}
+
+// Token of the Set-Cookie header, empty when there is none
+static std::string token(const KnxMockResponse &response)
+{
+    std::string cookie = response.header("Set-Cookie");
+    if (cookie.compare(0, 11, "KNXSESSION=") != 0)
+    {
+        return "";
+    }
+    return cookie.substr(11, cookie.find(';') - 11);
+}
+
+static unsigned long maxAge(const KnxMockResponse &response)
+{
+    std::string cookie = response.header("Set-Cookie");
+    size_t position = cookie.find("Max-Age=");
+    TEST_ASSERT_TRUE(position != std::string::npos);
+    return strtoul(cookie.c_str() + position + 8, nullptr, 10);
+}
+
+void setUp()
+{
+    // Every test is another client
+    http.setRemoteIP(IPAddress(192, 168, 4, nextClient++));
+    http.setCredentials("admin", "secret");
+}
+
+void tearDown()
+{
+}
+
+void test_login()
+{
+    http.setCredentials("", "");
+    KnxMockResponse response = get("/api/status");
+    TEST_ASSERT_EQUAL_INT(401, response.code);
+    TEST_ASSERT_EQUAL_STRING("", token(response).c_str());
+    http.setCredentials("admin", "wrong");
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status").code);
+
+    http.setCredentials("admin", "secret");
+    response = get("/api/status");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    std::string session = token(response);
+    TEST_ASSERT_EQUAL_size_t(32, session.size());
+    TEST_ASSERT_TRUE(session.find_first_not_of("0123456789abcdef") == std::string::npos);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_SESSION_TIMEOUT, maxAge(response));
+    std::string cookie = response.header("Set-Cookie");
+    TEST_ASSERT_TRUE(cookie.find("; HttpOnly") != std::string::npos);
+    TEST_ASSERT_TRUE(cookie.find("; SameSite=Strict") != std::string::npos);
+}
+
+// The cookie alone is enough and the server does not send it again
+void test_cookie_reuse()
+{
+    std::string session = token(get("/api/status"));
+    http.setCredentials("", "");
+    for (int i = 0; i < 3; i++)
+    {
+        KnxMockResponse response = get("/api/status", session);
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_EQUAL_STRING("", response.header("Set-Cookie").c_str());
+    }
+    // A token that was never handed out
+    std::string forged = session;
+    forged[0] = forged[0] == '0' ? '1' : '0';
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status", forged).code);
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status", "not-a-token").code);
+}
+
+// Clients without a cookie store get the session of their address again with the remaining time
+void test_address_reuse()
+{
+    KnxMockResponse first = get("/api/status");
+    knxMockAdvance(60000);
+    KnxMockResponse second = get("/api/status");
+    TEST_ASSERT_EQUAL_STRING(token(first).c_str(), token(second).c_str());
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_SESSION_TIMEOUT - 61, maxAge(second));
+
+    http.setRemoteIP(IPAddress(192, 168, 4, nextClient++));
+    KnxMockResponse other = get("/api/status");
+    TEST_ASSERT_TRUE(token(other) != token(first));
+    // The first client keeps its session
+    http.setCredentials("", "");
+    TEST_ASSERT_EQUAL_INT(200, get("/api/status", token(first)).code);
+}
+
+void test_expiry()
+{
+    std::string session = token(get("/api/status"));
+    http.setCredentials("", "");
+    knxMockAdvance(KNXWEB_SESSION_TIMEOUT * 1000UL - 2000);
+    TEST_ASSERT_EQUAL_INT(200, get("/api/status", session).code);
+    knxMockAdvance(1000);
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status", session).code);
+
+    // Logging in again starts a new session
+    http.setCredentials("admin", "secret");
+    KnxMockResponse response = get("/api/status");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_TRUE(token(response) != session);
+    TEST_ASSERT_EQUAL_UINT32(KNXWEB_SESSION_TIMEOUT, maxAge(response));
+}
+
+// With every slot taken, a new client replaces the oldest session
+void test_slots()
+{
+    std::string sessions[KNXWEB_SESSION_SLOTS + 1];
+    for (int i = 0; i <= KNXWEB_SESSION_SLOTS; i++)
+    {
+        http.setRemoteIP(IPAddress(192, 168, 5, 1 + i));
+        sessions[i] = token(get("/api/status"));
+    }
+    std::set<std::string> unique(sessions, sessions + KNXWEB_SESSION_SLOTS + 1);
+    TEST_ASSERT_EQUAL_size_t(KNXWEB_SESSION_SLOTS + 1, unique.size());
+    http.setCredentials("", "");
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status", sessions[0]).code);
+    for (int i = 1; i <= KNXWEB_SESSION_SLOTS; i++)
+    {
+        TEST_ASSERT_EQUAL_INT(200, get("/api/status", sessions[i]).code);
+    }
+}
+
+void test_logout()
+{
+    std::string session = token(get("/api/status"));
+    http.setCredentials("", "");
+    KnxMockResponse response = get("/logout", session);
+    TEST_ASSERT_EQUAL_INT(401, response.code);
+    TEST_ASSERT_EQUAL_STRING("KNXSESSION=; Max-Age=0; Path=/; HttpOnly; SameSite=Strict", response.header("Set-Cookie").c_str());
+    TEST_ASSERT_EQUAL_INT(401, get("/api/status", session).code);
+}
+
+int main()
+{
+    webserver.startWeb("admin", "secret");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_login);
+    RUN_TEST(test_cookie_reuse);
+    RUN_TEST(test_address_reuse);
+    RUN_TEST(test_expiry);
+    RUN_TEST(test_slots);
+    RUN_TEST(test_logout);
+    return UNITY_END();
+}
@@ -0,0 +1,162 @@
+// System info cache: the hardware is read by begin() and every KNXWEB_SYSINFO_INTERVAL ms
+// from loop(), never by a request. Checks the sample ring and its ranges and prints the
+// cost of a loop() call without and with a sample in the format of test_bench.
+
+#include <KnxMock.h>
+#include <esp-knx-sysinfo.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define STATUS_REQUESTS 8
+#define LOOP_BATCHES 1000
+#define LOOP_BATCH_SIZE 1000
+#define SAMPLE_RUNS 10000
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+
+static double percentile(std::vector<double> values, int percent)
+{
+    std::sort(values.begin(), values.end());
+    return values[(values.size() * percent + 99) / 100 - 1];
+}
+
+void setUp()
+{
+    WiFi.rssi = -60;
+}
+
+void tearDown()
+{
+}
+
+// Read once by begin(), then only when the interval has passed
+void test_sampling_interval()
+{
+    KnxSystemInfo info;
+    uint32_t reads = WiFi.rssiReads;
+    info.begin();
+    TEST_ASSERT_EQUAL_UINT32(reads + 1, WiFi.rssiReads);
+    TEST_ASSERT_EQUAL_INT8(-60, info.getRssi());
+    TEST_ASSERT_EQUAL_UINT32(ESP.getFreeHeap(), info.getFreeHeap());
+
+    WiFi.rssi = -70;
+    for (int i = 0; i < 100; i++)
+    {
+        info.loop();
+    }
+    TEST_ASSERT_EQUAL_UINT32(reads + 1, WiFi.rssiReads);
+    TEST_ASSERT_EQUAL_INT8(-60, info.getRssi());
+    knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+    info.loop();
+    info.loop();
+    TEST_ASSERT_EQUAL_UINT32(reads + 2, WiFi.rssiReads);
+    TEST_ASSERT_EQUAL_INT8(-70, info.getRssi());
+}
+
+// The ring keeps the last KNXWEB_SYSINFO_SAMPLES samples
+void test_ranges()
+{
+    KnxSystemInfo info;
+    WiFi.rssi = -90;
+    info.begin();
+    knxSysInfoRange_t range = info.getRssiRange();
+    TEST_ASSERT_EQUAL_INT32(-90, range.min);
+    TEST_ASSERT_EQUAL_INT32(-90, range.avg);
+    TEST_ASSERT_EQUAL_INT32(-90, range.max);
+
+    for (int i = 0; i < KNXWEB_SYSINFO_SAMPLES - 1; i++)
+    {
+        WiFi.rssi = -50 - (i % 3) * 10;
+        knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+        info.loop();
+    }
+    range = info.getRssiRange();
+    TEST_ASSERT_EQUAL_INT32(-90, range.min);
+    TEST_ASSERT_EQUAL_INT32(-50, range.max);
+
+    // The first sample drops out
+    WiFi.rssi = -70;
+    knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+    info.loop();
+    range = info.getRssiRange();
+    TEST_ASSERT_EQUAL_INT32(-70, range.min);
+    TEST_ASSERT_EQUAL_INT32(-60, range.avg);
+    TEST_ASSERT_EQUAL_INT32(-50, range.max);
+    TEST_ASSERT_EQUAL_UINT32(ESP.getFreeHeap(), info.getHeapRange().max);
+}
+
+// Requests read the cache, only loop() asks the radio
+void test_requests_read_cache()
+{
+    knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+    webserver.loop();
+    uint32_t reads = WiFi.rssiReads;
+    WiFi.rssi = -75;
+    for (int i = 0; i < STATUS_REQUESTS; i++)
+    {
+        // Past the rate limiter, not past the sample interval
+        knxMockAdvance(200);
+        KnxMockResponse response = http.get(i % 2 == 0 ? "/api/status" : "/metrics");
+        TEST_ASSERT_EQUAL_INT(200, response.code);
+        TEST_ASSERT_TRUE(response.body.find("-75") == std::string::npos);
+    }
+    TEST_ASSERT_EQUAL_UINT32(reads, WiFi.rssiReads);
+    knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(reads + 1, WiFi.rssiReads);
+    TEST_ASSERT_TRUE(http.get("/api/status").body.find("\"rssi\":-75") != std::string::npos);
+}
+
+// Nanoseconds per loop() call of KnxSystemInfo, most calls only compare the time
+void test_sampling_cost()
+{
+    static KnxSystemInfo info;
+    info.begin();
+    std::vector<double> idle;
+    idle.reserve(LOOP_BATCHES);
+    std::vector<double> sampling;
+    sampling.reserve(SAMPLE_RUNS);
+    uint64_t allocations = knxMockHeap().allocations;
+    for (int batch = 0; batch < LOOP_BATCHES; batch++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < LOOP_BATCH_SIZE; i++)
+        {
+            info.loop();
+        }
+        auto end = std::chrono::steady_clock::now();
+        idle.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)LOOP_BATCH_SIZE);
+    }
+
+    for (int run = 0; run < SAMPLE_RUNS; run++)
+    {
+        knxMockAdvance(KNXWEB_SYSINFO_INTERVAL);
+        auto start = std::chrono::steady_clock::now();
+        info.loop();
+        auto end = std::chrono::steady_clock::now();
+        sampling.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    TEST_ASSERT_EQUAL_UINT64(allocations, knxMockHeap().allocations);
+    printf("{\"host\": \"native\", \"sysinfoLoop\": {\"idle\":{\"samples\":%d,\"p50Ns\":%.2f,\"p99Ns\":%.2f},"
+           "\"sample\":{\"samples\":%d,\"p50Ns\":%.2f,\"p99Ns\":%.2f}}}\n",
+           LOOP_BATCHES * LOOP_BATCH_SIZE, percentile(idle, 50), percentile(idle, 99),
+           SAMPLE_RUNS, percentile(sampling, 50), percentile(sampling, 99));
+}
+
+int main()
+{
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sampling_interval);
+    RUN_TEST(test_ranges);
+    RUN_TEST(test_requests_read_cache);
+    RUN_TEST(test_sampling_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,206 @@
+// Display image relay with a slow and a stalled sink. The synchronous server waits inside
+// the upload handler, yield() moves the clock of the mock on by 1 ms.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+#define TFT_IMAGE_SIZE (100 * 1024)
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+std::string image;
+
+// The display: takes up to bytesPerCall, and nothing on every busyEvery-th call
+static struct
+{
+    size_t bytesPerCall;
+    uint32_t busyEvery;
+    uint32_t calls;
+    bool open;
+    int ended;
+    bool success;
+    bool crossedChunk;
+    std::string received;
+} sink;
+
+static bool sinkBegin(size_t size)
+{
+    sink.open = true;
+    return size == image.size();
+}
+
+static size_t sinkWrite(const uint8_t *data, size_t length)
+{
+    KnxMockUncounted uncounted;
+    sink.calls++;
+    if (sink.busyEvery != 0 && sink.calls % sink.busyEvery == 0)
+    {
+        return 0;
+    }
+    size_t offset = sink.received.size();
+    sink.crossedChunk |= offset / KNXWEB_TFT_CHUNK != (offset + length - 1) / KNXWEB_TFT_CHUNK;
+    size_t taken = min(length, sink.bytesPerCall);
+    sink.received.append((const char *)data, taken);
+    return taken;
+}
+
+static uint32_t idleCalls = 0;
+
+static void idle()
+{
+    idleCalls++;
+}
+
+static void sinkEnd(bool success)
+{
+    sink.open = false;
+    sink.ended++;
+    sink.success = success;
+}
+
+static std::string status()
+{
+    knxMockAdvance(200);
+    return http.get("/tftupload/status").body;
+}
+
+static bool contains(const std::string &text, const char *part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+// Runs loop() until the relay is done with the sink and has freed its buffer
+static void drain()
+{
+    for (int i = 0; i < 10000 && (i == 0 || sink.open); i++)
+    {
+        knxMockAdvance(1);
+        webserver.loop();
+    }
+}
+
+void setUp()
+{
+    knxMockAdvance(10000);
+    sink.bytesPerCall = SIZE_MAX;
+    sink.busyEvery = 0;
+    sink.calls = 0;
+    sink.ended = 0;
+    sink.success = false;
+    sink.crossedChunk = false;
+    sink.received.clear();
+}
+
+void tearDown()
+{
+}
+
+void test_slow_sink()
+{
+    sink.bytesPerCall = 700;
+    sink.busyEvery = 3;
+    knxMockHeapStats_t before = knxMockHeap();
+    knxMockResetPeak();
+    KnxMockResponse response = http.upload("/tftupload?size=" + std::to_string(image.size()), "display.tft", image);
+    TEST_ASSERT_TRUE(response.code == 200 || response.code == 202);
+    drain();
+    knxMockHeapStats_t after = knxMockHeap();
+
+    TEST_ASSERT_EQUAL_INT(1, sink.ended);
+    TEST_ASSERT_TRUE(sink.success);
+    TEST_ASSERT_TRUE(sink.received == image);
+    TEST_ASSERT_FALSE(sink.crossedChunk);
+    // Only the ring buffer was held, and given back
+    TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_TFT_BUFFER + 256, after.peak - before.used);
+    TEST_ASSERT_EQUAL_size_t(before.used, after.used);
+    std::string state = status();
+    TEST_ASSERT_TRUE(contains(state, "\"state\":\"done\""));
+    TEST_ASSERT_TRUE(contains(state, ("\"written\":" + std::to_string(image.size())).c_str()));
+    TEST_ASSERT_TRUE(contains(state, "\"buffered\":0"));
+}
+
+// The handler waits for the display, but loop() and the idle callback keep running
+void test_loop_while_waiting()
+{
+    sink.bytesPerCall = 300;
+    sink.busyEvery = 2;
+    idleCalls = 0;
+    webserver.resetLoopStats();
+    webserver.loop(2000);
+    unsigned long start = millis();
+    KnxMockResponse response = http.upload("/tftupload?size=" + std::to_string(image.size()), "display.tft", image);
+    TEST_ASSERT_TRUE(response.code == 200 || response.code == 202);
+    // The sink took a while, the loop did not wait for it
+    TEST_ASSERT_GREATER_THAN(100, millis() - start);
+    TEST_ASSERT_GREATER_THAN(100, idleCalls);
+    TEST_ASSERT_GREATER_THAN(100, webserver.getLoopStats().calls);
+    TEST_ASSERT_LESS_OR_EQUAL(3000, webserver.getLoopStats().maxGapMicros);
+    drain();
+    TEST_ASSERT_TRUE(sink.success);
+    TEST_ASSERT_TRUE(sink.received == image);
+}
+
+void test_stalled_sink()
+{
+    sink.bytesPerCall = 0;
+    knxMockHeapStats_t before = knxMockHeap();
+    unsigned long start = millis();
+    KnxMockResponse response = http.upload("/tftupload?size=" + std::to_string(image.size()), "display.tft", image);
+    // The handler gave up after the timeout instead of waiting for the whole image
+    TEST_ASSERT_LESS_OR_EQUAL(KNXWEB_TFT_TIMEOUT + 100, millis() - start);
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_TRUE(contains(response.body, "\"error\":\"Display timeout\""));
+    webserver.loop();
+    TEST_ASSERT_EQUAL_INT(1, sink.ended);
+    TEST_ASSERT_FALSE(sink.success);
+    TEST_ASSERT_EQUAL_size_t(before.used, knxMockHeap().used);
+}
+
+void test_upload_lost_midway()
+{
+    sink.bytesPerCall = 1000;
+    KnxMockResponse response =
+        http.upload("/tftupload?size=" + std::to_string(image.size()), "display.tft", image, 1460, 20);
+    TEST_ASSERT_EQUAL_INT(0, response.code);
+    drain();
+    TEST_ASSERT_EQUAL_INT(1, sink.ended);
+    TEST_ASSERT_FALSE(sink.success);
+    TEST_ASSERT_TRUE(image.compare(0, sink.received.size(), sink.received) == 0);
+    TEST_ASSERT_TRUE(contains(status(), "\"error\":\"Upload aborted\""));
+}
+
+void test_refused_by_display()
+{
+    std::string uri = "/tftupload?size=" + std::to_string(image.size() + 1);
+    KnxMockResponse response = http.upload(uri, "display.tft", image);
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_TRUE(contains(response.body, "\"error\":\"Refused by display\""));
+    drain();
+    TEST_ASSERT_EQUAL_size_t(0, sink.received.size());
+    TEST_ASSERT_EQUAL_INT(1, sink.ended);
+    // The next image goes through
+    setUp();
+    test_slow_sink();
+}
+
+int main()
+{
+    for (size_t i = 0; i < TFT_IMAGE_SIZE; i++)
+    {
+        image += (char)(i * 13 + (i >> 9));
+    }
+    webserver.registerTftUploadCallbacks(sinkBegin, sinkWrite, sinkEnd);
+    webserver.registerIdleCallback(idle);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_slow_sink);
+    RUN_TEST(test_loop_while_waiting);
+    RUN_TEST(test_stalled_sink);
+    RUN_TEST(test_upload_lost_midway);
+    RUN_TEST(test_refused_by_display);
+    return UNITY_END();
+}
@@ -0,0 +1,227 @@
+// Firmware uploads with connections that are lost midway, the resumable upload and the
+// idle timeout. Update is the mock of the ESP8266 core, it records what was written.
+
+#include <KnxMock.h>
+#include <esp-knx-webserver.h>
+#include <unity.h>
+
+#include <string>
+
+#define IMAGE_SIZE (48 * 1024)
+#define CHUNK_SIZE (16 * 1024)
+
+KnxWebserver webserver;
+KnxMockHttp http(webserver.getTransport());
+std::string image;
+std::string imageSha256;
+
+static std::string sha256Hex(const std::string &data)
+{
+    KnxSha256 hash;
+    uint8_t digest[KNXWEB_SHA256_SIZE];
+    hash.begin();
+    hash.update((const uint8_t *)data.data(), data.size());
+    hash.finish(digest);
+    char hex[2 * KNXWEB_SHA256_SIZE + 1];
+    for (size_t i = 0; i < KNXWEB_SHA256_SIZE; i++)
+    {
+        snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+    }
+    return hex;
+}
+
+// Requests are spread out a little, the rate limiter admits them all
+static KnxMockResponse get(const std::string &uri)
+{
+    knxMockAdvance(200);
+    return http.get(uri);
+}
+
+static KnxMockResponse post(const std::string &uri)
+{
+    knxMockAdvance(200);
+    return http.post(uri);
+}
+
+static KnxMockResponse beginUpload(const std::string &sha256 = imageSha256)
+{
+    return post("/upload/begin?size=" + std::to_string(image.size()) + "&sha256=" + sha256 + "&name=firmware.bin");
+}
+
+static KnxMockResponse sendChunk(size_t offset, size_t length, size_t abortAfter = SIZE_MAX)
+{
+    knxMockAdvance(200);
+    return http.upload("/upload/chunk?offset=" + std::to_string(offset), "blob", image.substr(offset, length), 1460,
+                       abortAfter);
+}
+
+static std::string status()
+{
+    return get("/upload/status").body;
+}
+
+static bool contains(const std::string &text, const char *part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+void setUp()
+{
+    // An upload left running by the test before times out
+    knxMockAdvance(KNXWEB_UPLOAD_IDLE_TIMEOUT * 1000UL + 1000);
+    webserver.loop();
+    Update.failAt = SIZE_MAX;
+    Update.activated = false;
+    ESP.restarts = 0;
+}
+
+void tearDown()
+{
+    // A restart left pending by the test is run now
+    knxMockAdvance(1000);
+    webserver.loop();
+}
+
+void test_one_shot_upload_lost_midway()
+{
+    KnxMockResponse response = http.upload("/upload?size=" + std::to_string(image.size()), "firmware.bin", image, 1460, 10);
+    // The connection is gone, no response is sent
+    TEST_ASSERT_EQUAL_INT(0, response.code);
+    TEST_ASSERT_FALSE(Update.running);
+    TEST_ASSERT_FALSE(Update.activated);
+    TEST_ASSERT_EQUAL_size_t(10 * 1460, Update.image.size());
+    std::string state = status();
+    TEST_ASSERT_TRUE(contains(state, "\"state\":\"failed\""));
+    TEST_ASSERT_TRUE(contains(state, "\"error\":\"Upload aborted\""));
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, ESP.restarts);
+}
+
+void test_one_shot_upload()
+{
+    KnxMockResponse response = http.upload("/upload?size=" + std::to_string(image.size()), "firmware.bin", image);
+    TEST_ASSERT_EQUAL_INT(307, response.code);
+    TEST_ASSERT_TRUE(response.closeConnection);
+    TEST_ASSERT_TRUE(Update.activated);
+    TEST_ASSERT_TRUE(Update.image == image);
+}
+
+void test_resume_after_lost_chunk()
+{
+    KnxMockResponse response = beginUpload();
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_EQUAL_STRING("{\"offset\":0}", response.body.c_str());
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(0, CHUNK_SIZE).code);
+
+    // The connection breaks after three parts of the second chunk, the upload keeps running
+    TEST_ASSERT_EQUAL_INT(0, sendChunk(CHUNK_SIZE, CHUNK_SIZE, 3).code);
+    TEST_ASSERT_TRUE(contains(status(), "\"state\":\"running\""));
+    size_t offset = CHUNK_SIZE + 3 * 1460;
+    response = beginUpload();
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_EQUAL_STRING(("{\"offset\":" + std::to_string(offset) + "}").c_str(), response.body.c_str());
+
+    // A chunk after the received data is refused, one overlapping it is taken
+    TEST_ASSERT_EQUAL_INT(409, sendChunk(offset + 100, 100).code);
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(offset - 1000, image.size() - offset + 1000).code);
+    TEST_ASSERT_FALSE(Update.activated);
+
+    response = post("/upload/end");
+    TEST_ASSERT_EQUAL_INT(200, response.code);
+    TEST_ASSERT_TRUE(response.closeConnection);
+    TEST_ASSERT_TRUE(Update.activated);
+    TEST_ASSERT_TRUE(Update.image == image);
+    TEST_ASSERT_TRUE(contains(status(), "\"verified\":true"));
+    knxMockAdvance(1000);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, ESP.restarts);
+}
+
+void test_end_before_complete()
+{
+    TEST_ASSERT_EQUAL_INT(200, beginUpload().code);
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(0, CHUNK_SIZE).code);
+    KnxMockResponse response = post("/upload/end");
+    TEST_ASSERT_EQUAL_INT(409, response.code);
+    TEST_ASSERT_TRUE(contains(response.body, "\"error\":\"incomplete\""));
+    TEST_ASSERT_FALSE(Update.activated);
+}
+
+void test_sha256_mismatch()
+{
+    std::string wrong = sha256Hex(image + "x");
+    TEST_ASSERT_EQUAL_INT(200, beginUpload(wrong).code);
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(0, image.size()).code);
+    KnxMockResponse response = post("/upload/end");
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_TRUE(contains(response.body, "\"error\":\"SHA-256 mismatch\""));
+    TEST_ASSERT_FALSE(Update.running);
+    TEST_ASSERT_FALSE(Update.activated);
+    webserver.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, ESP.restarts);
+}
+
+void test_flash_write_error()
+{
+    Update.failAt = 20000;
+    TEST_ASSERT_EQUAL_INT(200, beginUpload().code);
+    KnxMockResponse response = sendChunk(0, image.size());
+    TEST_ASSERT_EQUAL_INT(502, response.code);
+    TEST_ASSERT_TRUE(contains(response.body, "\"error\":\"Flash write failed\""));
+    TEST_ASSERT_FALSE(Update.activated);
+    // A new begin starts over
+    Update.failAt = SIZE_MAX;
+    TEST_ASSERT_EQUAL_STRING("{\"offset\":0}", beginUpload().body.c_str());
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(0, CHUNK_SIZE).code);
+    TEST_ASSERT_TRUE(Update.running);
+}
+
+void test_idle_timeout()
+{
+    TEST_ASSERT_EQUAL_INT(200, beginUpload().code);
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(0, CHUNK_SIZE).code);
+    TEST_ASSERT_TRUE(Update.running);
+
+    knxMockAdvance(KNXWEB_UPLOAD_IDLE_TIMEOUT * 1000UL - 1000);
+    webserver.loop();
+    TEST_ASSERT_TRUE(Update.running);
+    // Data keeps it alive
+    TEST_ASSERT_EQUAL_INT(200, sendChunk(CHUNK_SIZE, CHUNK_SIZE).code);
+    knxMockAdvance(KNXWEB_UPLOAD_IDLE_TIMEOUT * 1000UL - 1000);
+    webserver.loop();
+    TEST_ASSERT_TRUE(Update.running);
+
+    knxMockAdvance(2000);
+    webserver.loop();
+    TEST_ASSERT_FALSE(Update.running);
+    TEST_ASSERT_FALSE(Update.activated);
+    std::string state = status();
+    TEST_ASSERT_TRUE(contains(state, "\"state\":\"failed\""));
+    TEST_ASSERT_TRUE(contains(state, "\"error\":\"Upload timed out\""));
+    // The client comes back too late and starts over
+    TEST_ASSERT_EQUAL_INT(502, sendChunk(2 * CHUNK_SIZE, CHUNK_SIZE).code);
+    TEST_ASSERT_EQUAL_STRING("{\"offset\":0}", beginUpload().body.c_str());
+}
+
+int main()
+{
+    for (size_t i = 0; i < IMAGE_SIZE; i++)
+    {
+        image += (char)(i * 7 + (i >> 8));
+    }
+    // A raw image, not mistaken for gzip
+    image[0] = (char)0xE9;
+    imageSha256 = sha256Hex(image);
+    webserver.startWeb("", "");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_one_shot_upload_lost_midway);
+    RUN_TEST(test_end_before_complete);
+    RUN_TEST(test_sha256_mismatch);
+    RUN_TEST(test_flash_write_error);
+    RUN_TEST(test_idle_timeout);
+    // The mock does not restart, a requested restart stays pending. These run last.
+    RUN_TEST(test_resume_after_lost_chunk);
+    RUN_TEST(test_one_shot_upload);
+    return UNITY_END();
+}
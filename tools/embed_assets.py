@@ -0,0 +1,84 @@
+"""
+Embeds the files in web/ into src/esp-knx-webassets.h.
+
+HTML files are minified, every asset is gzip compressed and the compressed
+variant is kept when it is smaller than the original. The header is only
+rewritten when its content changes, so unchanged assets don't trigger a rebuild.
+
+Runs as PlatformIO pre script (extra_scripts = pre:tools/embed_assets.py)
+or standalone: python tools/embed_assets.py
+"""
+
+import gzip
+import os
+import re
+
+ASSETS = [
+    # (file in web/, C identifier)
+    ("index.html", "ROOT_HTML"),
+    ("update.html", "UPDATE_HTML"),
+    ("favicon.png", "FAVICON"),
+]
+
+HEADER = "src/esp-knx-webassets.h"
+
+
+def minify_html(data):
+    text = data.decode("utf-8")
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line).encode("utf-8")
+
+
+def compress(data):
+    # mtime=0 keeps the output reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    out = ["constexpr char %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join("'\\x%02X'" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    out.append("constexpr size_t %s_LEN = sizeof(%s);" % (name, name))
+    return out
+
+
+def generate(project_dir):
+    out = [
+        "// Generated by tools/embed_assets.py from the files in web/, do not edit.",
+        "#pragma once",
+        "",
+    ]
+    for filename, name in ASSETS:
+        with open(os.path.join(project_dir, "web", filename), "rb") as f:
+            data = f.read()
+        if filename.endswith(".html"):
+            data = minify_html(data)
+        gz = compress(data)
+
+        out.append("// %s: %d bytes, gzip %d bytes" % (filename, len(data), len(gz)))
+        out += c_array(name, data)
+        if len(gz) < len(data):
+            out += c_array(name + "_GZ", gz)
+        else:
+            out.append("constexpr const char *%s_GZ = nullptr;" % name)
+            out.append("constexpr size_t %s_GZ_LEN = 0;" % name)
+        out.append("")
+
+    content = "\n".join(out)
+    path = os.path.join(project_dir, HEADER)
+    if os.path.exists(path):
+        with open(path, "r") as f:
+            if f.read() == content:
+                return
+    with open(path, "w") as f:
+        f.write(content)
+    print("embed_assets: updated %s" % HEADER)
+
+
+try:
+    Import("env")  # noqa: F821
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    generate(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
@@ -0,0 +1,189 @@
+"""
+Load and latency benchmark for a device running KnxWebserver.
+
+Requests every route at the given rate from several connections and prints
+one JSON document with the client side latency percentiles and throughput
+per route, next to the server side figures from /api/profile.
+
+    python tools/knx_bench.py 192.168.1.50 --user admin --password secret
+    python tools/knx_bench.py 192.168.1.50 --requests 500 --concurrency 4 --actions
+
+Routes that change the device state (/progmode, /api/command, /upload) only
+run with --actions. They are sent as POST like the buttons of the page do.
+The upload sends an invalid image that the device rejects, the running
+firmware is not touched.
+
+"knxLoopGapMaxUs" is the longest time the sketch waited between two calls of
+KnxWebserver::loop() while the benchmark ran, the delay the KNX stack saw under
+the load. "overloaded" counts requests refused because too many were in flight.
+
+"connections" counts the TCP connections a route needed, it drops below
+"requests" when the device keeps connections open. "limited" counts the
+requests the rate limiter of the device refused with 429, they are no errors.
+Use --rate to stay below the limit or without it to see the limiter at work.
+"""
+
+import argparse
+import base64
+import http.client
+import json
+import threading
+import time
+
+READ_ROUTES = ["/", "/favicon.ico", "/webupdate", "/api/info", "/api/status", "/bench-not-found"]
+ACTION_ROUTES = ["/progmode", "/normalmode", "/api/command", "/upload"]
+COMMAND_BODY = b'{"knxMode":"normal","ota":false}'
+
+UPLOAD_BOUNDARY = "knxbench"
+UPLOAD_BODY = (
+    "--" + UPLOAD_BOUNDARY + "\r\n"
+    'Content-Disposition: form-data; name="upload"; filename="bench.bin"\r\n'
+    "Content-Type: application/octet-stream\r\n\r\n" + "\0" * 1024 + "\r\n"
+    "--" + UPLOAD_BOUNDARY + "--\r\n"
+).encode("latin-1")
+
+
+def percentile(values, percent):
+    if not values:
+        return 0
+    values = sorted(values)
+    return values[min(len(values) - 1, (len(values) * percent + 99) // 100 - 1)]
+
+
+class Client:
+    def __init__(self, host, port, auth):
+        self.host = host
+        self.port = port
+        self.headers = {}
+        if auth:
+            self.headers["Authorization"] = "Basic " + base64.b64encode(auth.encode()).decode()
+        self.connection = None
+        self.connections = 0
+
+    def request(self, path):
+        """Returns (status, body bytes, seconds), reconnects when the device closed the connection"""
+        for attempt in range(2):
+            if self.connection is None:
+                self.connection = http.client.HTTPConnection(self.host, self.port, timeout=10)
+                self.connections += 1
+            headers = dict(self.headers, **{"Accept-Encoding": "gzip"})
+            method, body = "GET", None
+            if path in ACTION_ROUTES:
+                method = "POST"
+            if path == "/api/command":
+                body = COMMAND_BODY
+                headers["Content-Type"] = "application/json"
+            if path == "/upload":
+                method, body = "POST", UPLOAD_BODY
+                headers["Content-Type"] = "multipart/form-data; boundary=" + UPLOAD_BOUNDARY
+            start = time.perf_counter()
+            try:
+                self.connection.request(method, path, body, headers)
+                response = self.connection.getresponse()
+                data = response.read()
+            except (http.client.HTTPException, OSError):
+                self.connection.close()
+                self.connection = None
+                if attempt == 1:
+                    raise
+                continue
+            elapsed = time.perf_counter() - start
+            if response.getheader("Connection", "").lower() == "close":
+                self.connection.close()
+                self.connection = None
+            return response.status, len(data), elapsed
+
+
+def run_route(args, path):
+    durations = []
+    sizes = []
+    errors = [0]
+    limited = [0]
+    connections = [0]
+    lock = threading.Lock()
+    remaining = [args.requests]
+    interval = args.concurrency / args.rate if args.rate else 0
+
+    def worker():
+        client = Client(args.host, args.port, args.auth)
+        while True:
+            with lock:
+                if remaining[0] == 0:
+                    connections[0] += client.connections
+                    return
+                remaining[0] -= 1
+            start = time.perf_counter()
+            try:
+                status, size, elapsed = client.request(path)
+            except (http.client.HTTPException, OSError):
+                with lock:
+                    errors[0] += 1
+                continue
+            with lock:
+                durations.append(elapsed)
+                sizes.append(size)
+                if status == 429:
+                    limited[0] += 1
+                elif status >= 500 or (status >= 400 and path != "/bench-not-found"):
+                    errors[0] += 1
+            if interval:
+                time.sleep(max(0, interval - (time.perf_counter() - start)))
+
+    start = time.perf_counter()
+    threads = [threading.Thread(target=worker) for _ in range(args.concurrency)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    wall = time.perf_counter() - start
+
+    return {
+        "path": path,
+        "requests": len(durations),
+        "errors": errors[0],
+        "limited": limited[0],
+        "connections": connections[0],
+        "rate": round(len(durations) / wall, 1) if wall else 0,
+        "p50Ms": round(percentile(durations, 50) * 1000, 2),
+        "p99Ms": round(percentile(durations, 99) * 1000, 2),
+        "maxMs": round(max(durations) * 1000, 2) if durations else 0,
+        "bytesPerRequest": sum(sizes) // len(sizes) if sizes else 0,
+    }
+
+
+def fetch_profile(args, reset=False):
+    client = Client(args.host, args.port, args.auth)
+    connection = http.client.HTTPConnection(args.host, args.port, timeout=10)
+    connection.request("GET", "/api/profile" + ("?reset=1" if reset else ""), headers=client.headers)
+    response = connection.getresponse()
+    data = response.read()
+    connection.close()
+    return json.loads(data) if response.status == 200 else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--user", default="")
+    parser.add_argument("--password", default="")
+    parser.add_argument("--requests", type=int, default=100, help="requests per route")
+    parser.add_argument("--concurrency", type=int, default=1, help="parallel connections")
+    parser.add_argument("--rate", type=float, default=0, help="requests per second per route, 0 for as fast as possible")
+    parser.add_argument("--actions", action="store_true", help="also run routes that change the device state")
+    args = parser.parse_args()
+    args.auth = args.user + ":" + args.password if args.user else ""
+
+    routes = READ_ROUTES + (ACTION_ROUTES if args.actions else [])
+    # The loop figures start over, afterwards they only cover the benchmark
+    before = fetch_profile(args, reset=True)
+    results = [run_route(args, path) for path in routes]
+    after = fetch_profile(args)
+
+    print(json.dumps({"host": args.host, "concurrency": args.concurrency, "routes": results,
+                      "knxLoopGapMaxUs": after.get("loopGapMax") if after else None,
+                      "deviceBefore": before, "deviceAfter": after}, indent=2))
+
+
+if __name__ == "__main__":
+    main()
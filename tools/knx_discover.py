@@ -0,0 +1,111 @@
+"""
+Finds devices running KnxWebserver and collects their status with a single
+UDP query instead of one HTTP request per device.
+
+    python tools/knx_discover.py
+    python tools/knx_discover.py --json --timeout 3 --spread 1000
+    python tools/knx_discover.py --target 192.168.1.50 --target 192.168.1.255
+
+The query goes to the multicast group the devices listen on, --target sends
+it to single devices or a broadcast address instead. Devices wait a random
+time up to --spread ms before they answer, so large installations don't
+answer all at once. Only devices built with -DKNXWEB_DISCOVERY=1 answer, and
+those requiring a login leave out the build. The layout of the datagrams is
+described in src/esp-knx-discovery.h.
+"""
+
+import argparse
+import json
+import socket
+import struct
+import time
+
+GROUP = "239.255.36.71"
+PORT = 39671
+VERSION = 1
+MODES = {0: "off", 1: "normal", 2: "prog", 0xFF: None}
+
+
+def build_query(spread):
+    return b"KNXQ" + struct.pack("<BH", VERSION, spread)
+
+
+def parse_reply(data):
+    """Returns the status as dict, None for datagrams that are no valid reply"""
+    if len(data) < 19 or data[:4] != b"KNXR" or data[4] != VERSION:
+        return None
+    flags, mode, rssi, phys, heap, uptime = struct.unpack_from("<BBbHII", data, 5)
+    texts = []
+    offset = 18
+    for _ in range(2):
+        if offset >= len(data) or offset + 1 + data[offset] > len(data):
+            return None
+        texts.append(data[offset + 1:offset + 1 + data[offset]].decode("utf-8", "replace"))
+        offset += 1 + data[offset]
+    return {
+        "hostname": texts[0],
+        "physAddr": "%d.%d.%d" % (phys >> 12, (phys >> 8) & 0x0F, phys & 0xFF),
+        "configOk": bool(flags & 0x01),
+        "otaActive": bool(flags & 0x02),
+        "auth": bool(flags & 0x04),
+        "mode": MODES.get(mode, mode),
+        "rssi": rssi,
+        "heap": heap,
+        "uptime": uptime,
+        "build": texts[1],
+    }
+
+
+def collect(targets, port, timeout, spread, ttl):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, ttl)
+    sock.bind(("", 0))
+    query = build_query(spread)
+    for target in targets:
+        sock.sendto(query, (target, port))
+
+    devices = {}
+    end = time.monotonic() + timeout
+    while True:
+        remaining = end - time.monotonic()
+        if remaining <= 0:
+            break
+        sock.settimeout(remaining)
+        try:
+            data, address = sock.recvfrom(512)
+        except socket.timeout:
+            break
+        status = parse_reply(data)
+        if status is not None:
+            status["ip"] = address[0]
+            devices[address] = status
+    sock.close()
+    return sorted(devices.values(), key=lambda device: socket.inet_aton(device["ip"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--target", action="append", help="address to query instead of the multicast group, can be repeated")
+    parser.add_argument("--port", type=int, default=PORT)
+    parser.add_argument("--timeout", type=float, default=2, help="seconds to wait for replies")
+    parser.add_argument("--spread", type=int, default=500, help="longest time in ms a device waits before it answers")
+    parser.add_argument("--ttl", type=int, default=1, help="multicast hops")
+    parser.add_argument("--json", action="store_true", help="print JSON instead of a table")
+    args = parser.parse_args()
+    args.spread = max(0, min(args.spread, 65535, int(args.timeout * 1000)))
+
+    devices = collect(args.target or [GROUP], args.port, args.timeout, args.spread, args.ttl)
+    if args.json:
+        print(json.dumps(devices, indent=2))
+        return
+    print("%-15s %-24s %-9s %-6s %-6s %5s %8s %9s  %s" % ("IP", "Hostname", "PhysAddr", "Mode", "Config", "RSSI", "Heap", "Uptime", "Build"))
+    for device in devices:
+        print("%-15s %-24s %-9s %-6s %-6s %5d %8d %9d  %s" % (
+            device["ip"], device["hostname"], device["physAddr"], device["mode"] or "-",
+            "ok" if device["configOk"] else "error", device["rssi"], device["heap"], device["uptime"], device["build"]))
+    print("%d device(s)" % len(devices))
+
+
+if __name__ == "__main__":
+    main()